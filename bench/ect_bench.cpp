@@ -0,0 +1,340 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#define ECT_BENCH_HAVE_TSC 1
+#endif
+
+#if !defined(ECT_BENCH_BUILD_TYPE)
+#define ECT_BENCH_BUILD_TYPE "unknown"
+#endif
+
+#include "ect_sdk.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_instrumentation.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_static_controller.hpp"
+#include "ect_tabulated_operators.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+// -----------------------------------------------------------------------------
+// ect_bench — update-path micro-benchmarks
+//
+// Usage: ect_bench [--quick] [--n N] [--threads T]   (N >= 1)
+//
+// Prints one JSON document to stdout. Each result reports the best of
+// several repetitions as ns/update, updates/sec and, on x86, TSC cycles per
+// update (TSC ticks at a constant reference rate, not the core clock).
+// Numbers from a build without optimisation (no CMAKE_BUILD_TYPE) are not
+// representative; the build type is recorded in the output. Instrumented
+// builds (ECT_SDK_ENABLE_INSTRUMENTATION) also print per-stage latencies.
+// -----------------------------------------------------------------------------
+
+namespace
+{
+    struct Config
+    {
+        std::size_t n       = 1 << 16;
+        std::size_t reps    = 15;
+        std::size_t threads = 0;
+    };
+
+    struct Result
+    {
+        std::string name;
+        std::string operators;
+        std::string inputs;
+        std::size_t threads = 1;
+        std::size_t n       = 0;
+        double      ns_per_update     = 0.0;
+        double      updates_per_sec   = 0.0;
+        double      cycles_per_update = -1.0;
+    };
+
+    volatile double g_sink = 0.0;
+
+    std::uint64_t read_tsc()
+    {
+#if defined(ECT_BENCH_HAVE_TSC)
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    Result measure(
+        const Config&                cfg,
+        const std::string&           name,
+        const std::string&           operators,
+        const std::string&           inputs,
+        std::size_t                  threads,
+        const std::function<void()>& body
+    )
+    {
+        body(); // warm-up
+
+        double        best_ns     = 1e300;
+        std::uint64_t best_cycles = 0;
+
+        for (std::size_t r = 0; r < cfg.reps; ++r)
+        {
+            const auto          t0 = std::chrono::steady_clock::now();
+            const std::uint64_t c0 = read_tsc();
+            body();
+            const std::uint64_t c1 = read_tsc();
+            const auto          t1 = std::chrono::steady_clock::now();
+
+            const double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+            if (ns < best_ns)
+            {
+                best_ns     = ns;
+                best_cycles = c1 - c0;
+            }
+        }
+
+        Result res;
+        res.name            = name;
+        res.operators       = operators;
+        res.inputs          = inputs;
+        res.threads         = threads;
+        res.n               = cfg.n;
+        res.ns_per_update   = best_ns / static_cast<double>(cfg.n);
+        res.updates_per_sec = 1e9 / res.ns_per_update;
+#if defined(ECT_BENCH_HAVE_TSC)
+        res.cycles_per_update = static_cast<double>(best_cycles) / static_cast<double>(cfg.n);
+#endif
+        return res;
+    }
+
+    // Deterministic inputs: |delta| <= 0.5 never saturates with bounds ±1,
+    // |delta| in [5, 50] always does.
+    std::vector<double> make_inputs(std::size_t n, bool saturated)
+    {
+        std::vector<double> v(n);
+        std::uint64_t state = 0x9E3779B97F4A7C15ull;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            const double u    = static_cast<double>(state >> 11) * (1.0 / 9007199254740992.0); // [0, 1)
+            const double sign = (state & 1) ? 1.0 : -1.0;
+            v[i] = saturated ? sign * (5.0 + 45.0 * u) : (u - 0.5);
+        }
+        return v;
+    }
+
+    void print_json(const std::vector<Result>& results)
+    {
+        std::printf("{\n");
+        std::printf("  \"sdk\": \"%s\",\n", SDK_NAME);
+        std::printf("  \"version\": \"%u.%u.%u\",\n", VERSION_MAJOR, VERSION_MINOR, VERSION_PATCH);
+        std::printf("  \"build_type\": \"%s\",\n", ECT_BENCH_BUILD_TYPE);
+        std::printf("  \"results\": [\n");
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            std::printf("    {\"name\": \"%s\", \"operators\": \"%s\", \"inputs\": \"%s\", "
+                        "\"threads\": %zu, \"n\": %zu, \"ns_per_update\": %.4f, "
+                        "\"updates_per_sec\": %.1f, ",
+                        r.name.c_str(), r.operators.c_str(), r.inputs.c_str(),
+                        r.threads, r.n, r.ns_per_update, r.updates_per_sec);
+            if (r.cycles_per_update >= 0.0)
+            {
+                std::printf("\"cycles_per_update\": %.3f}", r.cycles_per_update);
+            }
+            else
+            {
+                std::printf("\"cycles_per_update\": null}");
+            }
+            std::printf("%s\n", i + 1 < results.size() ? "," : "");
+        }
+        std::printf("  ]");
+
+        if (instrumentation::enabled)
+        {
+            const instrumentation::Snapshot snap = instrumentation::snapshot();
+            std::printf(",\n  \"stage_latency_ns\": {\n");
+            for (std::size_t s = 0; s < instrumentation::STAGE_COUNT; ++s)
+            {
+                const instrumentation::Summary& st = snap.stages[s];
+                std::printf("    \"%s\": {\"count\": %llu, \"p50\": %llu, \"p99\": %llu, "
+                            "\"p999\": %llu, \"max\": %llu}%s\n",
+                            instrumentation::stage_name(static_cast<instrumentation::Stage>(s)),
+                            static_cast<unsigned long long>(st.count),
+                            static_cast<unsigned long long>(st.p50_ns),
+                            static_cast<unsigned long long>(st.p99_ns),
+                            static_cast<unsigned long long>(st.p999_ns),
+                            static_cast<unsigned long long>(st.max_ns),
+                            s + 1 < instrumentation::STAGE_COUNT ? "," : "");
+            }
+            std::printf("  }");
+        }
+        std::printf("\n}\n");
+    }
+
+    int usage(const char* argv0)
+    {
+        std::fprintf(stderr, "usage: %s [--quick] [--n N] [--threads T]   (N >= 1)\n", argv0);
+        return 2;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    Config cfg;
+    bool   quick   = false;
+    bool   n_given = false;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        if (std::strcmp(argv[i], "--quick") == 0)
+        {
+            quick = true;
+        }
+        else if (std::strcmp(argv[i], "--n") == 0 && i + 1 < argc)
+        {
+            cfg.n   = static_cast<std::size_t>(std::strtoull(argv[++i], nullptr, 10));
+            n_given = true;
+            if (cfg.n == 0)
+            {
+                return usage(argv[0]);   // every benchmark divides by n
+            }
+        }
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+        {
+            cfg.threads = static_cast<std::size_t>(std::strtoull(argv[++i], nullptr, 10));
+        }
+        else
+        {
+            return usage(argv[0]);
+        }
+    }
+
+    // --quick shortens the run but leaves an explicit --n alone.
+    if (quick)
+    {
+        cfg.reps = 3;
+        if (!n_given) cfg.n = 1 << 12;
+    }
+
+    if (std::strcmp(ECT_BENCH_BUILD_TYPE, "Release") != 0 && std::strcmp(ECT_BENCH_BUILD_TYPE, "RelWithDebInfo") != 0)
+    {
+        std::fprintf(stderr, "ect_bench: warning: build type '%s' is not optimised\n", ECT_BENCH_BUILD_TYPE);
+    }
+
+    // ---- Operator mixes -----------------------------------------------------
+    LinearFOperator    lin_f;
+    LinearEOperator    lin_e(0.8);
+    LinearFInvOperator lin_finv;
+    LinearGOperator    lin_g(1.0, -1.0, 1.0);
+
+    TanhFOperator             nl_f(2.0);
+    SaturatingEOperator       nl_e(0.8, 4.0);
+    AtanhFInvOperator         nl_finv(2.0);
+    SmoothSaturationGOperator nl_g(1.0, -1.0, 1.0);
+
+    TableSpec spec;
+    spec.lo            = -50.0;
+    spec.hi            =  50.0;
+    spec.points        = 4097;
+    spec.interpolation = Interpolation::Cubic;
+    TabulatedEOperator tab_e(nl_e, spec);
+
+    Controller linear(lin_f, lin_e, lin_finv, lin_g);
+    Controller nonlinear(nl_f, nl_e, nl_finv, nl_g);
+    Controller tabulated(lin_f, tab_e, lin_finv, lin_g);
+
+    const StaticLinearController static_linear = make_static_linear_controller(0.8, 1.0, -1.0, 1.0);
+
+    PlanOptions reassociate;
+    reassociate.allow_reassociation = true;
+    const ExecutionPlan exact_plan = linear.plan();
+    const ExecutionPlan fused_plan = linear.plan(reassociate);
+
+    ControllerBank bank(std::vector<double>(cfg.n, 0.8),
+                        std::vector<double>(cfg.n, 1.0),
+                        std::vector<double>(cfg.n, -1.0),
+                        std::vector<double>(cfg.n, 1.0));
+
+    ThreadPoolOptions pool_options;
+    pool_options.threads = cfg.threads;
+    ThreadPool pool(pool_options);
+
+    // One chunk per worker, so the pooled row really runs on the threads
+    // it reports (the bank's default grain would leave small n on one).
+    const std::size_t bank_grain  = std::max<std::size_t>(1, (cfg.n + pool.size() - 1) / pool.size());
+    const std::size_t bank_chunks = (cfg.n + bank_grain - 1) / bank_grain;
+
+    std::vector<double> out(cfg.n);
+    std::vector<Result> results;
+
+    for (int saturated = 0; saturated <= 1; ++saturated)
+    {
+        const std::vector<double> in   = make_inputs(cfg.n, saturated != 0);
+        const std::string         kind = saturated ? "saturated" : "unsaturated";
+
+        const auto scalar_loop = [&](const Controller& c) {
+            return [&]() {
+                double acc = 0.0;
+                for (double d : in) acc += c.update(d);
+                g_sink = acc;
+            };
+        };
+
+        results.push_back(measure(cfg, "controller.update", "linear", kind, 1, scalar_loop(linear)));
+        results.push_back(measure(cfg, "controller.update", "nonlinear", kind, 1, scalar_loop(nonlinear)));
+        results.push_back(measure(cfg, "controller.update", "tabulated", kind, 1, scalar_loop(tabulated)));
+
+        results.push_back(measure(cfg, "static_controller.update", "linear", kind, 1, [&]() {
+            double acc = 0.0;
+            for (double d : in) acc += static_linear.update(d);
+            g_sink = acc;
+        }));
+
+        const auto batch = [&](const Controller& c) {
+            return [&]() {
+                c.update_batch(in.data(), out.data(), in.size());
+                g_sink = out[0];
+            };
+        };
+
+        results.push_back(measure(cfg, "controller.update_batch", "linear", kind, 1, batch(linear)));
+        results.push_back(measure(cfg, "controller.update_batch", "nonlinear", kind, 1, batch(nonlinear)));
+        results.push_back(measure(cfg, "controller.update_batch", "tabulated", kind, 1, batch(tabulated)));
+
+        results.push_back(measure(cfg, "plan.evaluate_batch.exact", "linear", kind, 1, [&]() {
+            exact_plan.evaluate_batch(in.data(), out.data(), in.size());
+            g_sink = out[0];
+        }));
+        results.push_back(measure(cfg, "plan.evaluate_batch.reassociated", "linear", kind, 1, [&]() {
+            fused_plan.evaluate_batch(in.data(), out.data(), in.size());
+            g_sink = out[0];
+        }));
+
+        results.push_back(measure(cfg, "controller_bank.evaluate", "linear", kind, 1, [&]() {
+            bank.evaluate(in.data(), out.data());
+            g_sink = out[0];
+        }));
+        results.push_back(measure(cfg, "controller_bank.evaluate", "linear", kind, bank_chunks, [&]() {
+            bank.evaluate(in.data(), out.data(), pool, bank_grain);
+            g_sink = out[0];
+        }));
+    }
+
+    print_json(results);
+    return 0;
+}
@@ -45,15 +45,16 @@ int main()
         const double noise       = deterministic_noise(k);
         const double delta_noisy = delta_true + noise;
 
-        const double u = controller.update(delta_noisy);
+        const GEvaluation r = controller.evaluate(delta_noisy);
+        const double      u = r.u;
 
         // Plant update (external)
         pos += u;
 
         const char* sat =
-            (u <= UMIN) ? "SAT_MIN" :
-            (u >= UMAX) ? "SAT_MAX" :
-                          "FREE";
+            (r.state == ClampState::SatMin) ? "SAT_MIN" :
+            (r.state == ClampState::SatMax) ? "SAT_MAX" :
+                                              "FREE";
 
         std::cout
             << "Step " << std::setw(3) << k
@@ -34,16 +34,17 @@ int main()
     for (int k = 0; k < 120; ++k)
     {
         const double delta = target - pos;
-        const double u = controller.update(delta);
+        const GEvaluation r = controller.evaluate(delta);
+        const double      u = r.u;
 
         // Plant update (external to controller)
         pos += u;
 
-        // Helper flag to make saturation obvious in log
+        // Clamp classification straight from the G stage
         const char* sat =
-            (u <= UMIN) ? "SAT_MIN" :
-            (u >= UMAX) ? "SAT_MAX" :
-                          "FREE";
+            (r.state == ClampState::SatMin) ? "SAT_MIN" :
+            (r.state == ClampState::SatMax) ? "SAT_MAX" :
+                                              "FREE";
 
         std::cout
             << "Step " << std::setw(3) << k
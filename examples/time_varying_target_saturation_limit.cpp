@@ -45,15 +45,16 @@ const double UMAX =  0.1;
         const double target = base + ramp_rate * k + A * std::sin(w * k);
 
         const double delta = target - pos;
-        const double u = controller.update(delta);
+        const GEvaluation r = controller.evaluate(delta);
+        const double      u = r.u;
 
         // Plant update (external)
         pos += u;
 
         const char* sat =
-            (u <= UMIN) ? "SAT_MIN" :
-            (u >= UMAX) ? "SAT_MAX" :
-                          "FREE";
+            (r.state == ClampState::SatMin) ? "SAT_MIN" :
+            (r.state == ClampState::SatMax) ? "SAT_MAX" :
+                                              "FREE";
 
         std::cout
             << "Step " << std::setw(3) << k
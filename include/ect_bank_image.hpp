@@ -0,0 +1,198 @@
+#ifndef ECT_SDK_BANK_IMAGE_HPP
+#define ECT_SDK_BANK_IMAGE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ect_inline_controller.hpp"
+
+namespace ect::sdk
+{
+    class ThreadPool;
+
+    namespace detail
+    {
+        class MappedFile;
+    }
+
+    // -------------------------------------------------------------------------
+    // Bank configuration
+    //
+    // Text description of a controller bank, one group of identical
+    // controllers per line:
+    //
+    //   # comment
+    //   group count=250000 e=linear:0.8 g=linear:1.2,-1,1
+    //   group count=1000 f=tanh:2 e=saturating:0.7,0.9 finv=atanh:2 g=smooth:1,-1,1
+    //
+    // Stage specifications use the ect_verify syntax, NAME[:P1,P2,...]:
+    //
+    //   f     linear | tanh:S | asinh:S | sigmoid:S
+    //   e     linear:K | saturating:A,L | power:A,P,L
+    //   finv  linear | atanh:S | sinh:S | sigmoid:S
+    //   g     linear:K,MIN,MAX | smooth:K,MIN,MAX
+    //
+    // Omitted keys default to the ect_verify defaults (linear stages, E gain
+    // 0.8, G gain 1 with bounds [-1, 1]); count defaults to 1.
+    // Controllers are numbered in file order.
+    // -------------------------------------------------------------------------
+
+    enum class FKind : std::uint8_t
+    {
+        Linear = 0,
+        Tanh,
+        Asinh,
+        Sigmoid
+    };
+
+    enum class EKind : std::uint8_t
+    {
+        Linear = 0,
+        Saturating,
+        Power
+    };
+
+    enum class FInvKind : std::uint8_t
+    {
+        Linear = 0,
+        Atanh,
+        Sinh,
+        Sigmoid
+    };
+
+    enum class GKind : std::uint8_t
+    {
+        Linear = 0,
+        SmoothSaturation
+    };
+
+    struct BankGroup
+    {
+        std::uint64_t count = 1;
+
+        FKind  f       = FKind::Linear;
+        double f_scale = 1.0;
+
+        // Linear: { gain }, Saturating: { alpha, limit },
+        // Power: { alpha, exponent, limit }.
+        EKind  e           = EKind::Linear;
+        double e_params[3] = { 0.8, 0.0, 0.0 };
+
+        FInvKind finv       = FInvKind::Linear;
+        double   finv_scale = 1.0;
+
+        GKind  g      = GKind::Linear;
+        double g_gain = 1.0;
+        double g_min  = -1.0;
+        double g_max  = 1.0;
+    };
+
+    // Throws std::invalid_argument if a parameter violates the contract of
+    // its operator (same checks as the operator constructors, plus
+    // u_min <= u_max for a linear G).
+    InlineController make_controller(const BankGroup& group);
+
+    struct BankConfig
+    {
+        std::vector<BankGroup> groups;
+
+        // Total number of controllers.
+        std::size_t size() const;
+    };
+
+    // Throws std::runtime_error naming the line for syntax errors, unknown
+    // operators and contract violations.
+    BankConfig parse_bank_config(std::istream& in);
+    BankConfig load_bank_config(const std::string& path);
+
+    // -------------------------------------------------------------------------
+    // Bank image
+    //
+    // Flat binary form of a BankConfig, used by the runtime as-is:
+    //
+    //   offset  size  field
+    //   0       8     magic "ECTBANK\0"
+    //   8       4     format version (BANK_IMAGE_VERSION)
+    //   12      4     reserved (0)
+    //   16      8     group count
+    //   24      8     controller count
+    //   32      8     byte offset of the group table
+    //   40      24    reserved (0)
+    //
+    // The group table holds one 88-byte record per group: first controller
+    // index and count (uint64), the four stage kinds (uint8) and 4 reserved
+    // bytes, then f_scale, e_params[3], finv_scale, g_gain, g_min, g_max
+    // (double). Native (little-endian) byte order.
+    // -------------------------------------------------------------------------
+
+    inline constexpr std::uint32_t BANK_IMAGE_VERSION = 1;
+
+    // Throws std::invalid_argument for an invalid group and
+    // std::runtime_error on I/O failure.
+    void write_bank_image(const BankConfig& config, const std::string& path);
+
+    // -------------------------------------------------------------------------
+    // BankImage
+    //
+    // Read-only mapping of a bank image. Loading validates the header and
+    // every group record once; no per-controller state is built, so load
+    // time is proportional to the number of groups, not controllers.
+    // evaluate() runs each group as one batch over its slice, bit-identical
+    // to InlineController::update() of every controller.
+    // Throws std::runtime_error if the file cannot be mapped or is not a
+    // well-formed image.
+    // -------------------------------------------------------------------------
+
+    class BankImage
+    {
+    public:
+        // Controllers evaluated per parallel task.
+        static constexpr std::size_t DEFAULT_GRAIN = 4096;
+
+        explicit BankImage(const std::string& path);
+        ~BankImage();
+
+        BankImage(BankImage&&) noexcept;
+        BankImage& operator=(BankImage&&) noexcept;
+
+        std::size_t size()   const;
+        std::size_t groups() const;
+
+        // Throws std::out_of_range.
+        BankGroup   group(std::size_t index)       const;
+        std::size_t group_begin(std::size_t index) const;
+
+        // Controller of entity i. Throws std::out_of_range.
+        InlineController controller(std::size_t index) const;
+
+        // out[i] = u of controller i for deviation deltas[i]; size() elements.
+        void evaluate(const double* deltas, double* out) const;
+
+        // Same result, split across the pool in chunks of `grain` controllers.
+        void evaluate(
+            const double* deltas,
+            double*       out,
+            ThreadPool&   pool,
+            std::size_t   grain = DEFAULT_GRAIN
+        ) const;
+
+        // Evaluates controllers [begin, end) only.
+        void evaluate_range(const double* deltas, double* out, std::size_t begin, std::size_t end) const;
+
+    private:
+        // Index of the group containing controller i.
+        std::size_t find_group(std::size_t i) const;
+
+        std::unique_ptr<detail::MappedFile> file_;
+        const unsigned char*                table_  = nullptr;
+        std::size_t                         groups_ = 0;
+        std::size_t                         size_   = 0;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_BANK_IMAGE_HPP
@@ -0,0 +1,212 @@
+#ifndef ECT_SDK_BASIC_CONTROLLER_HPP
+#define ECT_SDK_BASIC_CONTROLLER_HPP
+
+#include <cstddef>
+
+#include "ect_fixed_point.hpp"
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // Scalar-type generic pipeline (Design Document §3.1)
+    //
+    // BasicFOperator<T> ... BasicController<T> mirror FOperator ... Controller
+    // for an arbitrary numeric type T: float, double or Fixed<I, F>. T must
+    // be copyable, support +, -, * and ordering, and be explicitly
+    // constructible from double (for parameters).
+    //
+    // The double-precision Controller and its operators remain the primary
+    // API (batch kernels, plans and the nonlinear library build on them);
+    // BasicController<double> with the BasicLinear* operators produces the
+    // same bits as Controller with the Linear* operators.
+    // -------------------------------------------------------------------------
+
+    template <typename T>
+    class BasicFOperator
+    {
+    public:
+        virtual ~BasicFOperator() = default;
+        virtual T apply(T delta) const = 0;
+    };
+
+    template <typename T>
+    class BasicEOperator
+    {
+    public:
+        virtual ~BasicEOperator() = default;
+        virtual T apply(T x) const = 0;
+    };
+
+    template <typename T>
+    class BasicFInvOperator
+    {
+    public:
+        virtual ~BasicFInvOperator() = default;
+        virtual T apply(T x) const = 0;
+    };
+
+    template <typename T>
+    class BasicGOperator
+    {
+    public:
+        virtual ~BasicGOperator() = default;
+        virtual T apply(T delta) const = 0;
+    };
+
+    // ---- Linear implementations ---------------------------------------------
+
+    template <typename T>
+    class BasicLinearFOperator final : public BasicFOperator<T>
+    {
+    public:
+        T apply(T delta) const override
+        {
+            return delta; // kF = 1.0
+        }
+    };
+
+    template <typename T>
+    class BasicLinearEOperator final : public BasicEOperator<T>
+    {
+    public:
+        explicit BasicLinearEOperator(T gain)
+            : k_(gain)
+        {
+        }
+
+        T apply(T x) const override
+        {
+            return k_ * x; // alpha * x
+        }
+
+        T gain() const { return k_; }
+
+    private:
+        T k_;
+    };
+
+    template <typename T>
+    class BasicLinearFInvOperator final : public BasicFInvOperator<T>
+    {
+    public:
+        T apply(T x) const override
+        {
+            return x; // kF = 1.0 → x / kF
+        }
+    };
+
+    template <typename T>
+    class BasicLinearGOperator final : public BasicGOperator<T>
+    {
+    public:
+        BasicLinearGOperator(T gain, T u_min, T u_max)
+            : k_(gain), u_min_(u_min), u_max_(u_max)
+        {
+        }
+
+        T apply(T delta) const override
+        {
+            return clamp(k_ * delta);
+        }
+
+        T clamp(T u) const
+        {
+            if (u < u_min_) return u_min_;
+            if (u > u_max_) return u_max_;
+            return u;
+        }
+
+        T gain()  const { return k_; }
+        T u_min() const { return u_min_; }
+        T u_max() const { return u_max_; }
+
+    private:
+        T k_;
+        T u_min_;
+        T u_max_;
+    };
+
+    // ---- Controller ---------------------------------------------------------
+
+    template <typename T>
+    class BasicController
+    {
+    public:
+        using value_type = T;
+
+        BasicController(
+            const BasicFOperator<T>&    f,
+            const BasicEOperator<T>&    e,
+            const BasicFInvOperator<T>& finv,
+            const BasicGOperator<T>&    g
+        )
+        : f_(f)
+        , e_(e)
+        , finv_(finv)
+        , g_(g)
+        , linear_e_(dynamic_cast<const BasicLinearEOperator<T>*>(&e))
+        , linear_g_(dynamic_cast<const BasicLinearGOperator<T>*>(&g))
+        {
+            const bool identity =
+                   dynamic_cast<const BasicLinearFOperator<T>*>(&f)       != nullptr
+                && dynamic_cast<const BasicLinearFInvOperator<T>*>(&finv) != nullptr;
+
+            if (!identity || linear_e_ == nullptr || linear_g_ == nullptr)
+            {
+                linear_e_ = nullptr;
+                linear_g_ = nullptr;
+            }
+        }
+
+        T update(T delta) const
+        {
+            const T x_f    = f_.apply(delta);
+            const T x_e    = e_.apply(x_f);
+            const T x_finv = finv_.apply(x_e);
+            return g_.apply(x_finv);
+        }
+
+        // out[i] == update(deltas[i]). With the BasicLinear* operators the
+        // loop body is fully inlined (and vectorizable for float/double).
+        void update_batch(const T* deltas, T* out, std::size_t n) const
+        {
+            if (linear_e_ != nullptr)
+            {
+                const T ke    = linear_e_->gain();
+                const T kg    = linear_g_->gain();
+                const T u_min = linear_g_->u_min();
+                const T u_max = linear_g_->u_max();
+
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const T u = kg * (ke * deltas[i]);
+                    out[i] = u < u_min ? u_min : (u > u_max ? u_max : u);
+                }
+                return;
+            }
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = update(deltas[i]);
+            }
+        }
+
+    private:
+        const BasicFOperator<T>&    f_;
+        const BasicEOperator<T>&    e_;
+        const BasicFInvOperator<T>& finv_;
+        const BasicGOperator<T>&    g_;
+
+        const BasicLinearEOperator<T>* linear_e_;
+        const BasicLinearGOperator<T>* linear_g_;
+    };
+
+    // ---- Convenience aliases ------------------------------------------------
+
+    using ControllerF32 = BasicController<float>;
+    using ControllerF64 = BasicController<double>;
+    using ControllerQ15_16 = BasicController<Q15_16>;
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_BASIC_CONTROLLER_HPP
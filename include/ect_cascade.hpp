@@ -0,0 +1,190 @@
+#ifndef ECT_SDK_CASCADE_HPP
+#define ECT_SDK_CASCADE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ect_inline_controller.hpp"
+#include "ect_instrumentation.hpp"
+
+namespace ect::sdk
+{
+    class ThreadPool;
+
+    // -------------------------------------------------------------------------
+    // Cascaded controllers
+    //
+    // A cascade is a DAG of controllers (nodes) fed by external inputs
+    // (measurements, setpoints). The deviation of each node is an affine
+    // mapping of graph inputs and upstream node outputs:
+    //
+    //   delta[node] = w_0 * source_0 + w_1 * source_1 + ... (+ bias)
+    //
+    // summed in the order the links were declared; the bias is added last
+    // and only when non-zero. An outer position loop driving an inner
+    // velocity loop is
+    //
+    //   builder.connect_input(POSITION_ERROR, outer);
+    //   builder.connect(outer, inner);                 // velocity setpoint
+    //   builder.connect_input(VELOCITY, inner, -1.0);  // minus measurement
+    //
+    // which reproduces inner.update(outer.update(e) - v) bit for bit.
+    // -------------------------------------------------------------------------
+
+    class Cascade;
+
+    class CascadeBuilder
+    {
+    public:
+        explicit CascadeBuilder(std::size_t inputs);
+
+        std::size_t inputs() const;
+        std::size_t nodes()  const;
+
+        // Returns the id of the new node; ids count up from 0.
+        std::size_t add_node(const InlineController& controller, double bias = 0.0);
+
+        // delta[node] += weight * inputs[input].
+        // Throws std::out_of_range for unknown ids.
+        void connect_input(std::size_t input, std::size_t node, double weight = 1.0);
+
+        // delta[to] += weight * u[from]. Throws std::out_of_range for
+        // unknown ids and std::invalid_argument for a self-loop.
+        void connect(std::size_t from, std::size_t to, double weight = 1.0);
+
+        // Topologically schedules the graph (ties broken by node id).
+        // Throws std::invalid_argument if the graph has a cycle.
+        Cascade compile() const;
+
+    private:
+        struct Link
+        {
+            bool        from_node;
+            std::size_t from;
+            std::size_t to;
+            double      weight;
+        };
+
+        std::size_t                   inputs_;
+        std::vector<InlineController> controllers_;
+        std::vector<double>           bias_;
+        std::vector<Link>             links_;
+    };
+
+    // -------------------------------------------------------------------------
+    // CascadeProfile
+    //
+    // Per-node latency histograms filled by the profiled Cascade::evaluate
+    // overloads. Each call records one sample per node: the time spent
+    // forming its deviation and running its controller (for a batch, over
+    // one block of instances). Single writer, like Histogram.
+    // -------------------------------------------------------------------------
+
+    class CascadeProfile
+    {
+    public:
+        explicit CascadeProfile(std::size_t nodes);
+
+        std::size_t nodes() const;
+
+        const instrumentation::Histogram& node(std::size_t id) const;
+        instrumentation::Summary          summary(std::size_t id) const;
+
+        void reset();
+
+    private:
+        friend class Cascade;
+
+        std::size_t                                   nodes_;
+        std::unique_ptr<instrumentation::Histogram[]> histograms_;
+    };
+
+    // -------------------------------------------------------------------------
+    // Cascade
+    //
+    // Compiled, immutable schedule of a CascadeBuilder. One tick evaluates
+    // every node in topological order in a single pass; node outputs are
+    // written to outputs[id] and read back by downstream nodes.
+    //
+    // The batch form runs n independent instances of the same graph in
+    // structure-of-arrays layout:
+    //
+    //   inputs [input * n + k]   input of instance k
+    //   outputs[node  * n + k]   output of instance k
+    //
+    // Instances are processed in blocks of BLOCK; within a block all nodes
+    // run back to back, so every column a node reads is still in cache.
+    // Results are bit-identical to evaluate() per instance and do not depend
+    // on the thread count.
+    // -------------------------------------------------------------------------
+
+    class Cascade
+    {
+    public:
+        // Instances per fused block (and the default parallel grain).
+        static constexpr std::size_t BLOCK = 256;
+
+        std::size_t inputs() const;
+        std::size_t nodes()  const;
+
+        // Node ids in evaluation order.
+        const std::vector<std::size_t>& order() const;
+
+        // inputs: inputs() values, outputs: nodes() values.
+        void evaluate(const double* inputs, double* outputs) const;
+        void evaluate(const double* inputs, double* outputs, CascadeProfile& profile) const;
+
+        void evaluate_batch(const double* inputs, double* outputs, std::size_t n) const;
+        void evaluate_batch(const double* inputs, double* outputs, std::size_t n, CascadeProfile& profile) const;
+
+        // Blocks split across the pool in chunks of `grain` instances
+        // (rounded up to a multiple of BLOCK).
+        void evaluate_batch(
+            const double* inputs,
+            double*       outputs,
+            std::size_t   n,
+            ThreadPool&   pool,
+            std::size_t   grain = 16 * BLOCK
+        ) const;
+
+    private:
+        friend class CascadeBuilder;
+
+        struct Term
+        {
+            bool        from_node;
+            std::size_t source;
+            double      weight;
+        };
+
+        struct Step
+        {
+            std::size_t      node;
+            std::size_t      first_term;
+            std::size_t      term_count;
+            double           bias;
+            InlineController controller;
+        };
+
+        Cascade() = default;
+
+        void evaluate_block(
+            const double*   inputs,
+            double*         outputs,
+            std::size_t     n,
+            std::size_t     begin,
+            std::size_t     end,
+            CascadeProfile* profile
+        ) const;
+
+        std::size_t              inputs_ = 0;
+        std::vector<Step>        steps_;
+        std::vector<Term>        terms_;
+        std::vector<std::size_t> order_;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_CASCADE_HPP
@@ -0,0 +1,161 @@
+#ifndef ECT_SDK_CONTRACT_VERIFIER_HPP
+#define ECT_SDK_CONTRACT_VERIFIER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "ect_f_operator.hpp"
+#include "ect_e_operator.hpp"
+#include "ect_finv_operator.hpp"
+#include "ect_g_operator.hpp"
+
+namespace ect::sdk
+{
+    class ThreadPool;
+
+    // -------------------------------------------------------------------------
+    // Operator contract verifier
+    //
+    // Sweeps an F / E / F⁻¹ / G set over a large deterministic sample space
+    // and checks the invariants of the Operator Formalization:
+    //
+    //   all   determinism: apply() and apply_batch() return the same bits
+    //   F     monotonic (§3.3), continuous at the origin (§3.4)
+    //   E     non-expansive (§4.3), strictly contracting near the origin
+    //         (§4.4, normal inputs only), sign preserving (§4.5)
+    //   F⁻¹   monotonic (§5.4), no amplification near zero (§5.5),
+    //         F⁻¹∘F preserves sign and ordering (§5.3)
+    //   G     finite and within [u_min, u_max] (§6.3), monotonic (§6.4),
+    //         sign preserving (§6.5)
+    //   G∘F⁻¹∘E∘F  monotonic in Δ (§7.6); E alone need not be
+    //
+    // Monotonicity and ordering are checked on consecutive samples and on
+    // each sample against its next representable double. The sample space
+    // is the concatenation of a uniform grid, log-spaced magnitudes from
+    // the smallest subnormal to 1e308 (both signs), an edge-case list
+    // (signed zeros, all powers of two and their neighbours, subnormal /
+    // normal boundaries, G bounds, extra_points) and random samples.
+    //
+    // The report is independent of the thread count and chunking. For each
+    // violated check it holds the counterexample of smallest magnitude;
+    // pairwise violations are then shrunk by bisection to adjacent doubles
+    // where possible.
+    // -------------------------------------------------------------------------
+
+    enum class Check : std::size_t
+    {
+        FDeterministic = 0,
+        FMonotonic,
+        FOriginContinuity,
+        EDeterministic,
+        ENonExpansive,
+        EStrictContraction,
+        ESignPreserving,
+        FInvDeterministic,
+        FInvMonotonic,
+        FInvOriginAmplification,
+        FInvConsistency,
+        GDeterministic,
+        GBounded,
+        GMonotonic,
+        GSignPreserving,
+        CompositeMonotonic
+    };
+
+    inline constexpr std::size_t CHECK_COUNT = 16;
+
+    const char* check_name(Check check);
+
+    struct VerifierOptions
+    {
+        // Uniform grid over [-range, range].
+        std::size_t grid_points = std::size_t(1) << 20;
+        double      range       = 1e3;
+
+        // Log-spaced magnitudes per decade (0 disables the sweep).
+        std::size_t points_per_decade = 64;
+
+        // Random samples; even indices are random finite bit patterns,
+        // odd indices are uniform over [-range, range].
+        std::uint64_t random_samples = std::uint64_t(1) << 22;
+        std::uint64_t seed           = 0x5EED;
+
+        bool                include_infinities = false;
+        std::vector<double> extra_points;
+
+        // When true each stage is checked on the outputs of the stages
+        // before it (its operating range); otherwise every stage is checked
+        // on the raw samples.
+        bool propagate = true;
+
+        // Origin checks apply to |x| <= origin_radius and require
+        // |op(x) - op(0)| <= origin_gain * |x|.
+        double origin_radius = 1e-3;
+        double origin_gain   = 1e3;
+
+        // Output bounds for G. When both are infinite they are taken from
+        // G's AffineForm if it reports one; otherwise only finiteness is
+        // checked.
+        double g_lower = -std::numeric_limits<double>::infinity();
+        double g_upper =  std::numeric_limits<double>::infinity();
+
+        // Samples per parallel task.
+        std::size_t grain = 4096;
+    };
+
+    // For pairwise checks (monotonicity, ordering) input < partner; for
+    // determinism checks output is apply() and partner_output apply_batch().
+    struct Counterexample
+    {
+        double input          = 0.0;
+        double output         = 0.0;
+        double partner        = std::numeric_limits<double>::quiet_NaN(); // pairwise checks only
+        double partner_output = std::numeric_limits<double>::quiet_NaN();
+    };
+
+    struct CheckResult
+    {
+        std::uint64_t  evaluated          = 0;
+        std::uint64_t  violations         = 0;
+        bool           has_counterexample = false;
+        Counterexample counterexample;
+    };
+
+    struct VerificationReport
+    {
+        std::uint64_t samples = 0;
+        double        g_lower = 0.0;
+        double        g_upper = 0.0;
+
+        std::array<CheckResult, CHECK_COUNT> checks{};
+
+        const CheckResult& operator[](Check c) const { return checks[static_cast<std::size_t>(c)]; }
+
+        bool passed() const;
+    };
+
+    // Throws std::invalid_argument if range <= 0, origin_radius < 0,
+    // g_lower > g_upper or grain == 0.
+    VerificationReport verify_contracts(
+        const FOperator&       f,
+        const EOperator&       e,
+        const FInvOperator&    finv,
+        const GOperator&       g,
+        const VerifierOptions& options = VerifierOptions{}
+    );
+
+    VerificationReport verify_contracts(
+        const FOperator&       f,
+        const EOperator&       e,
+        const FInvOperator&    finv,
+        const GOperator&       g,
+        const VerifierOptions& options,
+        ThreadPool&            pool
+    );
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_CONTRACT_VERIFIER_HPP
@@ -0,0 +1,97 @@
+#ifndef ECT_SDK_CONTROLLER_BANK_HPP
+#define ECT_SDK_CONTROLLER_BANK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ect::sdk
+{
+    class ThreadPool;
+
+    // -------------------------------------------------------------------------
+    // ControllerBank
+    //
+    // Column store for many independent linear ECT loops. Entity i behaves
+    // exactly like
+    //
+    //   Controller(LinearFOperator, LinearEOperator(alpha[i]),
+    //              LinearFInvOperator, LinearGOperator(gain[i], u_min[i], u_max[i]))
+    //
+    // but parameters live in four contiguous columns and a whole tick is
+    // evaluated as one structure-of-arrays pass. Outputs are bit-identical to
+    // the per-entity Controller and do not depend on the thread count.
+    // -------------------------------------------------------------------------
+
+    class ControllerBank
+    {
+    public:
+        // Elements evaluated per parallel task.
+        static constexpr std::size_t DEFAULT_GRAIN = 4096;
+
+        // All entities start with alpha = 1, gain = 1 and bounds [-1, 1].
+        explicit ControllerBank(std::size_t size);
+
+        // Throws std::invalid_argument if the columns differ in length or
+        // u_min[i] > u_max[i] for any entity.
+        ControllerBank(
+            std::vector<double> alpha,
+            std::vector<double> gain,
+            std::vector<double> u_min,
+            std::vector<double> u_max
+        );
+
+        std::size_t size() const;
+
+        // Throws std::out_of_range / std::invalid_argument on bad input.
+        void set(std::size_t index, double alpha, double gain, double u_min, double u_max);
+
+        const double* alpha() const;
+        const double* gain()  const;
+        const double* u_min() const;
+        const double* u_max() const;
+
+        // out[i] = u of entity i for deviation deltas[i]; size() elements.
+        void evaluate(const double* deltas, double* out) const;
+
+        // Same result, split across the pool in chunks of `grain` entities.
+        void evaluate(
+            const double* deltas,
+            double*       out,
+            ThreadPool&   pool,
+            std::size_t   grain = DEFAULT_GRAIN
+        ) const;
+
+        // Evaluates entities [begin, end) only.
+        void evaluate_range(const double* deltas, double* out, std::size_t begin, std::size_t end) const;
+
+        // Same outputs, plus state[i] = ClampState of entity i (see
+        // GOperator::evaluate), computed in the same pass.
+        void evaluate(const double* deltas, double* out, std::int8_t* state) const;
+
+        void evaluate(
+            const double* deltas,
+            double*       out,
+            std::int8_t*  state,
+            ThreadPool&   pool,
+            std::size_t   grain = DEFAULT_GRAIN
+        ) const;
+
+        void evaluate_range(
+            const double* deltas,
+            double*       out,
+            std::int8_t*  state,
+            std::size_t   begin,
+            std::size_t   end
+        ) const;
+
+    private:
+        std::vector<double> alpha_;
+        std::vector<double> gain_;
+        std::vector<double> u_min_;
+        std::vector<double> u_max_;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_CONTROLLER_BANK_HPP
@@ -0,0 +1,56 @@
+#ifndef ECT_SDK_CPU_HPP
+#define ECT_SDK_CPU_HPP
+
+namespace ect::sdk::cpu
+{
+    // -------------------------------------------------------------------------
+    // Instruction-set selection for the batch kernels
+    //
+    // The SIMD batch paths (linear pipelines and clamps, ControllerBank,
+    // VectorController, the nonlinear operators' apply_batch, fast_math
+    // batch functions, InlineController) exist in one variant per
+    // instruction set. The widest one the CPU supports is selected on first
+    // use; the environment variable ECT_SDK_ISA (scalar, sse2, avx2,
+    // avx512) overrides that choice when it names a supported variant.
+    //
+    // All variants produce bit-identical results, so switching only changes
+    // speed. SSE4.x hosts run the SSE2 variant: none of the kernels has an
+    // SSE4 instruction worth a separate build.
+    //
+    // On non-x86 targets, and when the library is built without
+    // ECT_SDK_ENABLE_DISPATCH, only the variants the compiler flags already
+    // allow are available.
+    // -------------------------------------------------------------------------
+
+    enum class Isa
+    {
+        Scalar,
+        Sse2,
+        Avx2,
+        Avx512   // AVX-512F
+    };
+
+    // "scalar", "sse2", "avx2", "avx512".
+    const char* isa_name(Isa isa);
+
+    // Built into this binary and usable on this CPU (and OS).
+    bool supported(Isa isa);
+
+    // Widest supported variant.
+    Isa detected();
+
+    // Variant the batch kernels currently run.
+    Isa active();
+
+    // Switches every batch kernel to `isa`, e.g. to reproduce a result from
+    // a narrower host or to compare variants. Safe to call while other
+    // threads evaluate; each batch call runs entirely on one variant.
+    // Throws std::invalid_argument if `isa` is not supported.
+    void force(Isa isa);
+
+    // Back to the start-up choice (ECT_SDK_ISA, else detected()).
+    void reset();
+
+} // namespace ect::sdk::cpu
+
+#endif // ECT_SDK_CPU_HPP
@@ -0,0 +1,168 @@
+#ifndef ECT_SDK_EXECUTOR_HPP
+#define ECT_SDK_EXECUTOR_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ect_instrumentation.hpp"
+
+namespace ect::sdk
+{
+    class Controller;
+    class ControllerBank;
+
+    struct ExecutorOptions
+    {
+        // Run rate threads under SCHED_FIFO. The fastest rate gets
+        // base_priority, each slower rate one less (rate-monotonic), never
+        // below the minimum FIFO priority. Without the privilege (EPERM) the
+        // threads stay on the default policy and status().realtime is false.
+        bool realtime      = false;
+        int  base_priority = 80;
+
+        // Pin the thread of the k-th fastest rate to cpus[k % cpus.size()]
+        // (or CPU k when cpus is empty). Failures are reported, not fatal.
+        bool             pin_threads = false;
+        std::vector<int> cpus;
+
+        // mlockall(MCL_CURRENT | MCL_FUTURE) on start(); failures are
+        // reported in status().memory_locked.
+        bool lock_memory = false;
+    };
+
+    // What start() actually obtained; all false off Linux.
+    struct ExecutorStatus
+    {
+        bool realtime      = false;   // every rate thread runs SCHED_FIFO
+        bool pinned        = false;   // every rate thread is pinned
+        bool memory_locked = false;
+    };
+
+    // Counters of one rate group (all tasks sharing a period).
+    //
+    //   jitter     release latency: wake-up time minus the scheduled release
+    //   execution  time from wake-up until every task of the group returned
+    //
+    // A deadline miss is a cycle that finished after the next release
+    // (implicit deadline = period). Releases that had already passed when a
+    // late cycle finished are skipped and counted, never run back to back.
+    struct RateGroupStats
+    {
+        double        rate_hz         = 0.0;
+        std::uint64_t period_ns       = 0;
+        std::size_t   tasks           = 0;
+        std::uint64_t cycles          = 0;
+        std::uint64_t deadline_misses = 0;
+        std::uint64_t skipped         = 0;
+
+        instrumentation::Summary jitter;
+        instrumentation::Summary execution;
+    };
+
+    struct TaskStats
+    {
+        std::string   name;
+        double        rate_hz = 0.0;
+        std::uint64_t runs    = 0;
+
+        instrumentation::Summary execution;
+    };
+
+    // -------------------------------------------------------------------------
+    // RateExecutor
+    //
+    // Optional fixed-rate scheduler for control loops. Tasks registered at
+    // the same rate form a group that runs on one thread, in registration
+    // order, once per period; every group sleeps to absolute release times
+    // (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME) on Linux,
+    // steady_clock::sleep_until elsewhere) from one common epoch, so rates
+    // stay phase-aligned and do not drift.
+    //
+    // Realtime policy, pinning and memory locking are requested through
+    // ExecutorOptions and degrade to plain threads when not permitted.
+    // Statistics may be read while the executor runs.
+    //
+    // Tasks are called on the group thread and must not throw.
+    // -------------------------------------------------------------------------
+
+    class RateExecutor
+    {
+    public:
+        // Argument: cycle number of the group, from 0.
+        using Task = std::function<void(std::uint64_t)>;
+
+        explicit RateExecutor(const ExecutorOptions& options = ExecutorOptions{});
+        ~RateExecutor();
+
+        RateExecutor(const RateExecutor&)            = delete;
+        RateExecutor& operator=(const RateExecutor&) = delete;
+
+        // Registers a task and returns its id. Throws std::invalid_argument
+        // unless rate_hz is finite, > 0 and at most 1 GHz, and
+        // std::logic_error once the executor has started.
+        std::size_t add_task(const std::string& name, double rate_hz, Task task);
+
+        // One update per cycle: actuate(controller.update(sense())).
+        std::size_t add_controller(
+            const std::string&            name,
+            double                        rate_hz,
+            const Controller&             controller,
+            std::function<double()>       sense,
+            std::function<void(double)>   actuate
+        );
+
+        // One bank evaluation per cycle: bank.evaluate(deltas, out). The
+        // caller owns both buffers and synchronizes access to them.
+        std::size_t add_bank(
+            const std::string&    name,
+            double                rate_hz,
+            const ControllerBank& bank,
+            const double*         deltas,
+            double*               out
+        );
+
+        // Starts one thread per rate group. Throws std::logic_error if
+        // already started or no task is registered.
+        void start();
+
+        // Stops every group after its current cycle and joins the threads.
+        // Idempotent; the destructor calls it.
+        void stop();
+
+        bool           running() const;
+        ExecutorStatus status()  const;
+
+        // Rate groups in rate-monotonic order (fastest first).
+        std::size_t    rate_groups() const;
+        RateGroupStats group_stats(std::size_t group) const;
+
+        std::size_t tasks() const;
+        TaskStats   task_stats(std::size_t id) const;
+
+    private:
+        struct TaskEntry;
+        struct Group;
+
+        void run_group(Group& group, std::int64_t epoch_ns);
+
+        ExecutorOptions                         options_;
+        std::vector<std::unique_ptr<TaskEntry>> tasks_;
+        std::vector<std::unique_ptr<Group>>     groups_;   // sorted by period
+
+        mutable std::mutex       mutex_;
+        std::vector<std::thread> threads_;
+        std::atomic<bool>        stop_{false};
+        bool                     started_ = false;
+        ExecutorStatus           status_;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_EXECUTOR_HPP
@@ -0,0 +1,53 @@
+#ifndef ECT_SDK_FAST_MATH_HPP
+#define ECT_SDK_FAST_MATH_HPP
+
+#include <cstddef>
+
+namespace ect::sdk::fast_math
+{
+    // -------------------------------------------------------------------------
+    // Fast elementary functions for the nonlinear operators.
+    //
+    // Each function has a scalar form and a batch form; the batch form uses
+    // the widest SIMD lane the build enables (SSE2 / AVX2) and returns the
+    // same bits as the scalar form for every element. Results are
+    // deterministic across calls and independent of libm.
+    //
+    // Maximum error versus the exact result, in units in the last place
+    // (ulp), over the stated domain (verified by nonlinear_operators_test):
+    //
+    //   exp    [-708, 709.78]          2 ulp   (0 below, +inf above)
+    //   expm1  [-708, 709.78]          2 ulp
+    //   log    (0, +inf)               3 ulp
+    //   log1p  [-1, +inf)              3 ulp
+    //   tanh   all finite x            4 ulp
+    //   atanh  (-1, 1)                 4 ulp
+    //   asinh  all finite x            4 ulp
+    //   sinh   |x| <= 710              4 ulp
+    //
+    // tanh, atanh, asinh and sinh are exactly odd: f(-x) == -f(x) bit for
+    // bit and sign(f(x)) == sign(x), so sign preservation never depends on
+    // rounding. |tanh(x)| <= 1 holds exactly.
+    // -------------------------------------------------------------------------
+
+    double exp(double x);
+    double expm1(double x);
+    double log(double x);
+    double log1p(double x);
+    double tanh(double x);
+    double atanh(double x);
+    double asinh(double x);
+    double sinh(double x);
+
+    // Batch forms; in and out may alias exactly.
+    void exp(const double* in, double* out, std::size_t n);
+    void expm1(const double* in, double* out, std::size_t n);
+    void log(const double* in, double* out, std::size_t n);
+    void log1p(const double* in, double* out, std::size_t n);
+    void tanh(const double* in, double* out, std::size_t n);
+    void atanh(const double* in, double* out, std::size_t n);
+    void asinh(const double* in, double* out, std::size_t n);
+    void sinh(const double* in, double* out, std::size_t n);
+}
+
+#endif // ECT_SDK_FAST_MATH_HPP
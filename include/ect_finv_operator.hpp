@@ -1,6 +1,10 @@
 #ifndef ECT_SDK_FINV_OPERATOR_HPP
 #define ECT_SDK_FINV_OPERATOR_HPP
 
+#include <cstddef>
+
+#include "ect_operator_form.hpp"
+
 namespace ect::sdk
 {
     class FInvOperator
@@ -8,12 +12,31 @@ namespace ect::sdk
     public:
         virtual ~FInvOperator() = default;
         virtual double apply(double x) const = 0;
+
+        // Evaluates apply() for n elements; in and out may alias exactly.
+        // Overrides must return the same bits as apply() for each element.
+        virtual void apply_batch(const double* in, double* out, std::size_t n) const
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = apply(in[i]);
+            }
+        }
+
+        // Optional introspection used by Controller::plan(); see AffineForm.
+        // Returns false (opaque) unless overridden.
+        virtual bool affine_form(AffineForm& form) const
+        {
+            (void)form;
+            return false;
+        }
     };
 
     class LinearFInvOperator final : public FInvOperator
     {
     public:
         double apply(double x) const override;
+        bool affine_form(AffineForm& form) const override;
     };
 }
 
@@ -0,0 +1,134 @@
+#ifndef ECT_SDK_FIXED_POINT_HPP
+#define ECT_SDK_FIXED_POINT_HPP
+
+#include <cstdint>
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // Fixed<IntBits, FracBits>
+    //
+    // Signed Qm.n fixed-point value stored in 32 bits: IntBits integer bits,
+    // FracBits fraction bits and one sign bit. All arithmetic saturates at
+    // the representable range instead of wrapping, multiplication and
+    // conversion from double round to nearest with ties toward +inf (2.5 ->
+    // 3, -2.5 -> -2, in units of the resolution), and conversion saturates
+    // (NaN converts to 0). Intended for FPU-less targets; no floating point
+    // is used by the arithmetic operators.
+    // -------------------------------------------------------------------------
+
+    template <int IntBits, int FracBits>
+    class Fixed
+    {
+        static_assert(IntBits >= 0 && FracBits >= 0, "Fixed: bit counts must be non-negative");
+        static_assert(IntBits + FracBits <= 31, "Fixed: at most 31 magnitude bits fit in 32-bit storage");
+
+    public:
+        using raw_type = std::int32_t;
+
+        static constexpr int integer_bits  = IntBits;
+        static constexpr int fraction_bits = FracBits;
+
+        static constexpr raw_type raw_max = static_cast<raw_type>((std::int64_t(1) << (IntBits + FracBits)) - 1);
+        static constexpr raw_type raw_min = static_cast<raw_type>(-std::int64_t(raw_max) - 1);
+
+        constexpr Fixed() = default;
+
+        constexpr explicit Fixed(double value)
+            : raw_(from_double(value))
+        {
+        }
+
+        static constexpr Fixed from_raw(raw_type raw)
+        {
+            Fixed f;
+            f.raw_ = raw;
+            return f;
+        }
+
+        static constexpr Fixed max()     { return from_raw(raw_max); }
+        static constexpr Fixed lowest()  { return from_raw(raw_min); }
+        static constexpr Fixed epsilon() { return from_raw(1); }
+
+        constexpr raw_type raw() const { return raw_; }
+
+        constexpr explicit operator double() const
+        {
+            return static_cast<double>(raw_) / static_cast<double>(std::int64_t(1) << FracBits);
+        }
+
+        // ---- Saturating arithmetic -----------------------------------------
+
+        friend constexpr Fixed operator+(Fixed a, Fixed b)
+        {
+            return from_raw(saturate(std::int64_t(a.raw_) + b.raw_));
+        }
+
+        friend constexpr Fixed operator-(Fixed a, Fixed b)
+        {
+            return from_raw(saturate(std::int64_t(a.raw_) - b.raw_));
+        }
+
+        friend constexpr Fixed operator-(Fixed a)
+        {
+            return from_raw(saturate(-std::int64_t(a.raw_)));
+        }
+
+        friend constexpr Fixed operator*(Fixed a, Fixed b)
+        {
+            return from_raw(saturate(round_shift(std::int64_t(a.raw_) * b.raw_)));
+        }
+
+        friend constexpr bool operator==(Fixed a, Fixed b) { return a.raw_ == b.raw_; }
+        friend constexpr bool operator!=(Fixed a, Fixed b) { return a.raw_ != b.raw_; }
+        friend constexpr bool operator< (Fixed a, Fixed b) { return a.raw_ <  b.raw_; }
+        friend constexpr bool operator> (Fixed a, Fixed b) { return a.raw_ >  b.raw_; }
+        friend constexpr bool operator<=(Fixed a, Fixed b) { return a.raw_ <= b.raw_; }
+        friend constexpr bool operator>=(Fixed a, Fixed b) { return a.raw_ >= b.raw_; }
+
+    private:
+        static constexpr raw_type saturate(std::int64_t v)
+        {
+            if (v > raw_max) return raw_max;
+            if (v < raw_min) return raw_min;
+            return static_cast<raw_type>(v);
+        }
+
+        // floor((p + 2^(F-1)) / 2^F): round to nearest, ties toward +inf.
+        static constexpr std::int64_t round_shift(std::int64_t p)
+        {
+            if (FracBits == 0) return p;
+
+            const std::int64_t one = std::int64_t(1) << FracBits;
+            const std::int64_t q   = p + (one >> 1);
+            return q >= 0 ? (q >> FracBits) : -((-q + one - 1) >> FracBits);
+        }
+
+        static constexpr raw_type from_double(double v)
+        {
+            if (v != v) return 0;
+
+            const double scaled = v * static_cast<double>(std::int64_t(1) << FracBits);
+            if (scaled >= static_cast<double>(raw_max)) return raw_max;
+            if (scaled <= static_cast<double>(raw_min)) return raw_min;
+
+            // Truncate, then round on the remainder, which is exact for
+            // |scaled| < 2^31; adding 0.5 first would itself round. Same
+            // tie rule as round_shift().
+            std::int64_t t = static_cast<std::int64_t>(scaled);
+            const double r = scaled - static_cast<double>(t);
+            if (r >= 0.5)       ++t;
+            else if (r < -0.5)  --t;
+            return saturate(t);
+        }
+
+        raw_type raw_ = 0;
+    };
+
+    // Common formats
+    using Q15_16 = Fixed<15, 16>; // range ±32768, resolution 1.5e-5
+    using Q7_24  = Fixed<7, 24>;  // range ±128,   resolution 6.0e-8
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_FIXED_POINT_HPP
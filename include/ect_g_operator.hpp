@@ -1,13 +1,71 @@
 #ifndef ECT_SDK_G_OPERATOR_HPP
 #define ECT_SDK_G_OPERATOR_HPP
 
+#include <cstddef>
+#include <cstdint>
+
+#include "ect_operator_form.hpp"
+
 namespace ect::sdk
 {
+    // Which side of the output clamp, if any, produced u. Values match the
+    // saturation column of the trace format; batch APIs store them as int8.
+    enum class ClampState : std::int8_t
+    {
+        SatMin = -1,
+        Free   = 0,
+        SatMax = 1
+    };
+
+    // Result of GOperator::evaluate(): the output, the value before the
+    // clamp, and whether the clamp was engaged.
+    struct GEvaluation
+    {
+        double     u     = 0.0;
+        double     raw   = 0.0;
+        ClampState state = ClampState::Free;
+    };
+
     class GOperator
     {
     public:
         virtual ~GOperator() = default;
         virtual double apply(double delta) const = 0;
+
+        // Evaluates apply() for n elements; in and out may alias exactly.
+        // Overrides must return the same bits as apply() for each element.
+        virtual void apply_batch(const double* in, double* out, std::size_t n) const
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = apply(in[i]);
+            }
+        }
+
+        // Optional introspection used by Controller::plan(); see AffineForm.
+        // Returns false (opaque) unless overridden.
+        virtual bool affine_form(AffineForm& form) const
+        {
+            (void)form;
+            return false;
+        }
+
+        // apply() plus clamp classification. u must equal apply(delta).
+        // The default derives raw and state from affine_form() when the
+        // operator reports one (SatMin iff raw < lower, SatMax iff
+        // raw > upper) and otherwise reports raw = u, Free. Custom operators
+        // with a clamp should override this.
+        virtual GEvaluation evaluate(double delta) const;
+
+        // Batch form of evaluate(); raw may be nullptr. in and u may alias
+        // exactly. state[i] holds a ClampState value.
+        virtual void evaluate_batch(
+            const double* in,
+            double*       u,
+            double*       raw,
+            std::int8_t*  state,
+            std::size_t   n
+        ) const;
     };
 
     class LinearGOperator final : public GOperator
@@ -15,6 +73,15 @@ namespace ect::sdk
     public:
         LinearGOperator(double gain, double u_min, double u_max);
         double apply(double delta) const override;
+        bool affine_form(AffineForm& form) const override;
+
+        GEvaluation evaluate(double delta) const override;
+        void evaluate_batch(const double* in, double* u, double* raw, std::int8_t* state,
+                            std::size_t n) const override;
+
+        double gain()  const;
+        double u_min() const;
+        double u_max() const;
 
     private:
         double k_;
@@ -0,0 +1,112 @@
+#ifndef ECT_SDK_HORIZON_HPP
+#define ECT_SDK_HORIZON_HPP
+
+#include <cstddef>
+#include <limits>
+
+namespace ect::sdk
+{
+    class FOperator;
+    class EOperator;
+    class FInvOperator;
+    class GOperator;
+
+    struct HorizonPrediction
+    {
+        // Returned by saturation_end when a bound of 0 holds the loop
+        // saturated for good, and when the saturated run is too long to
+        // count (4e18 steps or more, e.g. for an infinite Delta_0).
+        static constexpr std::size_t NEVER = std::numeric_limits<std::size_t>::max();
+
+        double delta        = 0.0;   // Delta_N
+        double cumulative_u = 0.0;   // u_0 + ... + u_{N-1}
+
+        // Steps among the first N with u at a bound.
+        std::size_t saturated_steps = 0;
+
+        // First step k such that u_k, u_{k+1}, ... are all unsaturated,
+        // independent of the horizon (0 if the loop never saturates).
+        std::size_t saturation_end = 0;
+    };
+
+    // -------------------------------------------------------------------------
+    // HorizonPredictor
+    //
+    // Closed-form trajectory of a linear controller
+    //
+    //   u_k = clamp(gain * Delta_k, u_min, u_max)
+    //
+    // driving an integrator plant x += plant_gain * u toward a constant
+    // target, i.e.
+    //
+    //   Delta_{k+1} = Delta_k - plant_gain * u_k.
+    //
+    // Unsaturated steps contract geometrically, Delta_{k+1} = r * Delta_k
+    // with r = 1 - plant_gain * gain (1 - alpha for the default pipeline);
+    // saturated steps move Delta by a constant plant_gain * u_max (or
+    // u_min). predict() walks these phases, each in closed form, so a query
+    // costs O(1) in the horizon instead of N update() calls. Requiring
+    // 0 < plant_gain * gain < 2 and u_min <= 0 <= u_max bounds the walk to
+    // a handful of phases: at most one saturated run per bound, possibly
+    // separated by a single overshooting step when r < 0, then the
+    // geometric tail (evaluated with one pow()).
+    //
+    // Values agree with stepping the controller up to floating-point
+    // rounding (the phases sum in a different order); a saturation
+    // boundary that the iteration hits within rounding of a tie may be
+    // reported one step apart.
+    // -------------------------------------------------------------------------
+
+    class HorizonPredictor
+    {
+    public:
+        // Throws std::invalid_argument unless gain and plant_gain are finite,
+        // 0 < plant_gain * gain < 2 and u_min <= 0 <= u_max (the bounds may
+        // be infinite).
+        HorizonPredictor(double gain, double u_min, double u_max, double plant_gain = 1.0);
+
+        // Takes gain and bounds from the operators' AffineForm (see
+        // Controller::plan()). Throws std::invalid_argument if an operator
+        // is opaque or has an offset, if F, E or F^-1 clamps, or if the
+        // derived parameters fail the checks above.
+        HorizonPredictor(
+            const FOperator&    f,
+            const EOperator&    e,
+            const FInvOperator& finv,
+            const GOperator&    g,
+            double              plant_gain = 1.0
+        );
+
+        double gain()       const;
+        double u_min()      const;
+        double u_max()      const;
+        double plant_gain() const;
+
+        // Contraction ratio r of unsaturated steps.
+        double ratio() const;
+
+        HorizonPrediction predict(double delta0, std::size_t horizon) const;
+
+    private:
+        static constexpr std::size_t MAX_SCALES = 4;
+
+        void validate() const;
+
+        double command(double delta) const;
+        bool   saturated_after(double delta, double step, std::size_t j, bool upper) const;
+
+        // Non-identity stage scales in pipeline order; command() applies
+        // them one by one like the controller, so the first step's
+        // classification matches update() exactly.
+        double      scales_[MAX_SCALES] = {};
+        std::size_t scale_count_        = 0;
+
+        double gain_       = 1.0;
+        double u_min_      = 0.0;
+        double u_max_      = 0.0;
+        double plant_gain_ = 1.0;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_HORIZON_HPP
@@ -0,0 +1,326 @@
+#ifndef ECT_SDK_HOT_PARAMETERS_HPP
+#define ECT_SDK_HOT_PARAMETERS_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // HotParameters<T>
+    //
+    // RCU-style cell holding an immutable parameter block of type T.
+    //
+    // Control threads each own a Reader. Reader::pin() marks the reader as
+    // active in the current epoch and loads the block pointer once; the
+    // returned Snapshot keeps that block alive until it is destroyed. Pinning
+    // is two atomic operations on a cache line owned by the reader: no locks,
+    // no allocation, and every field of a block is seen from the same
+    // publish() (no torn reads).
+    //
+    // Tuning threads call publish(), which allocates the new block, swaps
+    // the pointer, advances the epoch and frees every retired block no
+    // active reader can still hold. Publishers are serialized by a mutex
+    // that readers never touch.
+    //
+    // All Readers must be destroyed before the cell.
+    // -------------------------------------------------------------------------
+
+    template <typename T>
+    class HotParameters
+    {
+        struct Block
+        {
+            T             value;
+            std::uint64_t version;
+        };
+
+        struct alignas(64) Slot
+        {
+            std::atomic<std::uint64_t> epoch{0};    // 0 = quiescent
+            std::atomic<bool>          in_use{false};
+        };
+
+    public:
+        static constexpr std::size_t DEFAULT_MAX_READERS = 8;
+
+        class Reader;
+
+        // Pinned view of one parameter block.
+        class Snapshot
+        {
+        public:
+            Snapshot(Snapshot&& other) noexcept
+                : slot_(std::exchange(other.slot_, nullptr))
+                , block_(other.block_)
+            {
+            }
+
+            Snapshot(const Snapshot&)            = delete;
+            Snapshot& operator=(const Snapshot&) = delete;
+            Snapshot& operator=(Snapshot&&)      = delete;
+
+            ~Snapshot()
+            {
+                if (slot_ != nullptr)
+                {
+                    slot_->epoch.store(0, std::memory_order_release);
+                }
+            }
+
+            const T& operator*()  const { return block_->value; }
+            const T* operator->() const { return &block_->value; }
+
+            // 1 for the initial block, +1 per publish().
+            std::uint64_t version() const { return block_->version; }
+
+        private:
+            friend class Reader;
+
+            Snapshot(Slot* slot, const Block* block)
+                : slot_(slot)
+                , block_(block)
+            {
+            }
+
+            Slot*        slot_;
+            const Block* block_;
+        };
+
+        // Per-thread read handle; move-only. A reader holds at most one
+        // Snapshot at a time.
+        class Reader
+        {
+        public:
+            Reader(Reader&& other) noexcept
+                : cell_(std::exchange(other.cell_, nullptr))
+                , slot_(std::exchange(other.slot_, nullptr))
+            {
+            }
+
+            Reader(const Reader&)            = delete;
+            Reader& operator=(const Reader&) = delete;
+            Reader& operator=(Reader&&)      = delete;
+
+            ~Reader()
+            {
+                if (slot_ != nullptr)
+                {
+                    slot_->epoch.store(0, std::memory_order_release);
+                    slot_->in_use.store(false, std::memory_order_release);
+                }
+            }
+
+            Snapshot pin() const noexcept
+            {
+                // Announce the epoch before loading the pointer; both are
+                // sequentially consistent so a publisher that misses this
+                // pin is ordered before the load and its old block is
+                // never returned.
+                slot_->epoch.store(cell_->epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+                return Snapshot(slot_, cell_->current_.load(std::memory_order_seq_cst));
+            }
+
+        private:
+            friend class HotParameters;
+
+            Reader(const HotParameters* cell, Slot* slot)
+                : cell_(cell)
+                , slot_(slot)
+            {
+            }
+
+            const HotParameters* cell_;
+            Slot*                slot_;
+        };
+
+        explicit HotParameters(const T& initial, std::size_t max_readers = DEFAULT_MAX_READERS)
+            : slots_(new Slot[max_readers])
+            , max_readers_(max_readers)
+        {
+            current_.store(new Block{ initial, 1 }, std::memory_order_release);
+        }
+
+        ~HotParameters()
+        {
+            delete current_.load(std::memory_order_acquire);
+            for (const Retired& r : retired_)
+            {
+                delete r.block;
+            }
+        }
+
+        HotParameters(const HotParameters&)            = delete;
+        HotParameters& operator=(const HotParameters&) = delete;
+
+        std::size_t max_readers() const { return max_readers_; }
+
+        // Claims a reader slot. Throws std::length_error when all
+        // max_readers slots are taken.
+        Reader reader()
+        {
+            for (std::size_t i = 0; i < max_readers_; ++i)
+            {
+                bool expected = false;
+                if (slots_[i].in_use.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                {
+                    return Reader(this, &slots_[i]);
+                }
+            }
+            throw std::length_error("HotParameters::reader: all reader slots are in use");
+        }
+
+        // Publishes a new block; readers pick it up at their next pin().
+        // Returns the new version.
+        std::uint64_t publish(const T& value)
+        {
+            std::lock_guard<std::mutex> lock(publish_mutex_);
+
+            const Block* next = new Block{ value, version_ + 1 };
+            retired_.reserve(retired_.size() + 1);
+
+            const Block* old = current_.exchange(next, std::memory_order_seq_cst);
+            const std::uint64_t epoch = epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+            retired_.push_back(Retired{ old, epoch });
+            ++version_;
+
+            reclaim_locked();
+            return version_;
+        }
+
+        // Frees retired blocks that are no longer reachable; publish() does
+        // this already. Returns the number still waiting for readers.
+        std::size_t reclaim()
+        {
+            std::lock_guard<std::mutex> lock(publish_mutex_);
+            reclaim_locked();
+            return retired_.size();
+        }
+
+        // Current block, copied; for tuning threads and diagnostics.
+        T load() const
+        {
+            std::lock_guard<std::mutex> lock(publish_mutex_);
+            return current_.load(std::memory_order_acquire)->value;
+        }
+
+        std::uint64_t version() const
+        {
+            std::lock_guard<std::mutex> lock(publish_mutex_);
+            return version_;
+        }
+
+    private:
+        struct Retired
+        {
+            const Block*  block;
+            std::uint64_t epoch;   // first epoch in which it is unreachable
+        };
+
+        void reclaim_locked()
+        {
+            // A reader pinned at epoch p loaded the pointer after epoch p
+            // began, so it cannot hold a block retired at an epoch <= p.
+            std::uint64_t oldest = ~std::uint64_t(0);
+            for (std::size_t i = 0; i < max_readers_; ++i)
+            {
+                const std::uint64_t e = slots_[i].epoch.load(std::memory_order_seq_cst);
+                if (e != 0 && e < oldest) oldest = e;
+            }
+
+            std::size_t kept = 0;
+            for (const Retired& r : retired_)
+            {
+                if (r.epoch <= oldest)
+                {
+                    delete r.block;
+                }
+                else
+                {
+                    retired_[kept++] = r;
+                }
+            }
+            retired_.resize(kept);
+        }
+
+        std::atomic<const Block*>  current_{nullptr};
+        std::atomic<std::uint64_t> epoch_{1};
+        std::unique_ptr<Slot[]>    slots_;
+        std::size_t                max_readers_;
+
+        mutable std::mutex   publish_mutex_;
+        std::vector<Retired> retired_;
+        std::uint64_t        version_ = 1;
+    };
+
+    // -------------------------------------------------------------------------
+    // HotLinearController
+    //
+    // Linear ECT loop whose alpha, gain and bounds can be retuned while it
+    // runs. Each control thread attaches a Handle; update() evaluates
+    //
+    //   clamp(gain * (alpha * delta), u_min, u_max)
+    //
+    // against one pinned parameter block, bit-identical to a Controller
+    // built from the Linear* operators with the same values. update_batch()
+    // pins once, so a whole batch sees one parameter set. retune() takes
+    // effect at the next call on every handle.
+    // -------------------------------------------------------------------------
+
+    struct LinearParameters
+    {
+        double alpha = 1.0;
+        double gain  = 1.0;
+        double u_min = -1.0;
+        double u_max = 1.0;
+    };
+
+    class HotLinearController
+    {
+    public:
+        class Handle
+        {
+        public:
+            double update(double delta) const;
+            void   update_batch(const double* deltas, double* out, std::size_t n) const;
+
+            // Version of the block the next update() would use.
+            std::uint64_t version() const;
+
+        private:
+            friend class HotLinearController;
+
+            explicit Handle(HotParameters<LinearParameters>::Reader reader);
+
+            HotParameters<LinearParameters>::Reader reader_;
+        };
+
+        // Throws std::invalid_argument unless u_min <= u_max.
+        explicit HotLinearController(
+            const LinearParameters& initial,
+            std::size_t             max_handles = HotParameters<LinearParameters>::DEFAULT_MAX_READERS
+        );
+
+        // Throws std::length_error when max_handles handles are attached.
+        Handle attach();
+
+        // Throws std::invalid_argument unless u_min <= u_max. Returns the
+        // new parameter version.
+        std::uint64_t retune(const LinearParameters& parameters);
+
+        LinearParameters parameters() const;
+        std::uint64_t    version()    const;
+
+    private:
+        HotParameters<LinearParameters> cell_;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_HOT_PARAMETERS_HPP
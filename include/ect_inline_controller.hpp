@@ -0,0 +1,214 @@
+#ifndef ECT_SDK_INLINE_CONTROLLER_HPP
+#define ECT_SDK_INLINE_CONTROLLER_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <variant>
+
+namespace ect::sdk
+{
+    class ThreadPool;
+
+    // -------------------------------------------------------------------------
+    // InlineOperator
+    //
+    // Small-buffer slot for a custom stage. Holds a copy of any trivially
+    // copyable type with `double apply(double) const` that fits in CAPACITY
+    // bytes, plus one function pointer to call it. The slot itself stays
+    // trivially copyable, so it can be memcpy'd along with its controller.
+    //
+    // Operators derived from the virtual *Operator interfaces are not
+    // trivially copyable; wrap a pointer to them in a small struct instead
+    // (the pointee then has to outlive the controller).
+    // -------------------------------------------------------------------------
+
+    class InlineOperator
+    {
+    public:
+        static constexpr std::size_t CAPACITY = 24;
+
+        template <typename Op>
+        explicit InlineOperator(const Op& op)
+            : call_(&call<Op>)
+        {
+            static_assert(std::is_trivially_copyable_v<Op>, "InlineOperator: Op must be trivially copyable");
+            static_assert(sizeof(Op) <= CAPACITY, "InlineOperator: Op does not fit the inline buffer");
+            static_assert(alignof(Op) <= alignof(double), "InlineOperator: Op is over-aligned");
+            ::new (static_cast<void*>(storage_)) Op(op);
+        }
+
+        double apply(double x) const { return call_(storage_, x); }
+
+    private:
+        template <typename Op>
+        static double call(const void* storage, double x)
+        {
+            return std::launder(static_cast<const Op*>(storage))->apply(x);
+        }
+
+        alignas(double) unsigned char storage_[CAPACITY];
+        double (*call_)(const void*, double);
+    };
+
+    // -------------------------------------------------------------------------
+    // Inline operator descriptions
+    //
+    // Plain parameter blocks for the built-in operator families. Each one
+    // evaluates exactly like the operator class of the same name, and the
+    // constructors reject the same parameters (std::invalid_argument).
+    // -------------------------------------------------------------------------
+
+    namespace inline_ops
+    {
+        // ---- F ----
+        struct LinearF
+        {
+        };
+
+        struct TanhF
+        {
+            explicit TanhF(double scale);
+            double scale;
+        };
+
+        struct AsinhF
+        {
+            explicit AsinhF(double scale);
+            double scale;
+        };
+
+        struct SigmoidF
+        {
+            explicit SigmoidF(double scale);
+            double scale;
+        };
+
+        // ---- E ----
+        struct LinearE
+        {
+            explicit LinearE(double gain) : gain(gain) {}
+            double gain;
+        };
+
+        struct SaturatingE
+        {
+            SaturatingE(double alpha, double limit);
+            double alpha_limit;   // alpha * limit, as in SaturatingEOperator
+            double limit;
+        };
+
+        struct PowerE
+        {
+            PowerE(double alpha, double exponent, double limit);
+            double alpha;
+            double exponent;
+            double limit;
+        };
+
+        // ---- F^-1 ----
+        struct LinearFInv
+        {
+        };
+
+        struct AtanhFInv
+        {
+            explicit AtanhFInv(double scale);
+            double scale;
+        };
+
+        struct SinhFInv
+        {
+            explicit SinhFInv(double scale);
+            double scale;
+        };
+
+        struct SigmoidFInv
+        {
+            explicit SigmoidFInv(double scale);
+            double scale;
+        };
+
+        // ---- G ----
+        struct LinearG
+        {
+            LinearG(double gain, double u_min, double u_max) : gain(gain), u_min(u_min), u_max(u_max) {}
+            double gain;
+            double u_min;
+            double u_max;
+        };
+
+        struct SmoothSaturationG
+        {
+            SmoothSaturationG(double gain, double u_min, double u_max);
+            double gain;
+            double u_min;
+            double u_max;
+        };
+    }
+
+    using InlineF    = std::variant<inline_ops::LinearF, inline_ops::TanhF, inline_ops::AsinhF,
+                                    inline_ops::SigmoidF, InlineOperator>;
+    using InlineE    = std::variant<inline_ops::LinearE, inline_ops::SaturatingE, inline_ops::PowerE,
+                                    InlineOperator>;
+    using InlineFInv = std::variant<inline_ops::LinearFInv, inline_ops::AtanhFInv, inline_ops::SinhFInv,
+                                    inline_ops::SigmoidFInv, InlineOperator>;
+    using InlineG    = std::variant<inline_ops::LinearG, inline_ops::SmoothSaturationG, InlineOperator>;
+
+    // -------------------------------------------------------------------------
+    // InlineController
+    //
+    // Self-contained controller: the four stages are stored by value, so a
+    // controller is one contiguous, trivially copyable object and an array
+    // of heterogeneous controllers is iterated linearly through memory.
+    // Built-in stages are dispatched through the variant index without
+    // virtual calls; update() is bit-identical to a Controller built from
+    // the corresponding operator classes.
+    // -------------------------------------------------------------------------
+
+    class InlineController
+    {
+    public:
+        // Linear pipeline with alpha = 1, gain = 1 and bounds [-1, 1], like a
+        // fresh ControllerBank entity.
+        InlineController();
+
+        InlineController(const InlineF& f, const InlineE& e, const InlineFInv& finv, const InlineG& g);
+
+        double update(double delta) const;
+
+        // Stage by stage over the batch, one dispatch per stage; built-in
+        // nonlinear stages use the SIMD kernels of the operator classes.
+        // deltas and out may alias exactly.
+        void update_batch(const double* deltas, double* out, std::size_t n) const;
+
+        const InlineF&    f()    const { return f_; }
+        const InlineE&    e()    const { return e_; }
+        const InlineFInv& finv() const { return finv_; }
+        const InlineG&    g()    const { return g_; }
+
+    private:
+        InlineF    f_;
+        InlineE    e_;
+        InlineFInv finv_;
+        InlineG    g_;
+    };
+
+    static_assert(std::is_trivially_copyable_v<InlineController>, "InlineController must stay trivially copyable");
+
+    // out[i] = controllers[i].update(deltas[i]) for i in [0, n).
+    void update_fleet(const InlineController* controllers, const double* deltas, double* out, std::size_t n);
+
+    // Same result, split across the pool in chunks of `grain` controllers.
+    void update_fleet(
+        const InlineController* controllers,
+        const double*           deltas,
+        double*                 out,
+        std::size_t             n,
+        ThreadPool&             pool,
+        std::size_t             grain = 4096
+    );
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_INLINE_CONTROLLER_HPP
@@ -0,0 +1,154 @@
+#ifndef ECT_SDK_INSTRUMENTATION_HPP
+#define ECT_SDK_INSTRUMENTATION_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// -----------------------------------------------------------------------------
+// Per-stage latency instrumentation (opt-in, compile time).
+//
+// Built with ECT_SDK_INSTRUMENTATION=1 (CMake: ECT_SDK_ENABLE_INSTRUMENTATION),
+// Controller::update() timestamps the boundaries between F, E, F^-1 and G and
+// records each stage and the whole update into per-thread histograms.
+// Without it the timing code is not compiled at all; snapshot() still exists
+// and reports zero samples, so callers need no #ifdefs of their own.
+// -----------------------------------------------------------------------------
+
+#if !defined(ECT_SDK_INSTRUMENTATION)
+#define ECT_SDK_INSTRUMENTATION 0
+#endif
+
+namespace ect::sdk::instrumentation
+{
+    inline constexpr bool enabled = (ECT_SDK_INSTRUMENTATION != 0);
+
+    enum class Stage : std::size_t
+    {
+        F = 0,
+        E,
+        FInv,
+        G,
+        Update
+    };
+
+    inline constexpr std::size_t STAGE_COUNT = 5;
+
+    const char* stage_name(Stage stage);
+
+    // -------------------------------------------------------------------------
+    // Histogram
+    //
+    // HDR-style log-linear buckets over nanoseconds: exact below 32 ns, then
+    // 32 sub-buckets per power of two (relative bucket width <= 1/32).
+    // Values above 2^40 ns are recorded in the last bucket.
+    //
+    // record() is meant for a single writer thread and uses relaxed
+    // load/store pairs (no read-modify-write); any thread may read
+    // concurrently and sees a slightly stale but well-formed histogram.
+    // -------------------------------------------------------------------------
+
+    class Histogram
+    {
+    public:
+        static constexpr unsigned      SUB_BITS     = 5;
+        static constexpr std::uint64_t SUB_BUCKETS  = std::uint64_t(1) << SUB_BITS;
+        static constexpr unsigned      MAX_EXPONENT = 40;
+        static constexpr std::size_t   BUCKETS      =
+            static_cast<std::size_t>(SUB_BUCKETS + (MAX_EXPONENT + 1 - SUB_BITS) * SUB_BUCKETS);
+
+        Histogram();
+
+        Histogram(const Histogram&)            = delete;
+        Histogram& operator=(const Histogram&) = delete;
+
+        void record(std::uint64_t ns)
+        {
+            bump(counts_[bucket_of(ns)]);
+            bump(count_);
+            sum_.store(sum_.load(std::memory_order_relaxed) + ns, std::memory_order_relaxed);
+            if (ns > max_.load(std::memory_order_relaxed))
+            {
+                max_.store(ns, std::memory_order_relaxed);
+            }
+            if (ns < min_.load(std::memory_order_relaxed))
+            {
+                min_.store(ns, std::memory_order_relaxed);
+            }
+        }
+
+        void reset();
+
+        // Adds this histogram's counts to other (reader side).
+        void merge_into(Histogram& other) const;
+
+        std::uint64_t count() const { return count_.load(std::memory_order_relaxed); }
+        std::uint64_t max()   const { return max_.load(std::memory_order_relaxed); }
+        std::uint64_t min()   const;
+        double        mean()  const;
+
+        // Smallest recorded-bucket upper bound v such that at least a
+        // fraction q of the samples are <= v, clamped to max(). 0 if empty.
+        std::uint64_t quantile(double q) const;
+
+        static std::size_t   bucket_of(std::uint64_t ns);
+        static std::uint64_t bucket_lower(std::size_t index);
+        static std::uint64_t bucket_upper(std::size_t index);
+
+    private:
+        static void bump(std::atomic<std::uint64_t>& c)
+        {
+            c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+
+        std::array<std::atomic<std::uint64_t>, BUCKETS> counts_;
+        std::atomic<std::uint64_t> count_;
+        std::atomic<std::uint64_t> sum_;
+        std::atomic<std::uint64_t> max_;
+        std::atomic<std::uint64_t> min_;
+    };
+
+    // -------------------------------------------------------------------------
+    // Snapshot API
+    // -------------------------------------------------------------------------
+
+    struct Summary
+    {
+        std::uint64_t count   = 0;
+        std::uint64_t min_ns  = 0;
+        std::uint64_t p50_ns  = 0;
+        std::uint64_t p99_ns  = 0;
+        std::uint64_t p999_ns = 0;
+        std::uint64_t max_ns  = 0;
+        double        mean_ns = 0.0;
+    };
+
+    // Count, extremes, quantiles and mean of one histogram.
+    Summary summarize(const Histogram& histogram);
+
+    struct Snapshot
+    {
+        std::size_t                       threads = 0;
+        std::array<Summary, STAGE_COUNT> stages{};
+
+        const Summary& operator[](Stage stage) const { return stages[static_cast<std::size_t>(stage)]; }
+    };
+
+    // Merges the histograms of every thread that has recorded so far
+    // (including threads that have since exited).
+    Snapshot snapshot();
+
+    // Clears all recorded samples. Samples recorded concurrently with
+    // reset() may survive it.
+    void reset();
+
+    namespace detail
+    {
+        // Calling thread's histograms, registered on first use.
+        std::array<Histogram, STAGE_COUNT>& thread_histograms();
+    }
+
+} // namespace ect::sdk::instrumentation
+
+#endif // ECT_SDK_INSTRUMENTATION_HPP
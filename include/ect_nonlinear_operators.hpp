@@ -0,0 +1,158 @@
+#ifndef ECT_SDK_NONLINEAR_OPERATORS_HPP
+#define ECT_SDK_NONLINEAR_OPERATORS_HPP
+
+#include <cstddef>
+
+#include "ect_f_operator.hpp"
+#include "ect_e_operator.hpp"
+#include "ect_finv_operator.hpp"
+#include "ect_g_operator.hpp"
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // Nonlinear operator families
+    //
+    // All transcendental evaluations go through ect::sdk::fast_math (see
+    // ect_fast_math.hpp for error bounds). apply_batch() runs the same
+    // arithmetic on SIMD lanes and returns exactly the bits of apply().
+    // Constructors throw std::invalid_argument for parameters outside the
+    // admissible ranges given below.
+    // -------------------------------------------------------------------------
+
+    // ---- Embeddings (F) and their inverses (F⁻¹) ----------------------------
+
+    // F(Δ) = tanh(Δ / scale), scale > 0. Range (-1, 1).
+    class TanhFOperator final : public FOperator
+    {
+    public:
+        explicit TanhFOperator(double scale);
+        double apply(double delta) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+
+    private:
+        double scale_;
+    };
+
+    // F⁻¹(x) = scale * atanh(x), inverse of TanhFOperator. |x| >= 1 maps to
+    // ±inf / NaN and must be bounded by G.
+    class AtanhFInvOperator final : public FInvOperator
+    {
+    public:
+        explicit AtanhFInvOperator(double scale);
+        double apply(double x) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+
+    private:
+        double scale_;
+    };
+
+    // F(Δ) = asinh(Δ / scale), scale > 0. Unbounded, logarithmic growth.
+    class AsinhFOperator final : public FOperator
+    {
+    public:
+        explicit AsinhFOperator(double scale);
+        double apply(double delta) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+
+    private:
+        double scale_;
+    };
+
+    // F⁻¹(x) = scale * sinh(x), inverse of AsinhFOperator.
+    class SinhFInvOperator final : public FInvOperator
+    {
+    public:
+        explicit SinhFInvOperator(double scale);
+        double apply(double x) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+
+    private:
+        double scale_;
+    };
+
+    // Algebraic sigmoid: F(Δ) = d / (1 + |d|), d = Δ / scale, scale > 0.
+    // Range (-1, 1); rational, so no approximation error beyond rounding.
+    class SigmoidFOperator final : public FOperator
+    {
+    public:
+        explicit SigmoidFOperator(double scale);
+        double apply(double delta) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+
+    private:
+        double scale_;
+    };
+
+    // F⁻¹(x) = scale * x / (1 - |x|), inverse of SigmoidFOperator.
+    class SigmoidFInvOperator final : public FInvOperator
+    {
+    public:
+        explicit SigmoidFInvOperator(double scale);
+        double apply(double x) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+
+    private:
+        double scale_;
+    };
+
+    // ---- Contractions (E) ---------------------------------------------------
+
+    // E(x) = alpha * limit * tanh(x / limit), 0 < alpha < 1, limit > 0.
+    // Behaves like alpha * x near the origin and saturates at ±alpha*limit.
+    class SaturatingEOperator final : public EOperator
+    {
+    public:
+        SaturatingEOperator(double alpha, double limit);
+        double apply(double x) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+
+    private:
+        double alpha_limit_;
+        double limit_;
+    };
+
+    // E(x) = alpha * sign(x) * limit * (|x| / limit)^exponent  for |x| <= limit
+    //      = alpha * x                                          for |x| >  limit
+    // 0 < alpha < 1, exponent >= 1, limit > 0. Contraction is strongest
+    // near the origin (power law) and linear outside the limit.
+    class PowerEOperator final : public EOperator
+    {
+    public:
+        PowerEOperator(double alpha, double exponent, double limit);
+        double apply(double x) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+
+    private:
+        double alpha_;
+        double exponent_;
+        double limit_;
+    };
+
+    // ---- Output (G) ---------------------------------------------------------
+
+    // Smooth saturation: v = gain * x, then
+    //   u = u_max * tanh(v / u_max)            for v >= 0
+    //   u = -u_min * tanh(v / -u_min)          for v <  0
+    // gain > 0, u_min < 0 < u_max. |u| never exceeds the bound on its side.
+    // evaluate() reports raw = gain * x and SatMin / SatMax once u has
+    // rounded onto the bound.
+    class SmoothSaturationGOperator final : public GOperator
+    {
+    public:
+        SmoothSaturationGOperator(double gain, double u_min, double u_max);
+        double apply(double delta) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+        GEvaluation evaluate(double delta) const override;
+
+        double u_min() const;
+        double u_max() const;
+
+    private:
+        double k_;
+        double u_min_;
+        double u_max_;
+    };
+}
+
+#endif // ECT_SDK_NONLINEAR_OPERATORS_HPP
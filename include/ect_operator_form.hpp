@@ -0,0 +1,48 @@
+#ifndef ECT_SDK_OPERATOR_FORM_HPP
+#define ECT_SDK_OPERATOR_FORM_HPP
+
+#include <limits>
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // AffineForm
+    //
+    // Optional self-description of an operator as
+    //
+    //   y = scale * x + offset, then clamped to [lower, upper]
+    //
+    // An operator may only report this form if apply() produces exactly the
+    // same bits as the following evaluation order:
+    //
+    //   y = x;
+    //   if (scale  != 1.0) y = scale * y;
+    //   if (offset != 0.0) y = y + offset;
+    //   if (y < lower) y = lower;
+    //   else if (y > upper) y = upper;
+    //
+    // Infinite bounds mean "no clamp on that side". Operators that cannot
+    // guarantee this keep the default (no form) and are treated as opaque.
+    // -------------------------------------------------------------------------
+
+    struct AffineForm
+    {
+        double scale  = 1.0;
+        double offset = 0.0;
+        double lower  = -std::numeric_limits<double>::infinity();
+        double upper  =  std::numeric_limits<double>::infinity();
+
+        bool is_identity() const
+        {
+            return scale == 1.0 && offset == 0.0 && is_unbounded();
+        }
+
+        bool is_unbounded() const
+        {
+            return lower == -std::numeric_limits<double>::infinity()
+                && upper ==  std::numeric_limits<double>::infinity();
+        }
+    };
+}
+
+#endif // ECT_SDK_OPERATOR_FORM_HPP
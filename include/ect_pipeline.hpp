@@ -0,0 +1,267 @@
+#ifndef ECT_SDK_PIPELINE_HPP
+#define ECT_SDK_PIPELINE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include "ect_instrumentation.hpp"
+
+namespace ect::sdk
+{
+    class Controller;
+
+    // -------------------------------------------------------------------------
+    // SpscRing
+    //
+    // Bounded lock-free single-producer / single-consumer queue. Exactly one
+    // thread may push and exactly one (other) thread may pop. Each side keeps
+    // a cached copy of the other side's index, so the shared cache lines are
+    // only touched when the cached view says the ring is full or empty.
+    // Never blocks or allocates after construction.
+    // -------------------------------------------------------------------------
+
+    template <typename T>
+    class SpscRing
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "SpscRing: T must be trivially copyable");
+
+    public:
+        // Capacity is rounded up to a power of two (at least 2).
+        explicit SpscRing(std::size_t capacity)
+            : mask_(round_up_pow2(capacity) - 1)
+            , slots_(new T[mask_ + 1])
+        {
+        }
+
+        SpscRing(const SpscRing&)            = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        std::size_t capacity() const
+        {
+            return mask_ + 1;
+        }
+
+        // Approximate when called concurrently with either side.
+        std::size_t size() const
+        {
+            const std::size_t tail = tail_.load(std::memory_order_acquire);
+            return head_.load(std::memory_order_acquire) - tail;
+        }
+
+        // Producer side.
+        bool try_push(const T& value) noexcept
+        {
+            return push(&value, 1) == 1;
+        }
+
+        // Producer side. Pushes up to n values and returns how many fit.
+        std::size_t push(const T* values, std::size_t n) noexcept
+        {
+            const std::size_t head = head_.load(std::memory_order_relaxed);
+            if (capacity() - (head - tail_cache_) < n)
+            {
+                tail_cache_ = tail_.load(std::memory_order_acquire);
+            }
+
+            const std::size_t free = capacity() - (head - tail_cache_);
+            if (n > free) n = free;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                slots_[(head + i) & mask_] = values[i];
+            }
+            head_.store(head + n, std::memory_order_release);
+            return n;
+        }
+
+        // Consumer side.
+        bool try_pop(T& value) noexcept
+        {
+            return pop(&value, 1) == 1;
+        }
+
+        // Consumer side. Pops up to max values and returns how many.
+        std::size_t pop(T* values, std::size_t max) noexcept
+        {
+            const std::size_t tail = tail_.load(std::memory_order_relaxed);
+            if (head_cache_ - tail < max)
+            {
+                head_cache_ = head_.load(std::memory_order_acquire);
+            }
+
+            std::size_t n = head_cache_ - tail;
+            if (n > max) n = max;
+
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                values[i] = slots_[(tail + i) & mask_];
+            }
+            tail_.store(tail + n, std::memory_order_release);
+            return n;
+        }
+
+    private:
+        static std::size_t round_up_pow2(std::size_t n)
+        {
+            std::size_t p = 2;
+            while (p < n) p <<= 1;
+            return p;
+        }
+
+        const std::size_t    mask_;
+        std::unique_ptr<T[]> slots_;
+
+        alignas(64) std::atomic<std::size_t> head_{0};   // written by the producer
+        std::size_t                          tail_cache_ = 0;
+        alignas(64) std::atomic<std::size_t> tail_{0};   // written by the consumer
+        std::size_t                          head_cache_ = 0;
+    };
+
+    // -------------------------------------------------------------------------
+    // ControlPipeline
+    //
+    // Runs deviation computation and the controller on a dedicated worker
+    // thread, between a sensor queue and an actuator queue:
+    //
+    //   sensor thread --push()--> [SpscRing] --> worker: delta = setpoint
+    //   - estimate, Controller::update_batch --> [SpscRing] --pop()--> actuator
+    //
+    // The worker drains up to `batch` samples at a time and evaluates them
+    // in one update_batch() call, so bursts are absorbed at batch throughput.
+    // If fewer than `batch` samples are queued it waits at most flush_us for
+    // more before evaluating what it has; flush_us = 0 never waits. A
+    // sample therefore sits in the pipeline for at most flush_us plus one
+    // batch evaluation plus queueing behind earlier samples.
+    //
+    // Outputs are bit-identical to controller.update(setpoint - estimate)
+    // and leave in input order. When the output queue is full the worker
+    // stalls, the input queue fills up and push() applies the configured
+    // Backpressure policy.
+    //
+    // push() must be called from one thread and pop() from one thread (they
+    // may differ). The controller must outlive the pipeline.
+    // -------------------------------------------------------------------------
+
+    struct PipelineSample
+    {
+        std::uint64_t tag      = 0;     // caller-defined, copied to the output
+        double        setpoint = 0.0;
+        double        estimate = 0.0;
+    };
+
+    struct PipelineOutput
+    {
+        std::uint64_t tag   = 0;
+        double        delta = 0.0;   // setpoint - estimate
+        double        u     = 0.0;
+    };
+
+    enum class Backpressure
+    {
+        Block,   // push() waits for space (returns false only after stop())
+        Drop     // push() fails and counts the sample as dropped
+    };
+
+    struct PipelineOptions
+    {
+        // Queue capacities in samples (rounded up to powers of two).
+        std::size_t input_capacity  = 1 << 14;
+        std::size_t output_capacity = 1 << 14;
+
+        // Largest number of samples evaluated per update_batch() call.
+        std::size_t batch = 256;
+
+        // Longest a partial batch waits for more samples, in microseconds.
+        std::uint32_t flush_us = 0;
+
+        Backpressure backpressure = Backpressure::Block;
+
+        // Pin the worker to this CPU (-1: no pinning). Failures are
+        // reported by pinned(), not fatal.
+        int cpu = -1;
+
+        // How long the worker sleeps when the input queue stays empty;
+        // 0 keeps it spinning (with yields) on its core.
+        std::uint32_t poll_interval_us = 50;
+    };
+
+    struct PipelineStats
+    {
+        std::uint64_t accepted  = 0;   // samples that entered the input queue
+        std::uint64_t dropped   = 0;   // rejected by Backpressure::Drop
+        std::uint64_t processed = 0;   // outputs published
+        std::uint64_t batches   = 0;
+        std::uint64_t discarded = 0;   // accepted but unpublished at stop()
+
+        // Time per update_batch() call including deviation computation.
+        instrumentation::Summary evaluation;
+    };
+
+    class ControlPipeline
+    {
+    public:
+        // Starts the worker thread. Throws std::invalid_argument if
+        // batch == 0.
+        explicit ControlPipeline(const Controller& controller, const PipelineOptions& options = PipelineOptions{});
+
+        // Calls stop().
+        ~ControlPipeline();
+
+        ControlPipeline(const ControlPipeline&)            = delete;
+        ControlPipeline& operator=(const ControlPipeline&) = delete;
+
+        // Sensor side. Returns false if the sample was not accepted.
+        bool push(const PipelineSample& sample);
+
+        // Sensor side. Returns how many of the n samples were accepted, in
+        // order; with Backpressure::Block that is n unless stop() intervenes.
+        std::size_t push(const PipelineSample* samples, std::size_t n);
+
+        // Actuator side, non-blocking.
+        bool        pop(PipelineOutput& output);
+        std::size_t pop(PipelineOutput* outputs, std::size_t max);
+
+        // Stops the worker after its current batch and joins it. Samples not
+        // yet published are discarded and counted; outputs already in the
+        // output queue stay poppable. Idempotent.
+        void stop();
+
+        bool          pinned() const;
+        PipelineStats stats()  const;
+
+    private:
+        void worker_loop();
+        bool publish(const PipelineOutput* outputs, std::size_t n);
+
+        const Controller& controller_;
+        PipelineOptions   options_;
+
+        SpscRing<PipelineSample> input_;
+        SpscRing<PipelineOutput> output_;
+
+        std::atomic<bool>          stop_{false};
+        std::atomic<bool>          joined_{false};
+        std::atomic<std::uint64_t> accepted_{0};
+        std::atomic<std::uint64_t> dropped_{0};
+        std::atomic<std::uint64_t> processed_{0};
+        std::atomic<std::uint64_t> batches_{0};
+        instrumentation::Histogram evaluation_;
+
+        // Worker-thread scratch, sized once up front.
+        std::vector<PipelineSample> samples_;
+        std::vector<double>         deltas_;
+        std::vector<double>         u_;
+        std::vector<PipelineOutput> outputs_;
+
+        std::thread worker_;
+        bool        pinned_ = false;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_PIPELINE_HPP
@@ -0,0 +1,79 @@
+#ifndef ECT_SDK_PLAN_HPP
+#define ECT_SDK_PLAN_HPP
+
+#include <cstddef>
+
+namespace ect::sdk
+{
+    class FOperator;
+    class EOperator;
+    class FInvOperator;
+    class GOperator;
+
+    struct PlanOptions
+    {
+        // Allow folding consecutive affine stages into one multiply-add
+        // (e.g. k * (alpha * x) -> (k * alpha) * x). This changes rounding,
+        // so the resulting plan is no longer bit-identical to update().
+        bool allow_reassociation = false;
+    };
+
+    // -------------------------------------------------------------------------
+    // ExecutionPlan
+    //
+    // Result of Controller::plan(). An Affine plan evaluates the pipeline as
+    // at most four multiply/add steps followed by one clamp, with identity
+    // stages removed. A Generic plan calls the configured operators. Unless
+    // reassociation was requested and applied, evaluate() is bit-identical
+    // to Controller::update(); exact() reports which case holds.
+    //
+    // The plan refers to the controller's operators and must not outlive
+    // them.
+    // -------------------------------------------------------------------------
+
+    class ExecutionPlan
+    {
+    public:
+        enum class Kind
+        {
+            Generic,
+            Affine
+        };
+
+        static constexpr std::size_t MAX_STEPS = 4;
+
+        Kind        kind()  const;
+        bool        exact() const;
+        std::size_t steps() const;
+
+        double evaluate(double delta) const;
+        void   evaluate_batch(const double* deltas, double* out, std::size_t n) const;
+
+    private:
+        friend class Controller;
+
+        ExecutionPlan(
+            const FOperator&    f,
+            const EOperator&    e,
+            const FInvOperator& finv,
+            const GOperator&    g,
+            const PlanOptions&  options
+        );
+
+        const FOperator*    f_;
+        const EOperator*    e_;
+        const FInvOperator* finv_;
+        const GOperator*    g_;
+
+        Kind        kind_  = Kind::Generic;
+        bool        exact_ = true;
+        std::size_t steps_ = 0;
+        double      scale_[MAX_STEPS]  = {};
+        double      offset_[MAX_STEPS] = {};
+        double      lower_ = 0.0;
+        double      upper_ = 0.0;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_PLAN_HPP
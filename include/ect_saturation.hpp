@@ -0,0 +1,96 @@
+#ifndef ECT_SDK_SATURATION_HPP
+#define ECT_SDK_SATURATION_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ect::sdk
+{
+    class ThreadPool;
+
+    // -------------------------------------------------------------------------
+    // Saturation analytics
+    //
+    // Aggregators over ClampState columns as produced by
+    // GOperator::evaluate_batch, Controller::evaluate_batch and
+    // ControllerBank::evaluate. Operators stay stateless; run lengths that
+    // span ticks live in the aggregator.
+    //
+    // A run is a maximal stretch of consecutive samples saturated on the
+    // same side; SatMin directly followed by SatMax starts a new run.
+    // -------------------------------------------------------------------------
+
+    struct SaturationStats
+    {
+        std::uint64_t samples     = 0;
+        std::uint64_t sat_min     = 0;
+        std::uint64_t sat_max     = 0;
+        std::uint64_t runs        = 0;
+        std::uint64_t longest_run = 0;
+
+        std::uint64_t saturated() const { return sat_min + sat_max; }
+
+        // Fraction of saturated samples (0 when empty).
+        double duty_cycle() const
+        {
+            return samples == 0 ? 0.0 : static_cast<double>(saturated()) / static_cast<double>(samples);
+        }
+    };
+
+    // Statistics of one time series state[0..n).
+    SaturationStats saturation_stats(const std::int8_t* state, std::size_t n);
+
+    // -------------------------------------------------------------------------
+    // SaturationTracker
+    //
+    // Per-entity statistics for a fleet evaluated tick by tick (one state
+    // column of size() entries per tick). Counters are kept as columns and
+    // updated in one branch-free pass per tick.
+    // -------------------------------------------------------------------------
+
+    class SaturationTracker
+    {
+    public:
+        static constexpr std::size_t DEFAULT_GRAIN = 4096;
+
+        explicit SaturationTracker(std::size_t size);
+
+        std::size_t   size()  const;
+        std::uint64_t ticks() const;
+
+        // Adds one tick; state has size() entries.
+        void record(const std::int8_t* state);
+
+        // Same result, split across the pool.
+        void record(const std::int8_t* state, ThreadPool& pool, std::size_t grain = DEFAULT_GRAIN);
+
+        // Statistics of entity i over all recorded ticks.
+        // Throws std::out_of_range if i >= size().
+        SaturationStats entity(std::size_t i) const;
+
+        // Counts summed over entities, longest_run is the fleet maximum.
+        SaturationStats total() const;
+
+        const std::uint64_t* sat_min()     const;
+        const std::uint64_t* sat_max()     const;
+        const std::uint64_t* runs()        const;
+        const std::uint64_t* longest_run() const;
+
+        void reset();
+
+    private:
+        void record_range(const std::int8_t* state, std::size_t begin, std::size_t end);
+
+        std::uint64_t              ticks_ = 0;
+        std::vector<std::int8_t>   previous_;
+        std::vector<std::uint64_t> sat_min_;
+        std::vector<std::uint64_t> sat_max_;
+        std::vector<std::uint64_t> runs_;
+        std::vector<std::uint64_t> current_run_;
+        std::vector<std::uint64_t> longest_run_;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_SATURATION_HPP
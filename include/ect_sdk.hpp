@@ -1,11 +1,16 @@
 #ifndef ECT_SDK_HPP
 #define ECT_SDK_HPP
 
+#include <cstddef>
+#include <cstdint>
+
 #include "ect_f_operator.hpp"
 #include "ect_e_operator.hpp"
 #include "ect_finv_operator.hpp"
 #include "ect_g_operator.hpp"
+#include "ect_plan.hpp"
 #include "ect_config.hpp"
+#include "ect_instrumentation.hpp"
 
 namespace ect::sdk
 {
@@ -19,8 +24,36 @@ namespace ect::sdk
             const GOperator&    g
         );
 
+        // With ECT_SDK_INSTRUMENTATION enabled, each call records per-stage
+        // latencies (see ect_instrumentation.hpp); update_batch does not.
         double update(double delta) const;
 
+        // Evaluates update() for n independent deviations.
+        // out[i] is bit-identical to update(deltas[i]); deltas and out may
+        // alias exactly (in-place) but must not partially overlap.
+        // When all four operators describe themselves as affine (the Linear*
+        // operators do) the pipeline runs as a single vectorized kernel,
+        // otherwise each element goes through the configured operators.
+        void update_batch(const double* deltas, double* out, std::size_t n) const;
+
+        // update() plus the G stage's clamp classification and pre-clamp
+        // value (see GOperator::evaluate). evaluate(d).u == update(d).
+        GEvaluation evaluate(double delta) const;
+
+        // Batch form of evaluate(); raw may be nullptr and deltas may alias
+        // u exactly. u[i] is bit-identical to update(deltas[i]).
+        void evaluate_batch(
+            const double* deltas,
+            double*       u,
+            double*       raw,
+            std::int8_t*  state,
+            std::size_t   n
+        ) const;
+
+        // Inspects the operators through AffineForm and builds a fused
+        // execution plan (identity stages folded, optional gain folding).
+        ExecutionPlan plan(const PlanOptions& options = PlanOptions{}) const;
+
     private:
         const FOperator&    f_;
         const EOperator&    e_;
@@ -0,0 +1,132 @@
+#ifndef ECT_SDK_SHARED_BANK_HPP
+#define ECT_SDK_SHARED_BANK_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace ect::sdk
+{
+    class ControllerBank;
+
+    // -------------------------------------------------------------------------
+    // Shared-memory transport for a controller bank
+    //
+    // A named POSIX shared-memory region (shm_open) holding two channels of
+    // size() doubles each:
+    //
+    //   Deviation  written by the estimator, read by the controller
+    //   Output     written by the controller, read by the actuator driver
+    //
+    // Every channel is double-buffered and each buffer carries a seqlock
+    // counter. A writer fills the buffer readers are not using, in place,
+    // then publishes it under a tick number; readers get a pointer to the
+    // newest buffer, use it in place, and check afterwards that it was not
+    // rewritten meanwhile (only possible if the writer published twice
+    // during the read). Nothing on the hot path copies the arrays, takes a
+    // lock or makes a system call; wait() only yields while idle.
+    //
+    // One writing process per channel; any number of readers. The region
+    // outlives the processes until remove() is called, so a crashed peer can
+    // re-attach. Malformed names and a zero size throw
+    // std::invalid_argument; system errors and missing, uninitialised or
+    // foreign regions throw std::runtime_error naming the region. POSIX
+    // only: elsewhere the constructors throw std::runtime_error.
+    // -------------------------------------------------------------------------
+
+    enum class SharedChannel : std::uint32_t
+    {
+        Deviation = 0,
+        Output    = 1
+    };
+
+    // A buffer handed out by read_begin(). `data` points into the region
+    // and stays readable until the region is closed; its contents are only
+    // trustworthy once read_valid() confirms them.
+    struct SharedFrame
+    {
+        const double* data     = nullptr;   // nullptr: nothing published yet
+        std::uint64_t tick     = 0;
+        std::uint64_t sequence = 0;
+        std::uint32_t buffer   = 0;
+    };
+
+    class SharedBank
+    {
+    public:
+        // Creates the region `name` ("/name", as for shm_open) for `size`
+        // controllers. Throws std::runtime_error if it already exists.
+        SharedBank(const std::string& name, std::size_t size);
+
+        // Attaches to an existing region created by another process.
+        explicit SharedBank(const std::string& name);
+
+        ~SharedBank();
+
+        SharedBank(SharedBank&& other) noexcept;
+        SharedBank& operator=(SharedBank&& other) noexcept;
+
+        SharedBank(const SharedBank&)            = delete;
+        SharedBank& operator=(const SharedBank&) = delete;
+
+        // Unlinks the region name; mappings stay valid until closed.
+        // Returns false if no such region exists.
+        static bool remove(const std::string& name);
+
+        const std::string& name() const;
+        std::size_t        size() const;
+
+        // ---- Writer side (one process per channel) -------------------------
+
+        // The buffer to fill for the next tick (size() doubles). Repeated
+        // calls before publish() return the same buffer.
+        double* write_begin(SharedChannel channel);
+
+        // Publishes the buffer from write_begin() as `tick`. Ticks must
+        // increase per channel; the output writer normally reuses the tick
+        // of the deviations it evaluated. Throws std::logic_error without a
+        // pending write_begin() or for a tick not above latest().
+        void publish(SharedChannel channel, std::uint64_t tick);
+
+        // ---- Reader side ---------------------------------------------------
+
+        // Newest published tick, 0 if none.
+        std::uint64_t latest(SharedChannel channel) const;
+
+        SharedFrame read_begin(SharedChannel channel) const;
+
+        // True if `frame` was not overwritten since read_begin(); anything
+        // computed from its data before this call is then consistent.
+        bool read_valid(SharedChannel channel, const SharedFrame& frame) const;
+
+        // Spins (yielding) until `channel` publishes a tick above `after`.
+        // Returns that tick, or 0 on timeout.
+        std::uint64_t wait(
+            SharedChannel            channel,
+            std::uint64_t            after,
+            std::chrono::nanoseconds timeout = std::chrono::seconds(1)
+        ) const;
+
+        // ---- Controller process --------------------------------------------
+
+        // Evaluates the newest deviations newer than the newest output with
+        // `bank`, straight from the deviation buffer into the output buffer,
+        // and publishes the result under the same tick. Returns that tick,
+        // or 0 if there was nothing new. Throws std::invalid_argument if
+        // bank.size() != size().
+        std::uint64_t step(const ControllerBank& bank);
+
+    private:
+        void release() noexcept;
+
+        std::string    name_;
+        void*          base_       = nullptr;
+        std::size_t    bytes_      = 0;
+        std::size_t    size_       = 0;
+        std::ptrdiff_t pending_[2] = { -1, -1 };   // buffer between write_begin and publish
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_SHARED_BANK_HPP
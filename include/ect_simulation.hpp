@@ -0,0 +1,229 @@
+#ifndef ECT_SDK_SIMULATION_HPP
+#define ECT_SDK_SIMULATION_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace ect::sdk
+{
+    class ControllerBank;
+    class ThreadPool;
+
+    // -------------------------------------------------------------------------
+    // Plant models
+    //
+    // Plant dynamics stay explicit and external to the controller.
+    // A model advances a whole range of scenarios per call; state is kept in
+    // structure-of-arrays form as a position column (the measured output)
+    // and a velocity column (unused by first-order models). Models are
+    // stateless and step() may be called concurrently on disjoint ranges.
+    // -------------------------------------------------------------------------
+
+    class PlantModel
+    {
+    public:
+        virtual ~PlantModel() = default;
+
+        // Advances scenarios [begin, end) by one step under commands u[i].
+        virtual void step(
+            double*       position,
+            double*       velocity,
+            const double* u,
+            std::size_t   begin,
+            std::size_t   end
+        ) const = 0;
+    };
+
+    // x += gain * u  (the plant used throughout the examples).
+    class IntegratorPlant final : public PlantModel
+    {
+    public:
+        explicit IntegratorPlant(double gain = 1.0);
+
+        void step(double* position, double* velocity, const double* u,
+                  std::size_t begin, std::size_t end) const override;
+
+    private:
+        double gain_;
+    };
+
+    // tau * y' = gain * u - y, forward Euler with step dt.
+    // Throws std::invalid_argument unless tau > 0 and 0 < dt <= tau.
+    class FirstOrderLagPlant final : public PlantModel
+    {
+    public:
+        FirstOrderLagPlant(double gain, double tau, double dt);
+
+        void step(double* position, double* velocity, const double* u,
+                  std::size_t begin, std::size_t end) const override;
+
+    private:
+        double gain_;
+        double rate_; // dt / tau
+    };
+
+    // y'' = omega^2 * (gain * u - y) - 2 * zeta * omega * y',
+    // semi-implicit Euler with step dt.
+    // Throws std::invalid_argument unless omega > 0, zeta >= 0, dt > 0.
+    class SecondOrderLagPlant final : public PlantModel
+    {
+    public:
+        SecondOrderLagPlant(double gain, double omega, double zeta, double dt);
+
+        void step(double* position, double* velocity, const double* u,
+                  std::size_t begin, std::size_t end) const override;
+
+    private:
+        double gain_;
+        double omega2_;
+        double damping_; // 2 * zeta * omega
+        double dt_;
+    };
+
+    // m * x'' = u - k * x - c * x', semi-implicit Euler with step dt.
+    // Throws std::invalid_argument unless mass > 0, stiffness >= 0,
+    // damping >= 0, dt > 0.
+    class MassSpringDamperPlant final : public PlantModel
+    {
+    public:
+        MassSpringDamperPlant(double mass, double stiffness, double damping, double dt);
+
+        void step(double* position, double* velocity, const double* u,
+                  std::size_t begin, std::size_t end) const override;
+
+    private:
+        double inv_mass_;
+        double stiffness_;
+        double damping_;
+        double dt_;
+    };
+
+    // Vertical axis of a multirotor: m * z'' = u + hover - m * g - drag * z'.
+    // With hover_feedforward the hover thrust m * g is supplied outside the
+    // loop (u is the thrust correction); without it the controller has to
+    // carry the weight itself. Semi-implicit Euler with step dt.
+    // Throws std::invalid_argument unless mass > 0, gravity >= 0,
+    // drag >= 0, dt > 0.
+    class DroneVerticalPlant final : public PlantModel
+    {
+    public:
+        DroneVerticalPlant(
+            double mass,
+            double drag,
+            double dt,
+            bool   hover_feedforward = true,
+            double gravity           = 9.81
+        );
+
+        void step(double* position, double* velocity, const double* u,
+                  std::size_t begin, std::size_t end) const override;
+
+    private:
+        double inv_mass_;
+        double drag_;
+        double dt_;
+        double bias_; // net acceleration at u = 0 and rest
+    };
+
+    // -------------------------------------------------------------------------
+    // Target profiles
+    //
+    // target(k) = base + ramp_rate * k + amplitude * sin(omega * k)
+    // -------------------------------------------------------------------------
+
+    struct TargetProfile
+    {
+        double base      = 0.0;
+        double ramp_rate = 0.0;
+        double amplitude = 0.0;
+        double omega     = 0.0;
+
+        static TargetProfile constant(double value);
+        static TargetProfile ramp_sine(double base, double ramp_rate, double amplitude, double omega);
+
+        double at(std::size_t step) const;
+    };
+
+    // -------------------------------------------------------------------------
+    // Simulation
+    // -------------------------------------------------------------------------
+
+    struct SimulationOptions
+    {
+        std::size_t steps = 200;
+
+        // A scenario has settled once |delta| stays within
+        // max(settling_fraction * |delta_0|, settling_floor) for good.
+        double settling_fraction = 0.02;
+        double settling_floor    = 1e-6;
+
+        // Scenarios per parallel task.
+        std::size_t grain = 256;
+    };
+
+    struct ScenarioMetrics
+    {
+        bool        settled       = false;
+        std::size_t settling_step = 0;   // first step of the final in-band run (== steps if never)
+
+        // Largest excursion past the target against the initial error,
+        // relative to |delta_0| (absolute when delta_0 == 0).
+        double overshoot = 0.0;
+
+        // Fraction of steps on which the G clamp was engaged (ClampState
+        // other than Free, as reported by ControllerBank::evaluate).
+        double saturation_fraction = 0.0;
+
+        double final_position = 0.0;
+        double final_error    = 0.0;   // target(steps) - final_position
+        double max_abs_error  = 0.0;
+    };
+
+    struct SimulationSummary
+    {
+        std::size_t scenarios = 0;
+        std::size_t settled   = 0;
+
+        double      mean_settling_step       = 0.0;   // over settled scenarios
+        std::size_t max_settling_step        = 0;     // over settled scenarios
+        double      max_overshoot            = 0.0;
+        double      mean_saturation_fraction = 0.0;
+        double      max_abs_final_error      = 0.0;
+    };
+
+    struct SimulationResult
+    {
+        std::vector<ScenarioMetrics> scenarios;
+        SimulationSummary            summary;
+    };
+
+    // Runs bank.size() closed loops for options.steps ticks:
+    //
+    //   delta_i = target_i(k) - position_i
+    //   u_i     = bank entity i (delta_i)
+    //   plant.step(...)
+    //
+    // Positions start at initial_position[i], velocities at 0. Results are
+    // bit-identical with and without a pool and for any thread count.
+    // Throws std::invalid_argument if targets or initial_position do not
+    // have bank.size() entries.
+    SimulationResult simulate(
+        const ControllerBank&             bank,
+        const PlantModel&                 plant,
+        const std::vector<TargetProfile>& targets,
+        const std::vector<double>&        initial_position,
+        const SimulationOptions&          options = SimulationOptions{}
+    );
+
+    SimulationResult simulate(
+        const ControllerBank&             bank,
+        const PlantModel&                 plant,
+        const std::vector<TargetProfile>& targets,
+        const std::vector<double>&        initial_position,
+        const SimulationOptions&          options,
+        ThreadPool&                       pool
+    );
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_SIMULATION_HPP
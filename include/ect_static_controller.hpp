@@ -0,0 +1,171 @@
+#ifndef ECT_SDK_STATIC_CONTROLLER_HPP
+#define ECT_SDK_STATIC_CONTROLLER_HPP
+
+#include <array>
+#include <cstddef>
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // Header-only Linear operators
+    //
+    // Same arithmetic as the Linear* operators in ect_*_operator.hpp, but
+    // non-virtual and constexpr so the whole pipeline can be inlined.
+    // -------------------------------------------------------------------------
+
+    class StaticLinearFOperator
+    {
+    public:
+        constexpr double apply(double delta) const
+        {
+            return delta; // kF = 1.0
+        }
+    };
+
+    class StaticLinearEOperator
+    {
+    public:
+        constexpr explicit StaticLinearEOperator(double gain)
+            : k_(gain)
+        {
+        }
+
+        constexpr double apply(double x) const
+        {
+            return k_ * x; // alpha * x
+        }
+
+        constexpr double gain() const { return k_; }
+
+    private:
+        double k_;
+    };
+
+    class StaticLinearFInvOperator
+    {
+    public:
+        constexpr double apply(double x) const
+        {
+            return x; // kF = 1.0 → x / kF
+        }
+    };
+
+    class StaticLinearGOperator
+    {
+    public:
+        constexpr StaticLinearGOperator(double gain, double u_min, double u_max)
+            : k_(gain), u_min_(u_min), u_max_(u_max)
+        {
+        }
+
+        constexpr double apply(double delta) const
+        {
+            const double u = k_ * delta;
+
+            if (u < u_min_) return u_min_;
+            if (u > u_max_) return u_max_;
+            return u;
+        }
+
+        constexpr double gain()  const { return k_; }
+        constexpr double u_min() const { return u_min_; }
+        constexpr double u_max() const { return u_max_; }
+
+    private:
+        double k_;
+        double u_min_;
+        double u_max_;
+    };
+
+    // -------------------------------------------------------------------------
+    // StaticController
+    //
+    // Compile-time counterpart of Controller. Operators are held by value and
+    // called directly, so there is no virtual dispatch and the chain is fully
+    // visible to the optimizer. Any type with `double apply(double) const`
+    // can be used; constexpr operators make update() usable in constant
+    // expressions. Controller remains the path for runtime-selected operators.
+    // -------------------------------------------------------------------------
+
+    template <typename F, typename E, typename FInv, typename G>
+    class StaticController
+    {
+    public:
+        constexpr StaticController(F f, E e, FInv finv, G g)
+            : f_(f)
+            , e_(e)
+            , finv_(finv)
+            , g_(g)
+        {
+        }
+
+        constexpr double update(double delta) const
+        {
+            const double x_f    = f_.apply(delta);
+            const double x_e    = e_.apply(x_f);
+            const double x_finv = finv_.apply(x_e);
+            return g_.apply(x_finv);
+        }
+
+        void update_batch(const double* deltas, double* out, std::size_t n) const
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = update(deltas[i]);
+            }
+        }
+
+        constexpr const F&    f()    const { return f_; }
+        constexpr const E&    e()    const { return e_; }
+        constexpr const FInv& finv() const { return finv_; }
+        constexpr const G&    g()    const { return g_; }
+
+    private:
+        F    f_;
+        E    e_;
+        FInv finv_;
+        G    g_;
+    };
+
+    using StaticLinearController = StaticController<
+        StaticLinearFOperator,
+        StaticLinearEOperator,
+        StaticLinearFInvOperator,
+        StaticLinearGOperator
+    >;
+
+    constexpr StaticLinearController make_static_linear_controller(
+        double alpha,
+        double gain,
+        double u_min,
+        double u_max
+    )
+    {
+        return StaticLinearController(
+            StaticLinearFOperator{},
+            StaticLinearEOperator(alpha),
+            StaticLinearFInvOperator{},
+            StaticLinearGOperator(gain, u_min, u_max)
+        );
+    }
+
+    // Samples controller.update() at N evenly spaced deviations in [lo, hi]
+    // (both ends included). Usable in constant expressions.
+    template <std::size_t N, typename Ctrl>
+    constexpr std::array<double, N> make_response_table(const Ctrl& controller, double lo, double hi)
+    {
+        static_assert(N >= 2, "response table needs at least two samples");
+
+        std::array<double, N> table{};
+        const double step = (hi - lo) / static_cast<double>(N - 1);
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            table[i] = controller.update(lo + step * static_cast<double>(i));
+        }
+        return table;
+    }
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_STATIC_CONTROLLER_HPP
@@ -0,0 +1,154 @@
+#ifndef ECT_SDK_TABULATED_OPERATORS_HPP
+#define ECT_SDK_TABULATED_OPERATORS_HPP
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+#include "ect_f_operator.hpp"
+#include "ect_e_operator.hpp"
+#include "ect_finv_operator.hpp"
+#include "ect_g_operator.hpp"
+
+namespace ect::sdk
+{
+    enum class Interpolation
+    {
+        Linear,
+        Cubic   // monotone cubic Hermite (Fritsch–Butland slopes)
+    };
+
+    struct TableSpec
+    {
+        // Sampled domain. Inputs outside [lo, hi] are clamped to it, so the
+        // domain must cover the operating range of the operator.
+        double lo = -1.0;
+        double hi =  1.0;
+
+        // Initial number of uniformly spaced breakpoints (>= 2).
+        std::size_t   points        = 257;
+        Interpolation interpolation = Interpolation::Linear;
+
+        // Adaptive refinement: segments whose midpoint error exceeds
+        // `tolerance` are split until no segment does or `max_points` is
+        // reached. 0 is always a breakpoint of an adaptive table.
+        bool        adaptive   = false;
+        double      tolerance  = 1e-9;
+        std::size_t max_points = 65537;
+    };
+
+    struct TableReport
+    {
+        std::size_t points          = 0;
+        double      max_abs_error   = 0.0; // measured against the source operator
+        double      max_error_at    = 0.0;
+        bool        monotone        = false;
+        bool        sign_preserving = false;
+    };
+
+    // -------------------------------------------------------------------------
+    // LookupTable
+    //
+    // Piecewise interpolant over sampled breakpoints. Evaluation cost does
+    // not depend on the input value: uniform tables index directly, adaptive
+    // tables use a fixed-length branchless binary search.
+    // -------------------------------------------------------------------------
+
+    class LookupTable
+    {
+    public:
+        // Samples fn over spec.lo..spec.hi. Throws std::invalid_argument on
+        // an invalid spec. The report, if given, lists the measured maximum
+        // error (at quarter points of every segment) and whether
+        // monotonicity and sign preservation hold for the table.
+        LookupTable(
+            const std::function<double(double)>& fn,
+            const TableSpec&                     spec,
+            TableReport*                         report = nullptr
+        );
+
+        double evaluate(double x) const;
+
+        // evaluate() for n elements, bit-identical per element; in and out
+        // may alias exactly. Works in blocks: all segment indices of a
+        // block are computed first, then the breakpoints are gathered and
+        // interpolated in separate loops without per-element branches.
+        void evaluate_batch(const double* in, double* out, std::size_t n) const;
+
+        std::size_t size() const;
+        double      lo()   const;
+        double      hi()   const;
+
+    private:
+        void   compute_slopes();
+        double interpolate(std::size_t i, double x) const;
+
+        Interpolation       interpolation_;
+        bool                uniform_;
+        double              lo_;
+        double              hi_;
+        double              inv_step_ = 0.0;
+        std::vector<double> x_;
+        std::vector<double> y_;
+        std::vector<double> d_; // endpoint slopes for cubic interpolation
+    };
+
+    // -------------------------------------------------------------------------
+    // Tabulated operators
+    //
+    // Drop-in replacements that sample an existing (typically expensive)
+    // operator once at construction. The source operator is not referenced
+    // afterwards. apply_batch() forwards to LookupTable::evaluate_batch()
+    // instead of a virtual apply() per element.
+    // -------------------------------------------------------------------------
+
+    class TabulatedFOperator final : public FOperator
+    {
+    public:
+        TabulatedFOperator(const FOperator& source, const TableSpec& spec, TableReport* report = nullptr);
+        double apply(double delta) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+        const LookupTable& table() const;
+
+    private:
+        LookupTable table_;
+    };
+
+    class TabulatedEOperator final : public EOperator
+    {
+    public:
+        TabulatedEOperator(const EOperator& source, const TableSpec& spec, TableReport* report = nullptr);
+        double apply(double x) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+        const LookupTable& table() const;
+
+    private:
+        LookupTable table_;
+    };
+
+    class TabulatedFInvOperator final : public FInvOperator
+    {
+    public:
+        TabulatedFInvOperator(const FInvOperator& source, const TableSpec& spec, TableReport* report = nullptr);
+        double apply(double x) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+        const LookupTable& table() const;
+
+    private:
+        LookupTable table_;
+    };
+
+    class TabulatedGOperator final : public GOperator
+    {
+    public:
+        TabulatedGOperator(const GOperator& source, const TableSpec& spec, TableReport* report = nullptr);
+        double apply(double delta) const override;
+        void apply_batch(const double* in, double* out, std::size_t n) const override;
+        const LookupTable& table() const;
+
+    private:
+        LookupTable table_;
+    };
+}
+
+#endif // ECT_SDK_TABULATED_OPERATORS_HPP
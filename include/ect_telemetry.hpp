@@ -0,0 +1,169 @@
+#ifndef ECT_SDK_TELEMETRY_HPP
+#define ECT_SDK_TELEMETRY_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ect::sdk
+{
+    // One control step as seen by telemetry. Fixed size and trivially
+    // copyable; saturation uses the trace convention (-1 at the lower
+    // bound, +1 at the upper, 0 otherwise).
+    struct TelemetryRecord
+    {
+        std::uint64_t step       = 0;
+        double        delta      = 0.0;
+        double        u          = 0.0;
+        std::uint32_t channel    = 0;   // caller-defined loop id
+        std::int8_t   saturation = 0;
+    };
+
+    // -------------------------------------------------------------------------
+    // TelemetryRing
+    //
+    // Bounded lock-free multi-producer / single-consumer queue (per-slot
+    // sequence numbers). try_push() never blocks or allocates: it either
+    // claims a slot with one compare-and-swap or fails when the ring is
+    // full. try_pop() must only be called from one thread at a time.
+    // -------------------------------------------------------------------------
+
+    class TelemetryRing
+    {
+    public:
+        // Capacity is rounded up to a power of two (at least 2).
+        explicit TelemetryRing(std::size_t capacity);
+
+        TelemetryRing(const TelemetryRing&)            = delete;
+        TelemetryRing& operator=(const TelemetryRing&) = delete;
+
+        std::size_t capacity() const;
+
+        bool try_push(const TelemetryRecord& record) noexcept;
+        bool try_pop(TelemetryRecord& record) noexcept;
+
+    private:
+        struct Slot
+        {
+            std::atomic<std::size_t> sequence{0};
+            TelemetryRecord          record;
+        };
+
+        std::unique_ptr<Slot[]> slots_;
+        std::size_t             mask_;
+
+        alignas(64) std::atomic<std::size_t> head_{0};   // next slot to push
+        alignas(64) std::atomic<std::size_t> tail_{0};   // next slot to pop
+    };
+
+    // -------------------------------------------------------------------------
+    // TelemetrySink
+    //
+    // Control threads push() records into a TelemetryRing; a background
+    // writer thread drains it in batches and writes them to a file with one
+    // buffered write per batch. push() never blocks, locks or allocates; when
+    // the ring is full the record is dropped and counted.
+    //
+    // Binary files start with the 8-byte magic "ECTTELEM", a uint32 format
+    // version and a uint32 record size, followed by packed native-endian
+    // records (step u64, delta f64, u f64, channel u32, saturation i8,
+    // 3 bytes padding). CSV files have the header
+    // "step,channel,delta,u,saturation" and print doubles round-trippably.
+    // -------------------------------------------------------------------------
+
+    enum class TelemetryFormat
+    {
+        Binary,
+        Csv
+    };
+
+    struct TelemetryOptions
+    {
+        TelemetryFormat format = TelemetryFormat::Binary;
+
+        // Ring capacity in records (rounded up to a power of two).
+        std::size_t capacity = 1 << 16;
+
+        // Records written per batch.
+        std::size_t batch = 4096;
+
+        // How long the writer sleeps when the ring is empty.
+        std::uint32_t poll_interval_us = 1000;
+    };
+
+    class TelemetrySink
+    {
+    public:
+        // Opens (truncates) path and starts the writer thread.
+        // Throws std::runtime_error if the file cannot be opened and
+        // std::invalid_argument if batch == 0.
+        explicit TelemetrySink(const std::string& path, const TelemetryOptions& options = TelemetryOptions{});
+
+        // Calls close(), ignoring write errors.
+        ~TelemetrySink();
+
+        TelemetrySink(const TelemetrySink&)            = delete;
+        TelemetrySink& operator=(const TelemetrySink&) = delete;
+
+        // Safe from any number of threads. Returns false if the record was
+        // dropped (ring full or sink closed). The in-flight count lets
+        // close() wait out a push that passed the closing_ check.
+        bool push(const TelemetryRecord& record) noexcept
+        {
+            pushing_.fetch_add(1);
+            const bool accepted = !closing_.load() && ring_.try_push(record);
+            pushing_.fetch_sub(1, std::memory_order_release);
+
+            if (accepted) return true;
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        std::uint64_t dropped() const;
+        std::uint64_t written() const;
+
+        // Drains the ring, flushes and closes the file, joins the writer.
+        // A push concurrent with close() is either written or counted as
+        // dropped.
+        // Throws std::runtime_error if any write failed; later calls are
+        // no-ops.
+        void close();
+
+    private:
+        void writer_loop();
+        void write_batch(const TelemetryRecord* records, std::size_t n);
+
+        TelemetryRing    ring_;
+        TelemetryOptions options_;
+        std::FILE*       file_ = nullptr;
+
+        std::atomic<bool>          closing_{false};
+        std::atomic<std::uint32_t> pushing_{0};
+        std::atomic<bool>          failed_{false};
+        std::atomic<std::uint64_t> dropped_{0};
+        std::atomic<std::uint64_t> written_{0};
+
+        std::mutex              mutex_;
+        std::condition_variable wake_;
+        std::thread             writer_;
+        bool                    closed_ = false;
+
+        // Writer-thread scratch, sized once up front.
+        std::vector<TelemetryRecord> batch_;
+        std::vector<char>            text_;
+    };
+
+    // Reads a binary telemetry file back (offline analysis and tests).
+    // Throws std::runtime_error on I/O errors or a bad header.
+    std::vector<TelemetryRecord> read_telemetry(const std::string& path);
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_TELEMETRY_HPP
@@ -0,0 +1,92 @@
+#ifndef ECT_SDK_THREAD_POOL_HPP
+#define ECT_SDK_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ect::sdk
+{
+    struct ThreadPoolOptions
+    {
+        // Number of participating threads, including the calling thread.
+        // 0 selects std::thread::hardware_concurrency().
+        std::size_t threads = 0;
+
+        // Pin worker k to cpus[k % cpus.size()] (or to CPU k when cpus is
+        // empty). Listing only the cores of one NUMA node keeps the pool,
+        // and the pages it first-touches, on that node. Linux only;
+        // elsewhere the request is ignored and pinned() reports false.
+        bool             pin_threads = false;
+        std::vector<int> cpus;
+    };
+
+    // -------------------------------------------------------------------------
+    // ThreadPool
+    //
+    // Fixed set of workers executing parallel_for() jobs. The index range is
+    // split into chunks that are pre-assigned to participants in contiguous
+    // blocks; a participant that drains its own block steals the remaining
+    // chunks of the others. Chunk boundaries depend only on n and grain, so
+    // the partition of work is independent of the thread count.
+    // -------------------------------------------------------------------------
+
+    class ThreadPool
+    {
+    public:
+        explicit ThreadPool(const ThreadPoolOptions& options = ThreadPoolOptions{});
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&)            = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        std::size_t size() const;
+        bool        pinned() const;
+
+        // Calls fn(begin, end) for consecutive sub-ranges of [0, n) of at
+        // most `grain` elements and returns when all have completed. The
+        // calling thread participates. fn must not throw. Calls from
+        // several threads at once are serialized.
+        void parallel_for(
+            std::size_t n,
+            std::size_t grain,
+            const std::function<void(std::size_t, std::size_t)>& fn
+        );
+
+    private:
+        struct alignas(64) Slot
+        {
+            std::atomic<std::size_t> next{0};
+            std::size_t              end = 0;
+        };
+
+        void worker_loop(std::size_t index);
+        void run_chunks(std::size_t index);
+
+        std::size_t              size_;
+        bool                     pinned_ = false;
+        std::vector<std::thread> workers_;
+        std::unique_ptr<Slot[]>  slots_;
+
+        std::mutex              submit_mutex_;
+        std::mutex              mutex_;
+        std::condition_variable wake_;
+        std::condition_variable done_;
+        std::uint64_t           generation_ = 0;
+        std::size_t             finished_   = 0;
+        bool                    stop_       = false;
+
+        const std::function<void(std::size_t, std::size_t)>* fn_ = nullptr;
+        std::size_t n_     = 0;
+        std::size_t grain_ = 1;
+    };
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_THREAD_POOL_HPP
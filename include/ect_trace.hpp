@@ -0,0 +1,217 @@
+#ifndef ECT_SDK_TRACE_HPP
+#define ECT_SDK_TRACE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace ect::sdk
+{
+    class Controller;
+    class ThreadPool;
+
+    namespace detail
+    {
+        class MappedFile;
+    }
+
+    // -------------------------------------------------------------------------
+    // Columnar trace format
+    //
+    // A trace file is a 64-byte header followed by one contiguous column per
+    // recorded quantity, each starting on a 64-byte boundary:
+    //
+    //   offset  size  field
+    //   0       8     magic "ECTTRACE"
+    //   8       4     format version (TRACE_VERSION)
+    //   12      4     column mask (bit i = TraceColumn i present)
+    //   16      8     sample count
+    //   24      40    byte offset of each column (0 when absent)
+    //
+    // Integers and doubles are stored in native (little-endian) byte order.
+    // Column element types:
+    //
+    //   Timestamp   int64   nanoseconds, caller-defined epoch
+    //   Deviation   double  delta fed to the controller
+    //   Target      double
+    //   Output      double  controller output u
+    //   Saturation  int8    -1 at the lower bound, +1 at the upper, 0 otherwise
+    //
+    // Readers map the file and hand out pointers straight into the mapping;
+    // nothing is parsed or copied per sample.
+    // -------------------------------------------------------------------------
+
+    enum class TraceColumn : std::uint32_t
+    {
+        Timestamp = 0,
+        Deviation,
+        Target,
+        Output,
+        Saturation
+    };
+
+    inline constexpr std::size_t   TRACE_COLUMN_COUNT = 5;
+    inline constexpr std::uint32_t TRACE_VERSION      = 1;
+
+    constexpr std::uint32_t trace_column_bit(TraceColumn column)
+    {
+        return std::uint32_t(1) << static_cast<std::uint32_t>(column);
+    }
+
+    inline constexpr std::uint32_t TRACE_ALL_COLUMNS = (std::uint32_t(1) << TRACE_COLUMN_COUNT) - 1;
+
+    const char* trace_column_name(TraceColumn column);
+
+    // One row, used by TraceWriter::append().
+    struct TraceSample
+    {
+        std::int64_t timestamp  = 0;
+        double       deviation  = 0.0;
+        double       target     = 0.0;
+        double       output     = 0.0;
+        std::int8_t  saturation = 0;
+    };
+
+    // -------------------------------------------------------------------------
+    // TraceReader
+    //
+    // Read-only mapping of a trace file. Column accessors return nullptr for
+    // absent columns. Pointers stay valid for the lifetime of the reader.
+    // Throws std::runtime_error if the file cannot be mapped or is not a
+    // well-formed trace (bad magic or version, columns out of bounds).
+    // -------------------------------------------------------------------------
+
+    class TraceReader
+    {
+    public:
+        explicit TraceReader(const std::string& path);
+        ~TraceReader();
+
+        TraceReader(TraceReader&&) noexcept;
+        TraceReader& operator=(TraceReader&&) noexcept;
+
+        std::size_t   samples() const;
+        std::uint32_t columns() const;
+        bool          has(TraceColumn column) const;
+
+        const std::int64_t* timestamp()  const;
+        const double*       deviation()  const;
+        const double*       target()     const;
+        const double*       output()     const;
+        const std::int8_t*  saturation() const;
+
+    private:
+        const void* column(TraceColumn column) const;
+
+        std::unique_ptr<detail::MappedFile> file_;
+        std::size_t                         samples_ = 0;
+        std::uint32_t                       columns_ = 0;
+    };
+
+    // -------------------------------------------------------------------------
+    // TraceWriter
+    //
+    // Creates a trace of fixed capacity and maps it read-write. Rows are
+    // either appended one at a time with append(), or columns are filled in
+    // place through the mutable accessors and published with commit(n).
+    // close() records size() in the header and flushes the mapping; the
+    // destructor does the same but swallows errors. Space for unused
+    // capacity stays in the file.
+    // Throws std::runtime_error on I/O failure.
+    // -------------------------------------------------------------------------
+
+    class TraceWriter
+    {
+    public:
+        TraceWriter(const std::string& path, std::size_t capacity, std::uint32_t columns = TRACE_ALL_COLUMNS);
+        ~TraceWriter();
+
+        TraceWriter(TraceWriter&&) noexcept;
+        TraceWriter& operator=(TraceWriter&&) noexcept;
+
+        std::size_t   capacity() const;
+        std::size_t   size()     const;
+        std::uint32_t columns()  const;
+        bool          has(TraceColumn column) const;
+
+        // Absent columns are nullptr; valid for [0, capacity()).
+        std::int64_t* timestamp();
+        double*       deviation();
+        double*       target();
+        double*       output();
+        std::int8_t*  saturation();
+
+        // Stores the fields of the present columns at row size().
+        // Throws std::length_error when the trace is full.
+        void append(const TraceSample& sample);
+
+        // Marks rows [0, n) as written. Throws std::length_error if
+        // n > capacity().
+        void commit(std::size_t n);
+
+        // Throws std::logic_error after close().
+        void close();
+
+    private:
+        void* column(TraceColumn column);
+
+        std::unique_ptr<detail::MappedFile> file_;
+        std::size_t                         capacity_ = 0;
+        std::size_t                         size_     = 0;
+        std::uint32_t                       columns_  = 0;
+    };
+
+    // -------------------------------------------------------------------------
+    // Replay
+    //
+    // Feeds the deviation column of a recorded trace through a controller
+    // and writes the result into an output trace:
+    //
+    //   output[i]     = Controller::evaluate_batch over deviation[i]
+    //   saturation[i] = its ClampState (-1 below u_min, +1 above u_max,
+    //                   0 otherwise, judged on the pre-clamp value)
+    //
+    // Deviations are read directly from the input mapping and outputs are
+    // written directly into the output mapping, chunk by chunk, so the only
+    // traffic is one streaming read and one streaming write per sample.
+    // Timestamp, deviation and target columns present in both traces are
+    // carried over with one bulk copy per chunk.
+    // -------------------------------------------------------------------------
+
+    struct ReplayOptions
+    {
+        // Samples per chunk (and per parallel task).
+        std::size_t chunk = 65536;
+    };
+
+    struct ReplaySummary
+    {
+        std::size_t samples         = 0;
+        std::size_t saturated_lower = 0;
+        std::size_t saturated_upper = 0;
+        double      max_abs_output  = 0.0;
+    };
+
+    // Results are bit-identical with and without a pool and for any thread
+    // count. On return out.size() == in.samples().
+    // Throws std::invalid_argument if `in` has no deviation column, `out`
+    // has no output column, out.capacity() < in.samples() or chunk == 0.
+    ReplaySummary replay(
+        const Controller&    controller,
+        const TraceReader&   in,
+        TraceWriter&         out,
+        const ReplayOptions& options = ReplayOptions{}
+    );
+
+    ReplaySummary replay(
+        const Controller&    controller,
+        const TraceReader&   in,
+        TraceWriter&         out,
+        const ReplayOptions& options,
+        ThreadPool&          pool
+    );
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_TRACE_HPP
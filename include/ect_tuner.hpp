@@ -0,0 +1,134 @@
+#ifndef ECT_SDK_TUNER_HPP
+#define ECT_SDK_TUNER_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace ect::sdk
+{
+    class PlantModel;
+    class ThreadPool;
+    class TraceReader;
+    struct TargetProfile;
+
+    // -------------------------------------------------------------------------
+    // Offline gain / bound tuning
+    //
+    // Scores candidate parameter sets for the linear pipeline
+    //
+    //   LinearEOperator(alpha), LinearGOperator(gain, u_min, u_max)
+    //
+    // by running every candidate against every scenario in closed loop with
+    // a plant model. All (candidate, scenario) pairs are lanes of one
+    // ControllerBank, so each tick is a single structure-of-arrays batch
+    // evaluation over the lanes rather than a controller object per
+    // candidate. Scores (all lower-is-better):
+    //
+    //   settling_steps   mean over scenarios of the first step after which
+    //                    |delta| stays within max(settling_fraction * |delta_0|,
+    //                    settling_floor) (the run length if never)
+    //   saturation_duty  mean fraction of steps with u at a bound
+    //   noise_gain       mean RMS(u_noisy - u_clean) / RMS(noise), where the
+    //                    noisy run adds options.noise[k] to every deviation
+    //                    (0 when no noise is configured)
+    //
+    // Results are bit-identical with and without a pool and for any thread
+    // count.
+    // -------------------------------------------------------------------------
+
+    struct TuningCandidate
+    {
+        double alpha = 0.8;
+        double gain  = 1.0;
+        double u_min = -1.0;
+        double u_max = 1.0;
+    };
+
+    // target[k] for k in [0, steps); the plant starts at initial_position
+    // with zero velocity.
+    struct TuningScenario
+    {
+        std::vector<double> target;
+        double              initial_position = 0.0;
+    };
+
+    struct TuningOptions
+    {
+        double settling_fraction = 0.02;
+        double settling_floor    = 1e-6;
+
+        // Measurement noise for the noise-sensitivity run; needs at least
+        // as many entries as the scenarios have steps. Empty disables it.
+        std::vector<double> noise;
+
+        // Candidates per parallel task.
+        std::size_t grain = 64;
+    };
+
+    struct TuningScore
+    {
+        double      settling_steps  = 0.0;
+        double      saturation_duty = 0.0;
+        double      noise_gain      = 0.0;
+        std::size_t unsettled       = 0;   // scenarios that never settled
+    };
+
+    struct TuningReport
+    {
+        std::vector<TuningScore> scores;   // one per candidate
+
+        // Candidates no other candidate beats on one score without losing
+        // on another, ordered by settling_steps, then saturation_duty,
+        // then noise_gain.
+        std::vector<std::size_t> pareto;
+    };
+
+    // Every combination of alpha, gain and a symmetric bound [-b, b].
+    std::vector<TuningCandidate> tuning_grid(
+        const std::vector<double>& alphas,
+        const std::vector<double>& gains,
+        const std::vector<double>& bounds
+    );
+
+    // Samples a target profile for `steps` ticks.
+    TuningScenario tuning_scenario(const TargetProfile& target, double initial_position, std::size_t steps);
+
+    // Rebuilds the reference a recorded loop was chasing, assuming it ran
+    // against an integrator plant x += plant_gain * u from x = 0:
+    //
+    //   target[k] = deviation[k] + plant_gain * (output[0] + ... + output[k-1])
+    //
+    // Replaying it against IntegratorPlant(plant_gain) reproduces the
+    // recorded deviations (up to rounding) for the recorded controller and
+    // answers "what would this candidate have done" for the others.
+    // Throws std::invalid_argument without deviation and output columns.
+    TuningScenario tuning_scenario(const TraceReader& trace, double plant_gain = 1.0);
+
+    // The sine mix of examples/noise_injection_loop.cpp, scaled to
+    // `amplitude` (0.05 there).
+    std::vector<double> deterministic_noise(std::size_t steps, double amplitude = 0.05);
+
+    // Throws std::invalid_argument if scenarios is empty, their target
+    // lengths differ, options.noise is non-empty but shorter than the
+    // scenarios, or a candidate has u_min > u_max.
+    TuningReport tune(
+        const std::vector<TuningCandidate>& candidates,
+        const PlantModel&                   plant,
+        const std::vector<TuningScenario>&  scenarios,
+        const TuningOptions&                options = TuningOptions{}
+    );
+
+    TuningReport tune(
+        const std::vector<TuningCandidate>& candidates,
+        const PlantModel&                   plant,
+        const std::vector<TuningScenario>&  scenarios,
+        const TuningOptions&                options,
+        ThreadPool&                         pool
+    );
+
+    // Indices of the non-dominated scores, ordered as in TuningReport.
+    std::vector<std::size_t> pareto_front(const std::vector<TuningScore>& scores);
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_TUNER_HPP
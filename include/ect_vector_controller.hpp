@@ -0,0 +1,111 @@
+#ifndef ECT_SDK_VECTOR_CONTROLLER_HPP
+#define ECT_SDK_VECTOR_CONTROLLER_HPP
+
+#include <array>
+#include <cstddef>
+
+#include "ect_vector_operators.hpp"
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // VectorController
+    //
+    // Component-wise FXI–Δ–E pipeline over n-dimensional deviations:
+    //   u = G(F⁻¹(E(F(Δ))))   with Δ, u ∈ R^n
+    //
+    // The dimension is fixed at construction; all four operators must report
+    // the same dimension (std::invalid_argument otherwise). Like Controller,
+    // operators are held by reference and must outlive the controller.
+    // -------------------------------------------------------------------------
+
+    class VectorController
+    {
+    public:
+        VectorController(
+            const VectorFOperator&    f,
+            const VectorEOperator&    e,
+            const VectorFInvOperator& finv,
+            const VectorGOperator&    g
+        );
+
+        std::size_t dimension() const;
+
+        // Reads dimension() components from delta and writes dimension()
+        // components to u. delta and u may alias exactly. No allocation.
+        void update(const double* delta, double* u) const;
+
+    private:
+        const VectorFOperator&    f_;
+        const VectorEOperator&    e_;
+        const VectorFInvOperator& finv_;
+        const VectorGOperator&    g_;
+
+        std::size_t n_;
+
+        // Set when all operators are the Linear* implementations; the
+        // pipeline then runs as one structure-of-arrays pass.
+        const double* e_gain_ = nullptr;
+        const double* g_gain_ = nullptr;
+        const double* u_min_  = nullptr;
+        const double* u_max_  = nullptr;
+    };
+
+    // -------------------------------------------------------------------------
+    // FixedVectorController<N>
+    //
+    // Compile-time dimension view over VectorController using std::array.
+    // The operator dimensions are checked against N at construction.
+    // -------------------------------------------------------------------------
+
+    template <std::size_t N>
+    class FixedVectorController
+    {
+    public:
+        using Vector = std::array<double, N>;
+
+        FixedVectorController(
+            const VectorFOperator&    f,
+            const VectorEOperator&    e,
+            const VectorFInvOperator& finv,
+            const VectorGOperator&    g
+        );
+
+        static constexpr std::size_t dimension() { return N; }
+
+        Vector update(const Vector& delta) const
+        {
+            Vector u;
+            controller_.update(delta.data(), u.data());
+            return u;
+        }
+
+        void update(const Vector& delta, Vector& u) const
+        {
+            controller_.update(delta.data(), u.data());
+        }
+
+    private:
+        VectorController controller_;
+    };
+
+    namespace detail
+    {
+        void require_vector_dimension(std::size_t expected, std::size_t actual);
+    }
+
+    template <std::size_t N>
+    FixedVectorController<N>::FixedVectorController(
+        const VectorFOperator&    f,
+        const VectorEOperator&    e,
+        const VectorFInvOperator& finv,
+        const VectorGOperator&    g
+    )
+    : controller_(f, e, finv, g)
+    {
+        detail::require_vector_dimension(N, controller_.dimension());
+    }
+
+} // namespace ect::sdk
+
+#endif // ECT_SDK_VECTOR_CONTROLLER_HPP
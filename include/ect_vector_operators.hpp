@@ -0,0 +1,117 @@
+#ifndef ECT_SDK_VECTOR_OPERATORS_HPP
+#define ECT_SDK_VECTOR_OPERATORS_HPP
+
+#include <cstddef>
+#include <vector>
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // Vector operator interfaces (Design Document §3.2)
+    //
+    // A vector operator maps dimension() contiguous components to the same
+    // number of components. Semantics are component-wise; no norms are used.
+    // `in` and `out` may alias exactly (in-place evaluation) and apply()
+    // never allocates.
+    // -------------------------------------------------------------------------
+
+    class VectorFOperator
+    {
+    public:
+        virtual ~VectorFOperator() = default;
+        virtual std::size_t dimension() const = 0;
+        virtual void apply(const double* delta, double* out) const = 0;
+    };
+
+    class VectorEOperator
+    {
+    public:
+        virtual ~VectorEOperator() = default;
+        virtual std::size_t dimension() const = 0;
+        virtual void apply(const double* x, double* out) const = 0;
+    };
+
+    class VectorFInvOperator
+    {
+    public:
+        virtual ~VectorFInvOperator() = default;
+        virtual std::size_t dimension() const = 0;
+        virtual void apply(const double* x, double* out) const = 0;
+    };
+
+    class VectorGOperator
+    {
+    public:
+        virtual ~VectorGOperator() = default;
+        virtual std::size_t dimension() const = 0;
+        virtual void apply(const double* delta, double* out) const = 0;
+    };
+
+    // -------------------------------------------------------------------------
+    // Linear implementations
+    //
+    // Per-axis parameters are stored as separate contiguous arrays
+    // (structure-of-arrays), one entry per axis.
+    // -------------------------------------------------------------------------
+
+    class LinearVectorFOperator final : public VectorFOperator
+    {
+    public:
+        explicit LinearVectorFOperator(std::size_t dimension);
+        std::size_t dimension() const override;
+        void apply(const double* delta, double* out) const override;
+
+    private:
+        std::size_t n_;
+    };
+
+    class LinearVectorEOperator final : public VectorEOperator
+    {
+    public:
+        explicit LinearVectorEOperator(std::vector<double> gains);
+        std::size_t dimension() const override;
+        void apply(const double* x, double* out) const override;
+
+        const double* gains() const;
+
+    private:
+        std::vector<double> k_;
+    };
+
+    class LinearVectorFInvOperator final : public VectorFInvOperator
+    {
+    public:
+        explicit LinearVectorFInvOperator(std::size_t dimension);
+        std::size_t dimension() const override;
+        void apply(const double* x, double* out) const override;
+
+    private:
+        std::size_t n_;
+    };
+
+    class LinearVectorGOperator final : public VectorGOperator
+    {
+    public:
+        // Throws std::invalid_argument if the three arrays differ in length
+        // or if u_min[i] > u_max[i] for any axis.
+        LinearVectorGOperator(
+            std::vector<double> gains,
+            std::vector<double> u_min,
+            std::vector<double> u_max
+        );
+
+        std::size_t dimension() const override;
+        void apply(const double* delta, double* out) const override;
+
+        const double* gains() const;
+        const double* u_min() const;
+        const double* u_max() const;
+
+    private:
+        std::vector<double> k_;
+        std::vector<double> u_min_;
+        std::vector<double> u_max_;
+    };
+}
+
+#endif // ECT_SDK_VECTOR_OPERATORS_HPP
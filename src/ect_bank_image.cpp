@@ -0,0 +1,582 @@
+#include "ect_bank_image.hpp"
+#include "ect_linear_kernel.hpp"
+#include "ect_thread_pool.hpp"
+
+#include "ect_mapped_file.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace ect::sdk
+{
+    namespace
+    {
+        constexpr char        MAGIC[8]    = { 'E', 'C', 'T', 'B', 'A', 'N', 'K', '\0' };
+        constexpr std::size_t HEADER_SIZE = 64;
+
+        struct Header
+        {
+            char          magic[8];
+            std::uint32_t version;
+            std::uint32_t reserved;
+            std::uint64_t groups;
+            std::uint64_t controllers;
+            std::uint64_t table_offset;
+            std::uint64_t reserved_tail[3];
+        };
+
+        struct Record
+        {
+            std::uint64_t begin;
+            std::uint64_t count;
+            std::uint8_t  f;
+            std::uint8_t  e;
+            std::uint8_t  finv;
+            std::uint8_t  g;
+            std::uint32_t reserved;
+            double        f_scale;
+            double        e_params[3];
+            double        finv_scale;
+            double        g_gain;
+            double        g_min;
+            double        g_max;
+        };
+
+        static_assert(sizeof(Header) == HEADER_SIZE, "bank image header layout");
+        static_assert(sizeof(Record) == 88, "bank image record layout");
+
+        Record to_record(const BankGroup& group, std::uint64_t begin)
+        {
+            Record r{};
+            r.begin      = begin;
+            r.count      = group.count;
+            r.f          = static_cast<std::uint8_t>(group.f);
+            r.e          = static_cast<std::uint8_t>(group.e);
+            r.finv       = static_cast<std::uint8_t>(group.finv);
+            r.g          = static_cast<std::uint8_t>(group.g);
+            r.f_scale    = group.f_scale;
+            r.finv_scale = group.finv_scale;
+            r.g_gain     = group.g_gain;
+            r.g_min      = group.g_min;
+            r.g_max      = group.g_max;
+            std::memcpy(r.e_params, group.e_params, sizeof(r.e_params));
+            return r;
+        }
+
+        BankGroup to_group(const Record& r)
+        {
+            BankGroup group;
+            group.count      = r.count;
+            group.f          = static_cast<FKind>(r.f);
+            group.e          = static_cast<EKind>(r.e);
+            group.finv       = static_cast<FInvKind>(r.finv);
+            group.g          = static_cast<GKind>(r.g);
+            group.f_scale    = r.f_scale;
+            group.finv_scale = r.finv_scale;
+            group.g_gain     = r.g_gain;
+            group.g_min      = r.g_min;
+            group.g_max      = r.g_max;
+            std::memcpy(group.e_params, r.e_params, sizeof(group.e_params));
+            return group;
+        }
+
+        Record read_record(const unsigned char* table, std::size_t index)
+        {
+            Record r;
+            std::memcpy(&r, table + index * sizeof(Record), sizeof(Record));
+            return r;
+        }
+
+        // All four stages linear: evaluated straight from the record.
+        bool is_linear(const Record& r)
+        {
+            return (r.f | r.e | r.finv | r.g) == 0;
+        }
+
+        // ---- Text parsing ----
+
+        struct Spec
+        {
+            std::string         name;
+            std::vector<double> params;
+        };
+
+        double parse_number(const std::string& text)
+        {
+            std::size_t used = 0;
+            const double v = std::stod(text, &used);
+            if (used != text.size())
+            {
+                throw std::invalid_argument("bad number '" + text + "'");
+            }
+            return v;
+        }
+
+        Spec parse_spec(const std::string& text)
+        {
+            Spec spec;
+            const std::size_t colon = text.find(':');
+            spec.name = text.substr(0, colon);
+
+            if (colon != std::string::npos)
+            {
+                std::stringstream rest(text.substr(colon + 1));
+                std::string       item;
+                while (std::getline(rest, item, ','))
+                {
+                    spec.params.push_back(parse_number(item));
+                }
+            }
+            return spec;
+        }
+
+        void expect_params(const Spec& s, std::size_t n, const char* stage)
+        {
+            if (s.params.size() != n)
+            {
+                throw std::invalid_argument(std::string(stage) + " operator '" + s.name + "' takes "
+                                            + std::to_string(n) + " parameter(s)");
+            }
+        }
+
+        void set_f(BankGroup& group, const Spec& s)
+        {
+            if      (s.name == "linear")  { expect_params(s, 0, "F"); group.f = FKind::Linear; return; }
+            else if (s.name == "tanh")    group.f = FKind::Tanh;
+            else if (s.name == "asinh")   group.f = FKind::Asinh;
+            else if (s.name == "sigmoid") group.f = FKind::Sigmoid;
+            else throw std::invalid_argument("unknown F operator '" + s.name + "'");
+
+            expect_params(s, 1, "F");
+            group.f_scale = s.params[0];
+        }
+
+        void set_e(BankGroup& group, const Spec& s)
+        {
+            std::size_t n = 0;
+            if      (s.name == "linear")     { group.e = EKind::Linear;     n = 1; }
+            else if (s.name == "saturating") { group.e = EKind::Saturating; n = 2; }
+            else if (s.name == "power")      { group.e = EKind::Power;      n = 3; }
+            else throw std::invalid_argument("unknown E operator '" + s.name + "'");
+
+            expect_params(s, n, "E");
+            for (std::size_t i = 0; i < 3; ++i)
+            {
+                group.e_params[i] = i < n ? s.params[i] : 0.0;
+            }
+        }
+
+        void set_finv(BankGroup& group, const Spec& s)
+        {
+            if      (s.name == "linear")  { expect_params(s, 0, "F^-1"); group.finv = FInvKind::Linear; return; }
+            else if (s.name == "atanh")   group.finv = FInvKind::Atanh;
+            else if (s.name == "sinh")    group.finv = FInvKind::Sinh;
+            else if (s.name == "sigmoid") group.finv = FInvKind::Sigmoid;
+            else throw std::invalid_argument("unknown F^-1 operator '" + s.name + "'");
+
+            expect_params(s, 1, "F^-1");
+            group.finv_scale = s.params[0];
+        }
+
+        void set_g(BankGroup& group, const Spec& s)
+        {
+            if      (s.name == "linear") group.g = GKind::Linear;
+            else if (s.name == "smooth") group.g = GKind::SmoothSaturation;
+            else throw std::invalid_argument("unknown G operator '" + s.name + "'");
+
+            expect_params(s, 3, "G");
+            group.g_gain = s.params[0];
+            group.g_min  = s.params[1];
+            group.g_max  = s.params[2];
+        }
+
+        BankGroup parse_group(std::istringstream& tokens)
+        {
+            BankGroup   group;
+            std::string token;
+            while (tokens >> token)
+            {
+                const std::size_t eq = token.find('=');
+                if (eq == std::string::npos)
+                {
+                    throw std::invalid_argument("expected key=value, got '" + token + "'");
+                }
+
+                const std::string key   = token.substr(0, eq);
+                const std::string value = token.substr(eq + 1);
+
+                if (key == "count")
+                {
+                    std::size_t used = 0;
+                    group.count = std::stoull(value, &used);
+                    if (used != value.size() || value[0] == '-' || group.count == 0)
+                    {
+                        throw std::invalid_argument("bad count '" + value + "' (must be > 0)");
+                    }
+                }
+                else if (key == "f")    set_f(group, parse_spec(value));
+                else if (key == "e")    set_e(group, parse_spec(value));
+                else if (key == "finv") set_finv(group, parse_spec(value));
+                else if (key == "g")    set_g(group, parse_spec(value));
+                else throw std::invalid_argument("unknown key '" + key + "'");
+            }
+
+            make_controller(group);
+            return group;
+        }
+
+        // Throws std::runtime_error unless the record is one the writer
+        // could have produced for controllers [begin, begin + count).
+        void validate_record(const Record& r, std::uint64_t begin, std::size_t index)
+        {
+            const auto where = [index] { return "bank image group " + std::to_string(index); };
+
+            if (r.begin != begin || r.count == 0)
+            {
+                throw std::runtime_error(where() + ": controller range out of order");
+            }
+            if (r.f > static_cast<std::uint8_t>(FKind::Sigmoid)
+                || r.e > static_cast<std::uint8_t>(EKind::Power)
+                || r.finv > static_cast<std::uint8_t>(FInvKind::Sigmoid)
+                || r.g > static_cast<std::uint8_t>(GKind::SmoothSaturation))
+            {
+                throw std::runtime_error(where() + ": unknown operator kind");
+            }
+
+            if (is_linear(r))
+            {
+                if (!(r.g_min <= r.g_max))
+                {
+                    throw std::runtime_error(where() + ": linear G requires u_min <= u_max");
+                }
+                return;
+            }
+
+            try
+            {
+                make_controller(to_group(r));
+            }
+            catch (const std::invalid_argument& ex)
+            {
+                throw std::runtime_error(where() + ": " + ex.what());
+            }
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // BankGroup / BankConfig
+    // -------------------------------------------------------------------------
+
+    InlineController make_controller(const BankGroup& group)
+    {
+        const InlineF f = [&]() -> InlineF {
+            switch (group.f)
+            {
+                case FKind::Linear:  return inline_ops::LinearF{};
+                case FKind::Tanh:    return inline_ops::TanhF(group.f_scale);
+                case FKind::Asinh:   return inline_ops::AsinhF(group.f_scale);
+                case FKind::Sigmoid: return inline_ops::SigmoidF(group.f_scale);
+            }
+            throw std::invalid_argument("make_controller: unknown F kind");
+        }();
+
+        const double* p = group.e_params;
+        const InlineE e = [&]() -> InlineE {
+            switch (group.e)
+            {
+                case EKind::Linear:     return inline_ops::LinearE(p[0]);
+                case EKind::Saturating: return inline_ops::SaturatingE(p[0], p[1]);
+                case EKind::Power:      return inline_ops::PowerE(p[0], p[1], p[2]);
+            }
+            throw std::invalid_argument("make_controller: unknown E kind");
+        }();
+
+        const InlineFInv finv = [&]() -> InlineFInv {
+            switch (group.finv)
+            {
+                case FInvKind::Linear:  return inline_ops::LinearFInv{};
+                case FInvKind::Atanh:   return inline_ops::AtanhFInv(group.finv_scale);
+                case FInvKind::Sinh:    return inline_ops::SinhFInv(group.finv_scale);
+                case FInvKind::Sigmoid: return inline_ops::SigmoidFInv(group.finv_scale);
+            }
+            throw std::invalid_argument("make_controller: unknown F^-1 kind");
+        }();
+
+        const InlineG g = [&]() -> InlineG {
+            switch (group.g)
+            {
+                case GKind::Linear:
+                    if (!(group.g_min <= group.g_max))
+                    {
+                        throw std::invalid_argument("make_controller: linear G requires u_min <= u_max");
+                    }
+                    return inline_ops::LinearG(group.g_gain, group.g_min, group.g_max);
+                case GKind::SmoothSaturation:
+                    return inline_ops::SmoothSaturationG(group.g_gain, group.g_min, group.g_max);
+            }
+            throw std::invalid_argument("make_controller: unknown G kind");
+        }();
+
+        return InlineController(f, e, finv, g);
+    }
+
+    std::size_t BankConfig::size() const
+    {
+        std::size_t n = 0;
+        for (const BankGroup& group : groups)
+        {
+            n += static_cast<std::size_t>(group.count);
+        }
+        return n;
+    }
+
+    BankConfig parse_bank_config(std::istream& in)
+    {
+        BankConfig  config;
+        std::string line;
+        std::size_t number = 0;
+
+        while (std::getline(in, line))
+        {
+            ++number;
+
+            const std::size_t hash = line.find('#');
+            if (hash != std::string::npos) line.erase(hash);
+
+            std::istringstream tokens(line);
+            std::string        keyword;
+            if (!(tokens >> keyword)) continue;
+
+            try
+            {
+                if (keyword != "group")
+                {
+                    throw std::invalid_argument("unknown directive '" + keyword + "'");
+                }
+
+                config.groups.push_back(parse_group(tokens));
+            }
+            catch (const std::exception& ex)
+            {
+                // std::stod / std::stoull report bad input as
+                // invalid_argument or out_of_range with terse messages.
+                throw std::runtime_error("line " + std::to_string(number) + ": " + ex.what());
+            }
+        }
+        return config;
+    }
+
+    BankConfig load_bank_config(const std::string& path)
+    {
+        std::ifstream in(path);
+        if (!in)
+        {
+            throw std::runtime_error(path + ": cannot open bank configuration");
+        }
+
+        try
+        {
+            return parse_bank_config(in);
+        }
+        catch (const std::runtime_error& ex)
+        {
+            throw std::runtime_error(path + ": " + ex.what());
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Image writer
+    // -------------------------------------------------------------------------
+
+    void write_bank_image(const BankConfig& config, const std::string& path)
+    {
+        for (const BankGroup& group : config.groups)
+        {
+            if (group.count == 0)
+            {
+                throw std::invalid_argument("write_bank_image: empty group");
+            }
+            make_controller(group);
+        }
+
+        const std::size_t bytes = HEADER_SIZE + config.groups.size() * sizeof(Record);
+        detail::MappedFile file(path, detail::MappedFile::Mode::Create, bytes);
+        unsigned char*     base = static_cast<unsigned char*>(file.data());
+
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version      = BANK_IMAGE_VERSION;
+        header.groups       = config.groups.size();
+        header.controllers  = config.size();
+        header.table_offset = HEADER_SIZE;
+        std::memcpy(base, &header, HEADER_SIZE);
+
+        std::uint64_t begin = 0;
+        for (std::size_t i = 0; i < config.groups.size(); ++i)
+        {
+            const Record r = to_record(config.groups[i], begin);
+            std::memcpy(base + HEADER_SIZE + i * sizeof(Record), &r, sizeof(Record));
+            begin += r.count;
+        }
+
+        file.close();
+    }
+
+    // -------------------------------------------------------------------------
+    // BankImage
+    // -------------------------------------------------------------------------
+
+    BankImage::BankImage(const std::string& path)
+        : file_(new detail::MappedFile(path, detail::MappedFile::Mode::ReadOnly))
+    {
+        if (file_->size() < HEADER_SIZE)
+        {
+            throw std::runtime_error(path + ": not a bank image (too short)");
+        }
+
+        Header header;
+        std::memcpy(&header, file_->data(), HEADER_SIZE);
+
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        {
+            throw std::runtime_error(path + ": not a bank image (bad magic)");
+        }
+        if (header.version != BANK_IMAGE_VERSION)
+        {
+            throw std::runtime_error(path + ": unsupported bank image version " + std::to_string(header.version));
+        }
+
+        const std::uint64_t size = file_->size();
+        if (header.table_offset < HEADER_SIZE || header.table_offset > size
+            || header.groups > (size - header.table_offset) / sizeof(Record))
+        {
+            throw std::runtime_error(path + ": bank image group table out of bounds");
+        }
+
+        table_ = static_cast<const unsigned char*>(file_->data()) + header.table_offset;
+
+        std::uint64_t begin = 0;
+        for (std::size_t i = 0; i < header.groups; ++i)
+        {
+            const Record r = read_record(table_, i);
+            validate_record(r, begin, i);
+            if (r.count > header.controllers - begin)
+            {
+                throw std::runtime_error(path + ": bank image groups exceed the controller count");
+            }
+            begin += r.count;
+        }
+        if (begin != header.controllers)
+        {
+            throw std::runtime_error(path + ": bank image groups do not cover the controller count");
+        }
+
+        groups_ = static_cast<std::size_t>(header.groups);
+        size_   = static_cast<std::size_t>(header.controllers);
+    }
+
+    BankImage::~BankImage() = default;
+
+    BankImage::BankImage(BankImage&&) noexcept            = default;
+    BankImage& BankImage::operator=(BankImage&&) noexcept = default;
+
+    std::size_t BankImage::size() const
+    {
+        return size_;
+    }
+
+    std::size_t BankImage::groups() const
+    {
+        return groups_;
+    }
+
+    BankGroup BankImage::group(std::size_t index) const
+    {
+        if (index >= groups_)
+        {
+            throw std::out_of_range("BankImage::group: index out of range");
+        }
+        return to_group(read_record(table_, index));
+    }
+
+    std::size_t BankImage::group_begin(std::size_t index) const
+    {
+        if (index >= groups_)
+        {
+            throw std::out_of_range("BankImage::group_begin: index out of range");
+        }
+        return static_cast<std::size_t>(read_record(table_, index).begin);
+    }
+
+    InlineController BankImage::controller(std::size_t index) const
+    {
+        if (index >= size_)
+        {
+            throw std::out_of_range("BankImage::controller: index out of range");
+        }
+        return make_controller(to_group(read_record(table_, find_group(index))));
+    }
+
+    std::size_t BankImage::find_group(std::size_t i) const
+    {
+        // Last group whose first controller is <= i.
+        std::size_t lo = 0;
+        std::size_t hi = groups_;
+        while (hi - lo > 1)
+        {
+            const std::size_t mid = lo + (hi - lo) / 2;
+            if (read_record(table_, mid).begin <= i) lo = mid;
+            else                                     hi = mid;
+        }
+        return lo;
+    }
+
+    void BankImage::evaluate(const double* deltas, double* out) const
+    {
+        evaluate_range(deltas, out, 0, size_);
+    }
+
+    void BankImage::evaluate(
+        const double* deltas,
+        double*       out,
+        ThreadPool&   pool,
+        std::size_t   grain
+    ) const
+    {
+        pool.parallel_for(size_, grain, [&](std::size_t begin, std::size_t end) {
+            evaluate_range(deltas, out, begin, end);
+        });
+    }
+
+    void BankImage::evaluate_range(const double* deltas, double* out, std::size_t begin, std::size_t end) const
+    {
+        if (begin >= end) return;
+
+        // Records were validated on load. Linear groups are evaluated from
+        // the record directly, so banks of one-controller groups do not pay
+        // for a controller per entity; other groups rebuild their
+        // InlineController once per slice.
+        for (std::size_t gi = find_group(begin); gi < groups_ && begin < end; ++gi)
+        {
+            const Record      r    = read_record(table_, gi);
+            const std::size_t last = static_cast<std::size_t>(r.begin + r.count);
+            const std::size_t stop = last < end ? last : end;
+
+            if (is_linear(r))
+            {
+                detail::linear_pipeline(deltas + begin, out + begin, stop - begin,
+                                        r.e_params[0], r.g_gain, r.g_min, r.g_max);
+            }
+            else
+            {
+                make_controller(to_group(r)).update_batch(deltas + begin, out + begin, stop - begin);
+            }
+            begin = stop;
+        }
+    }
+
+} // namespace ect::sdk
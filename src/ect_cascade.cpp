@@ -0,0 +1,294 @@
+#include "ect_cascade.hpp"
+#include "ect_thread_pool.hpp"
+#include "ect_thread_util.hpp"
+
+#include <chrono>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace ect::sdk
+{
+    namespace
+    {
+        using clock = std::chrono::steady_clock;
+    }
+
+    // -------------------------------------------------------------------------
+    // CascadeBuilder
+    // -------------------------------------------------------------------------
+
+    CascadeBuilder::CascadeBuilder(std::size_t inputs)
+        : inputs_(inputs)
+    {
+    }
+
+    std::size_t CascadeBuilder::inputs() const
+    {
+        return inputs_;
+    }
+
+    std::size_t CascadeBuilder::nodes() const
+    {
+        return controllers_.size();
+    }
+
+    std::size_t CascadeBuilder::add_node(const InlineController& controller, double bias)
+    {
+        controllers_.push_back(controller);
+        bias_.push_back(bias);
+        return controllers_.size() - 1;
+    }
+
+    void CascadeBuilder::connect_input(std::size_t input, std::size_t node, double weight)
+    {
+        if (input >= inputs_ || node >= nodes())
+        {
+            throw std::out_of_range("CascadeBuilder::connect_input: unknown input or node");
+        }
+        links_.push_back(Link{ false, input, node, weight });
+    }
+
+    void CascadeBuilder::connect(std::size_t from, std::size_t to, double weight)
+    {
+        if (from >= nodes() || to >= nodes())
+        {
+            throw std::out_of_range("CascadeBuilder::connect: unknown node");
+        }
+        if (from == to)
+        {
+            throw std::invalid_argument("CascadeBuilder::connect: a node cannot feed itself");
+        }
+        links_.push_back(Link{ true, from, to, weight });
+    }
+
+    Cascade CascadeBuilder::compile() const
+    {
+        const std::size_t n = nodes();
+
+        // Kahn's algorithm; the min-heap keeps the schedule deterministic.
+        std::vector<std::size_t>              pending(n, 0);
+        std::vector<std::vector<std::size_t>> downstream(n);
+        for (const Link& link : links_)
+        {
+            if (link.from_node)
+            {
+                ++pending[link.to];
+                downstream[link.from].push_back(link.to);
+            }
+        }
+
+        std::priority_queue<std::size_t, std::vector<std::size_t>, std::greater<std::size_t>> ready;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (pending[i] == 0) ready.push(i);
+        }
+
+        Cascade cascade;
+        cascade.inputs_ = inputs_;
+        while (!ready.empty())
+        {
+            const std::size_t node = ready.top();
+            ready.pop();
+            cascade.order_.push_back(node);
+            for (std::size_t next : downstream[node])
+            {
+                if (--pending[next] == 0) ready.push(next);
+            }
+        }
+        if (cascade.order_.size() != n)
+        {
+            throw std::invalid_argument("CascadeBuilder::compile: the graph has a cycle");
+        }
+
+        // Flatten each node's links, in declaration order, next to its step.
+        for (std::size_t node : cascade.order_)
+        {
+            Cascade::Step step{ node, cascade.terms_.size(), 0, bias_[node], controllers_[node] };
+            for (const Link& link : links_)
+            {
+                if (link.to != node) continue;
+                cascade.terms_.push_back(Cascade::Term{ link.from_node, link.from, link.weight });
+                ++step.term_count;
+            }
+            cascade.steps_.push_back(step);
+        }
+        return cascade;
+    }
+
+    // -------------------------------------------------------------------------
+    // CascadeProfile
+    // -------------------------------------------------------------------------
+
+    CascadeProfile::CascadeProfile(std::size_t nodes)
+        : nodes_(nodes)
+        , histograms_(new instrumentation::Histogram[nodes])
+    {
+    }
+
+    std::size_t CascadeProfile::nodes() const
+    {
+        return nodes_;
+    }
+
+    const instrumentation::Histogram& CascadeProfile::node(std::size_t id) const
+    {
+        if (id >= nodes_)
+        {
+            throw std::out_of_range("CascadeProfile::node: unknown node");
+        }
+        return histograms_[id];
+    }
+
+    instrumentation::Summary CascadeProfile::summary(std::size_t id) const
+    {
+        return instrumentation::summarize(node(id));
+    }
+
+    void CascadeProfile::reset()
+    {
+        for (std::size_t i = 0; i < nodes_; ++i)
+        {
+            histograms_[i].reset();
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Cascade
+    // -------------------------------------------------------------------------
+
+    std::size_t Cascade::inputs() const
+    {
+        return inputs_;
+    }
+
+    std::size_t Cascade::nodes() const
+    {
+        return steps_.size();
+    }
+
+    const std::vector<std::size_t>& Cascade::order() const
+    {
+        return order_;
+    }
+
+    void Cascade::evaluate(const double* inputs, double* outputs) const
+    {
+        for (const Step& step : steps_)
+        {
+            const Term* term = terms_.data() + step.first_term;
+
+            double delta = 0.0;
+            for (std::size_t t = 0; t < step.term_count; ++t)
+            {
+                const double v = term[t].weight * (term[t].from_node ? outputs[term[t].source] : inputs[term[t].source]);
+                delta = t == 0 ? v : delta + v;
+            }
+            if (step.bias != 0.0) delta = delta + step.bias;
+
+            outputs[step.node] = step.controller.update(delta);
+        }
+    }
+
+    void Cascade::evaluate(const double* inputs, double* outputs, CascadeProfile& profile) const
+    {
+        if (profile.nodes() != nodes())
+        {
+            throw std::invalid_argument("Cascade::evaluate: profile size does not match the cascade");
+        }
+        evaluate_block(inputs, outputs, 1, 0, 1, &profile);
+    }
+
+    void Cascade::evaluate_batch(const double* inputs, double* outputs, std::size_t n) const
+    {
+        for (std::size_t begin = 0; begin < n; begin += BLOCK)
+        {
+            evaluate_block(inputs, outputs, n, begin, begin + BLOCK < n ? begin + BLOCK : n, nullptr);
+        }
+    }
+
+    void Cascade::evaluate_batch(const double* inputs, double* outputs, std::size_t n, CascadeProfile& profile) const
+    {
+        if (profile.nodes() != nodes())
+        {
+            throw std::invalid_argument("Cascade::evaluate_batch: profile size does not match the cascade");
+        }
+        for (std::size_t begin = 0; begin < n; begin += BLOCK)
+        {
+            evaluate_block(inputs, outputs, n, begin, begin + BLOCK < n ? begin + BLOCK : n, &profile);
+        }
+    }
+
+    void Cascade::evaluate_batch(
+        const double* inputs,
+        double*       outputs,
+        std::size_t   n,
+        ThreadPool&   pool,
+        std::size_t   grain
+    ) const
+    {
+        const std::size_t blocks = (n + BLOCK - 1) / BLOCK;
+        const std::size_t per    = grain > BLOCK ? (grain + BLOCK - 1) / BLOCK : 1;
+
+        pool.parallel_for(blocks, per, [&](std::size_t first, std::size_t last) {
+            for (std::size_t b = first; b < last; ++b)
+            {
+                const std::size_t begin = b * BLOCK;
+                evaluate_block(inputs, outputs, n, begin, begin + BLOCK < n ? begin + BLOCK : n, nullptr);
+            }
+        });
+    }
+
+    void Cascade::evaluate_block(
+        const double*   inputs,
+        double*         outputs,
+        std::size_t     n,
+        std::size_t     begin,
+        std::size_t     end,
+        CascadeProfile* profile
+    ) const
+    {
+        const std::size_t count = end - begin;
+
+        for (const Step& step : steps_)
+        {
+            const clock::time_point t0 = profile != nullptr ? clock::now() : clock::time_point{};
+
+            // The node's output column doubles as its deviation column;
+            // update_batch() allows in == out.
+            double*     delta = outputs + step.node * n + begin;
+            const Term* term  = terms_.data() + step.first_term;
+
+            if (step.term_count == 0)
+            {
+                for (std::size_t k = 0; k < count; ++k) delta[k] = 0.0;
+            }
+            for (std::size_t t = 0; t < step.term_count; ++t)
+            {
+                const double  w   = term[t].weight;
+                const double* src = (term[t].from_node ? outputs : inputs) + term[t].source * n + begin;
+                if (t == 0)
+                {
+                    for (std::size_t k = 0; k < count; ++k) delta[k] = w * src[k];
+                }
+                else
+                {
+                    for (std::size_t k = 0; k < count; ++k) delta[k] = delta[k] + w * src[k];
+                }
+            }
+            if (step.bias != 0.0)
+            {
+                for (std::size_t k = 0; k < count; ++k) delta[k] = delta[k] + step.bias;
+            }
+
+            step.controller.update_batch(delta, delta, count);
+
+            if (profile != nullptr)
+            {
+                profile->histograms_[step.node].record(detail::ns(t0, clock::now()));
+            }
+        }
+    }
+
+} // namespace ect::sdk
@@ -0,0 +1,659 @@
+#include "ect_contract_verifier.hpp"
+#include "ect_thread_pool.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <mutex>
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    const char* check_name(Check check)
+    {
+        switch (check)
+        {
+        case Check::FDeterministic:          return "F.deterministic";
+        case Check::FMonotonic:              return "F.monotonic";
+        case Check::FOriginContinuity:       return "F.origin_continuity";
+        case Check::EDeterministic:          return "E.deterministic";
+        case Check::ENonExpansive:           return "E.non_expansive";
+        case Check::EStrictContraction:      return "E.strict_contraction";
+        case Check::ESignPreserving:         return "E.sign_preserving";
+        case Check::FInvDeterministic:       return "FInv.deterministic";
+        case Check::FInvMonotonic:           return "FInv.monotonic";
+        case Check::FInvOriginAmplification: return "FInv.origin_amplification";
+        case Check::FInvConsistency:         return "FInv.consistency";
+        case Check::GDeterministic:          return "G.deterministic";
+        case Check::GBounded:                return "G.bounded";
+        case Check::GMonotonic:              return "G.monotonic";
+        case Check::GSignPreserving:         return "G.sign_preserving";
+        case Check::CompositeMonotonic:      return "Composite.monotonic";
+        }
+        return "unknown";
+    }
+
+    bool VerificationReport::passed() const
+    {
+        for (const CheckResult& c : checks)
+        {
+            if (c.violations != 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    namespace
+    {
+        constexpr double INF = std::numeric_limits<double>::infinity();
+        constexpr double NaN = std::numeric_limits<double>::quiet_NaN();
+
+        // Decimal exponents covered by the log-spaced sweep.
+        constexpr int LOG_MIN_EXP = -323;
+        constexpr int LOG_MAX_EXP =  308;
+
+        std::uint64_t splitmix64(std::uint64_t x)
+        {
+            x += 0x9E3779B97F4A7C15ull;
+            x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+            x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+            return x ^ (x >> 31);
+        }
+
+        bool same_bits(double a, double b)
+        {
+            if (std::isnan(a) && std::isnan(b))
+            {
+                return true;
+            }
+            return std::memcmp(&a, &b, sizeof(double)) == 0;
+        }
+
+        // ---------------------------------------------------------------------
+        // Sample space: index -> sample, generated on demand
+        // ---------------------------------------------------------------------
+
+        class SampleSpace
+        {
+        public:
+            SampleSpace(const VerifierOptions& o, double g_lower, double g_upper)
+                : grid_(o.grid_points)
+                , range_(o.range)
+                , per_decade_(o.points_per_decade)
+                , log_side_(o.points_per_decade == 0
+                                ? 0
+                                : o.points_per_decade * std::uint64_t(LOG_MAX_EXP - LOG_MIN_EXP) + 1)
+                , random_(o.random_samples)
+                , seed_(o.seed)
+            {
+                const auto add_with_neighbours = [this](double v) {
+                    edges_.push_back(v);
+                    edges_.push_back(std::nextafter(v, -INF));
+                    edges_.push_back(std::nextafter(v,  INF));
+                };
+
+                edges_.push_back(0.0);
+                edges_.push_back(-0.0);
+
+                for (int k = -1074; k <= 1023; ++k)
+                {
+                    const double p = std::ldexp(1.0, k);
+                    add_with_neighbours(p);
+                    add_with_neighbours(-p);
+                }
+
+                const double dmax = std::numeric_limits<double>::max();
+                edges_.push_back(dmax);
+                edges_.push_back(-dmax);
+
+                for (double v : { g_lower, g_upper })
+                {
+                    if (std::isfinite(v))
+                    {
+                        add_with_neighbours(v);
+                    }
+                }
+                for (double v : o.extra_points)
+                {
+                    if (!std::isnan(v))
+                    {
+                        add_with_neighbours(v);
+                    }
+                }
+                if (o.include_infinities)
+                {
+                    edges_.push_back(-INF);
+                    edges_.push_back(INF);
+                }
+
+                std::sort(edges_.begin(), edges_.end());
+            }
+
+            std::uint64_t size() const
+            {
+                return grid_ + 2 * log_side_ + edges_.size() + random_;
+            }
+
+            double at(std::uint64_t i) const
+            {
+                if (i < grid_)
+                {
+                    if (grid_ == 1)
+                    {
+                        return 0.0;
+                    }
+                    return -range_ + 2.0 * range_ * (static_cast<double>(i) / static_cast<double>(grid_ - 1));
+                }
+                i -= grid_;
+
+                if (i < 2 * log_side_)
+                {
+                    // Negative side in descending magnitude, then positive side.
+                    const bool          negative = i < log_side_;
+                    const std::uint64_t k        = negative ? (log_side_ - 1 - i) : (i - log_side_);
+                    const double        exponent = LOG_MIN_EXP
+                                                 + static_cast<double>(k) / static_cast<double>(per_decade_);
+                    const double        m        = std::pow(10.0, exponent);
+                    return negative ? -m : m;
+                }
+                i -= 2 * log_side_;
+
+                if (i < edges_.size())
+                {
+                    return edges_[static_cast<std::size_t>(i)];
+                }
+                i -= edges_.size();
+
+                const std::uint64_t r = splitmix64(seed_ ^ splitmix64(i));
+                if ((i & 1) == 0)
+                {
+                    std::uint64_t bits = r;
+                    if (((bits >> 52) & 0x7FF) == 0x7FF)
+                    {
+                        bits &= ~(std::uint64_t(1) << 62); // keep it finite
+                    }
+                    double x = 0.0;
+                    std::memcpy(&x, &bits, sizeof(x));
+                    return x;
+                }
+
+                const double u = static_cast<double>(r >> 11) * (1.0 / 9007199254740992.0);
+                return -range_ + 2.0 * range_ * u;
+            }
+
+        private:
+            std::uint64_t       grid_;
+            double              range_;
+            std::uint64_t       per_decade_;
+            std::uint64_t       log_side_;
+            std::vector<double> edges_;
+            std::uint64_t       random_;
+            std::uint64_t       seed_;
+        };
+
+        // ---------------------------------------------------------------------
+        // Per-task accumulation
+        // ---------------------------------------------------------------------
+
+        // Orders counterexamples by magnitude, then value.
+        bool smaller(const Counterexample& a, const Counterexample& b)
+        {
+            const auto mag = [](const Counterexample& c) {
+                double m = std::fabs(c.input);
+                if (!std::isnan(c.partner))
+                {
+                    m = std::max(m, std::fabs(c.partner));
+                }
+                return m;
+            };
+
+            const double ma = mag(a);
+            const double mb = mag(b);
+            if (ma != mb) return ma < mb;
+            if (a.input != b.input) return a.input < b.input;
+            return a.partner < b.partner;
+        }
+
+        struct Accumulator
+        {
+            std::array<CheckResult, CHECK_COUNT> r{};
+
+            CheckResult& operator[](Check c) { return r[static_cast<std::size_t>(c)]; }
+
+            void violation(Check c, const Counterexample& ce)
+            {
+                CheckResult& cr = (*this)[c];
+                ++cr.violations;
+                if (!cr.has_counterexample || smaller(ce, cr.counterexample))
+                {
+                    cr.has_counterexample = true;
+                    cr.counterexample     = ce;
+                }
+            }
+
+            void merge_into(std::array<CheckResult, CHECK_COUNT>& out) const
+            {
+                for (std::size_t i = 0; i < CHECK_COUNT; ++i)
+                {
+                    out[i].evaluated  += r[i].evaluated;
+                    out[i].violations += r[i].violations;
+                    if (r[i].has_counterexample
+                        && (!out[i].has_counterexample || smaller(r[i].counterexample, out[i].counterexample)))
+                    {
+                        out[i].has_counterexample = true;
+                        out[i].counterexample     = r[i].counterexample;
+                    }
+                }
+            }
+
+            // Ordered pair check: out(lo) <= out(hi) for lo < hi.
+            void monotone(Check c, double a, double fa, double b, double fb)
+            {
+                if (std::isnan(a) || std::isnan(b) || a == b)
+                {
+                    return;
+                }
+                if (b < a)
+                {
+                    std::swap(a, b);
+                    std::swap(fa, fb);
+                }
+
+                ++(*this)[c].evaluated;
+                if (!(fa <= fb))
+                {
+                    violation(c, Counterexample{ a, fa, b, fb });
+                }
+            }
+
+            void sign(Check c, double x, double y)
+            {
+                if (std::isnan(x) || x == 0.0)
+                {
+                    return;
+                }
+
+                ++(*this)[c].evaluated;
+                if (!(x > 0.0 ? y >= 0.0 : y <= 0.0))
+                {
+                    violation(c, Counterexample{ x, y });
+                }
+            }
+
+            void origin(Check c, double x, double y, double y0, double radius, double gain)
+            {
+                if (std::isnan(x) || !(std::fabs(x) <= radius))
+                {
+                    return;
+                }
+
+                ++(*this)[c].evaluated;
+                if (!(std::fabs(y - y0) <= gain * std::fabs(x)))
+                {
+                    violation(c, Counterexample{ x, y });
+                }
+            }
+        };
+
+        // ---------------------------------------------------------------------
+        // Chunk evaluation
+        // ---------------------------------------------------------------------
+
+        struct StageBuffers
+        {
+            const double*       in = nullptr;
+            std::vector<double> out;
+            std::vector<double> in_next;
+            std::vector<double> out_next;
+
+            void resize(std::size_t n)
+            {
+                out.resize(n);
+                in_next.resize(n);
+                out_next.resize(n);
+            }
+        };
+
+        struct Buffers
+        {
+            std::vector<double> x;
+            StageBuffers        f, e, finv, g;
+            std::vector<double> c;      // F⁻¹(F(x))
+            std::vector<double> c_next; // F⁻¹(F(next(x)))
+            std::vector<double> u;      // G(F⁻¹(E(F(x))))
+            std::vector<double> u_next; // G(F⁻¹(E(F(next(x)))))
+
+            void resize(std::size_t n)
+            {
+                x.resize(n);
+                f.resize(n);
+                e.resize(n);
+                finv.resize(n);
+                g.resize(n);
+                c.resize(n);
+                c_next.resize(n);
+                u.resize(n);
+                u_next.resize(n);
+            }
+        };
+
+        struct Context
+        {
+            const FOperator&       f;
+            const EOperator&       e;
+            const FInvOperator&    finv;
+            const GOperator&       g;
+            const VerifierOptions& options;
+            const SampleSpace&     space;
+            double                 g_lower;
+            double                 g_upper;
+            double                 f_zero;
+            double                 finv_zero;
+        };
+
+        // Evaluates op on s.in (already set) and on the next double above
+        // each input; checks determinism and monotonicity when requested.
+        // Index 0 is the last sample of the previous task (pair partner only).
+        template <typename Op>
+        void run_stage(
+            const Op&     op,
+            StageBuffers& s,
+            std::size_t   n,
+            Accumulator&  acc,
+            Check         deterministic,
+            const Check*  monotonic
+        )
+        {
+            op.apply_batch(s.in, s.out.data(), n);
+
+            for (std::size_t j = 0; j < n; ++j)
+            {
+                s.in_next[j] = std::nextafter(s.in[j], INF);
+            }
+            op.apply_batch(s.in_next.data(), s.out_next.data(), n);
+
+            for (std::size_t j = 1; j < n; ++j)
+            {
+                if (std::isnan(s.in[j]))
+                {
+                    continue;
+                }
+
+                ++acc[deterministic].evaluated;
+                const double scalar = op.apply(s.in[j]);
+                if (!same_bits(scalar, s.out[j]))
+                {
+                    acc.violation(deterministic, Counterexample{ s.in[j], scalar, NaN, s.out[j] });
+                }
+
+                if (monotonic != nullptr)
+                {
+                    acc.monotone(*monotonic, s.in[j - 1], s.out[j - 1], s.in[j], s.out[j]);
+                    acc.monotone(*monotonic, s.in[j], s.out[j], s.in_next[j], s.out_next[j]);
+                }
+            }
+        }
+
+        // u = G(F⁻¹(E(y))) for y = F(x); u doubles as scratch.
+        void compose(const Context& ctx, const double* y, double* u, std::size_t n)
+        {
+            ctx.e.apply_batch(y, u, n);
+            ctx.finv.apply_batch(u, u, n);
+            ctx.g.apply_batch(u, u, n);
+        }
+
+        void run_chunk(const Context& ctx, std::uint64_t begin, std::uint64_t end, Accumulator& acc)
+        {
+            thread_local Buffers buf;
+
+            const std::size_t n = static_cast<std::size_t>(end - begin) + 1;
+            buf.resize(n);
+
+            buf.x[0] = begin > 0 ? ctx.space.at(begin - 1) : NaN;
+            for (std::size_t j = 1; j < n; ++j)
+            {
+                buf.x[j] = ctx.space.at(begin + j - 1);
+            }
+
+            const bool   propagate = ctx.options.propagate;
+            const double radius    = ctx.options.origin_radius;
+            const double gain      = ctx.options.origin_gain;
+
+            const Check f_mono    = Check::FMonotonic;
+            const Check finv_mono = Check::FInvMonotonic;
+            const Check g_mono    = Check::GMonotonic;
+
+            buf.f.in    = buf.x.data();
+            run_stage(ctx.f, buf.f, n, acc, Check::FDeterministic, &f_mono);
+
+            buf.e.in    = propagate ? buf.f.out.data() : buf.x.data();
+            run_stage(ctx.e, buf.e, n, acc, Check::EDeterministic, nullptr);
+
+            buf.finv.in = propagate ? buf.e.out.data() : buf.x.data();
+            run_stage(ctx.finv, buf.finv, n, acc, Check::FInvDeterministic, &finv_mono);
+
+            buf.g.in    = propagate ? buf.finv.out.data() : buf.x.data();
+            run_stage(ctx.g, buf.g, n, acc, Check::GDeterministic, &g_mono);
+
+            ctx.finv.apply_batch(buf.f.out.data(), buf.c.data(), n);
+            ctx.finv.apply_batch(buf.f.out_next.data(), buf.c_next.data(), n);
+
+            // Composite pairs: x against its predecessor and its next
+            // double. With propagation the G stage already holds u(x).
+            const double* u = buf.g.out.data();
+            if (!propagate)
+            {
+                compose(ctx, buf.f.out.data(), buf.u.data(), n);
+                u = buf.u.data();
+            }
+            compose(ctx, buf.f.out_next.data(), buf.u_next.data(), n);
+
+            for (std::size_t j = 1; j < n; ++j)
+            {
+                // F
+                acc.origin(Check::FOriginContinuity, buf.f.in[j], buf.f.out[j], ctx.f_zero, radius, gain);
+
+                // E
+                const double xe = buf.e.in[j];
+                const double ye = buf.e.out[j];
+                if (!std::isnan(xe))
+                {
+                    ++acc[Check::ENonExpansive].evaluated;
+                    if (!(std::fabs(ye) <= std::fabs(xe)))
+                    {
+                        acc.violation(Check::ENonExpansive, Counterexample{ xe, ye });
+                    }
+
+                    const double ax = std::fabs(xe);
+                    if (ax >= std::numeric_limits<double>::min() && ax <= radius)
+                    {
+                        ++acc[Check::EStrictContraction].evaluated;
+                        if (!(std::fabs(ye) < ax))
+                        {
+                            acc.violation(Check::EStrictContraction, Counterexample{ xe, ye });
+                        }
+                    }
+                }
+                acc.sign(Check::ESignPreserving, xe, ye);
+
+                // F⁻¹
+                acc.origin(Check::FInvOriginAmplification, buf.finv.in[j], buf.finv.out[j],
+                           ctx.finv_zero, radius, gain);
+
+                const double x = buf.x[j];
+                acc.sign(Check::FInvConsistency, x, buf.c[j]);
+                acc.monotone(Check::FInvConsistency, buf.x[j - 1], buf.c[j - 1], x, buf.c[j]);
+                acc.monotone(Check::FInvConsistency, x, buf.c[j], buf.f.in_next[j], buf.c_next[j]);
+
+                // G
+                const double xg = buf.g.in[j];
+                const double yg = buf.g.out[j];
+                if (!std::isnan(xg))
+                {
+                    ++acc[Check::GBounded].evaluated;
+                    if (!(std::isfinite(yg) && yg >= ctx.g_lower && yg <= ctx.g_upper))
+                    {
+                        acc.violation(Check::GBounded, Counterexample{ xg, yg });
+                    }
+                }
+                acc.sign(Check::GSignPreserving, xg, yg);
+
+                // G∘F⁻¹∘E∘F
+                acc.monotone(Check::CompositeMonotonic, buf.x[j - 1], u[j - 1], x, u[j]);
+                acc.monotone(Check::CompositeMonotonic, x, u[j], buf.f.in_next[j], buf.u_next[j]);
+            }
+        }
+
+        // ---------------------------------------------------------------------
+        // Counterexample shrinking
+        // ---------------------------------------------------------------------
+
+        // Given lo < hi with fn(lo) > fn(hi), narrows the pair while keeping
+        // the violation until the two are adjacent doubles.
+        template <typename Fn>
+        void shrink_pair(CheckResult& cr, const Fn& fn)
+        {
+            Counterexample& ce = cr.counterexample;
+            if (!cr.has_counterexample || std::isnan(ce.partner)
+                || !std::isfinite(ce.input) || !std::isfinite(ce.partner)
+                || std::isnan(ce.output) || std::isnan(ce.partner_output))
+            {
+                return;
+            }
+
+            double lo = ce.input,  flo = ce.output;
+            double hi = ce.partner, fhi = ce.partner_output;
+
+            for (int iter = 0; iter < 4096; ++iter)
+            {
+                const double mid = lo / 2.0 + hi / 2.0;
+                if (!(mid > lo && mid < hi))
+                {
+                    break;
+                }
+
+                const double fm = fn(mid);
+                if (std::isnan(fm))
+                {
+                    break;
+                }
+
+                if (flo > fm)
+                {
+                    hi  = mid;
+                    fhi = fm;
+                }
+                else
+                {
+                    lo  = mid;
+                    flo = fm;
+                }
+            }
+
+            ce = Counterexample{ lo, flo, hi, fhi };
+        }
+
+        VerificationReport run(
+            const FOperator&       f,
+            const EOperator&       e,
+            const FInvOperator&    finv,
+            const GOperator&       g,
+            const VerifierOptions& options,
+            ThreadPool*            pool
+        )
+        {
+            if (!(options.range > 0.0) || !(options.origin_radius >= 0.0) || options.grain == 0)
+            {
+                throw std::invalid_argument("verify_contracts: requires range > 0, origin_radius >= 0, grain > 0");
+            }
+            if (!(options.g_lower <= options.g_upper))
+            {
+                throw std::invalid_argument("verify_contracts: g_lower > g_upper");
+            }
+
+            double g_lower = options.g_lower;
+            double g_upper = options.g_upper;
+
+            AffineForm form;
+            if (g_lower == -INF && g_upper == INF && g.affine_form(form))
+            {
+                g_lower = form.lower;
+                g_upper = form.upper;
+            }
+
+            const SampleSpace space(options, g_lower, g_upper);
+
+            const Context ctx{
+                f, e, finv, g, options, space,
+                g_lower, g_upper,
+                f.apply(0.0), finv.apply(0.0)
+            };
+
+            VerificationReport report;
+            report.samples = space.size();
+            report.g_lower = g_lower;
+            report.g_upper = g_upper;
+
+            const std::uint64_t total = space.size();
+
+            if (pool != nullptr)
+            {
+                std::mutex merge_mutex;
+                pool->parallel_for(static_cast<std::size_t>(total), options.grain,
+                    [&](std::size_t begin, std::size_t end) {
+                        Accumulator acc;
+                        run_chunk(ctx, begin, end, acc);
+
+                        std::lock_guard<std::mutex> lock(merge_mutex);
+                        acc.merge_into(report.checks);
+                    });
+            }
+            else
+            {
+                for (std::uint64_t begin = 0; begin < total; begin += options.grain)
+                {
+                    Accumulator acc;
+                    run_chunk(ctx, begin, std::min<std::uint64_t>(begin + options.grain, total), acc);
+                    acc.merge_into(report.checks);
+                }
+            }
+
+            const auto at = [&](Check c) -> CheckResult& { return report.checks[static_cast<std::size_t>(c)]; };
+
+            shrink_pair(at(Check::FMonotonic),    [&](double x) { return f.apply(x); });
+            shrink_pair(at(Check::FInvMonotonic), [&](double x) { return finv.apply(x); });
+            shrink_pair(at(Check::GMonotonic),    [&](double x) { return g.apply(x); });
+            shrink_pair(at(Check::FInvConsistency), [&](double x) { return finv.apply(f.apply(x)); });
+            shrink_pair(at(Check::CompositeMonotonic),
+                        [&](double x) { return g.apply(finv.apply(e.apply(f.apply(x)))); });
+
+            return report;
+        }
+    }
+
+    VerificationReport verify_contracts(
+        const FOperator&       f,
+        const EOperator&       e,
+        const FInvOperator&    finv,
+        const GOperator&       g,
+        const VerifierOptions& options
+    )
+    {
+        return run(f, e, finv, g, options, nullptr);
+    }
+
+    VerificationReport verify_contracts(
+        const FOperator&       f,
+        const EOperator&       e,
+        const FInvOperator&    finv,
+        const GOperator&       g,
+        const VerifierOptions& options,
+        ThreadPool&            pool
+    )
+    {
+        return run(f, e, finv, g, options, &pool);
+    }
+
+} // namespace ect::sdk
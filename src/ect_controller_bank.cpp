@@ -0,0 +1,145 @@
+#include "ect_controller_bank.hpp"
+#include "ect_linear_kernel.hpp"
+#include "ect_thread_pool.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace ect::sdk
+{
+    ControllerBank::ControllerBank(std::size_t size)
+        : alpha_(size, 1.0)
+        , gain_(size, 1.0)
+        , u_min_(size, -1.0)
+        , u_max_(size, 1.0)
+    {
+    }
+
+    ControllerBank::ControllerBank(
+        std::vector<double> alpha,
+        std::vector<double> gain,
+        std::vector<double> u_min,
+        std::vector<double> u_max
+    )
+    : alpha_(std::move(alpha))
+    , gain_(std::move(gain))
+    , u_min_(std::move(u_min))
+    , u_max_(std::move(u_max))
+    {
+        const std::size_t n = alpha_.size();
+
+        if (gain_.size() != n || u_min_.size() != n || u_max_.size() != n)
+        {
+            throw std::invalid_argument("ControllerBank: parameter columns differ in length");
+        }
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (!(u_min_[i] <= u_max_[i]))
+            {
+                throw std::invalid_argument("ControllerBank: u_min > u_max");
+            }
+        }
+    }
+
+    std::size_t ControllerBank::size() const
+    {
+        return alpha_.size();
+    }
+
+    void ControllerBank::set(std::size_t index, double alpha, double gain, double u_min, double u_max)
+    {
+        if (index >= alpha_.size())
+        {
+            throw std::out_of_range("ControllerBank::set: index out of range");
+        }
+        if (!(u_min <= u_max))
+        {
+            throw std::invalid_argument("ControllerBank::set: u_min > u_max");
+        }
+
+        alpha_[index] = alpha;
+        gain_[index]  = gain;
+        u_min_[index] = u_min;
+        u_max_[index] = u_max;
+    }
+
+    const double* ControllerBank::alpha() const { return alpha_.data(); }
+    const double* ControllerBank::gain()  const { return gain_.data(); }
+    const double* ControllerBank::u_min() const { return u_min_.data(); }
+    const double* ControllerBank::u_max() const { return u_max_.data(); }
+
+    void ControllerBank::evaluate(const double* deltas, double* out) const
+    {
+        evaluate_range(deltas, out, 0, alpha_.size());
+    }
+
+    void ControllerBank::evaluate(
+        const double* deltas,
+        double*       out,
+        ThreadPool&   pool,
+        std::size_t   grain
+    ) const
+    {
+        pool.parallel_for(alpha_.size(), grain, [&](std::size_t begin, std::size_t end) {
+            evaluate_range(deltas, out, begin, end);
+        });
+    }
+
+    void ControllerBank::evaluate_range(
+        const double* deltas,
+        double*       out,
+        std::size_t   begin,
+        std::size_t   end
+    ) const
+    {
+        detail::linear_pipeline_soa(
+            deltas + begin,
+            out + begin,
+            end - begin,
+            alpha_.data() + begin,
+            gain_.data()  + begin,
+            u_min_.data() + begin,
+            u_max_.data() + begin
+        );
+    }
+
+    void ControllerBank::evaluate(const double* deltas, double* out, std::int8_t* state) const
+    {
+        evaluate_range(deltas, out, state, 0, alpha_.size());
+    }
+
+    void ControllerBank::evaluate(
+        const double* deltas,
+        double*       out,
+        std::int8_t*  state,
+        ThreadPool&   pool,
+        std::size_t   grain
+    ) const
+    {
+        pool.parallel_for(alpha_.size(), grain, [&](std::size_t begin, std::size_t end) {
+            evaluate_range(deltas, out, state, begin, end);
+        });
+    }
+
+    void ControllerBank::evaluate_range(
+        const double* deltas,
+        double*       out,
+        std::int8_t*  state,
+        std::size_t   begin,
+        std::size_t   end
+    ) const
+    {
+        detail::linear_pipeline_soa_state(
+            deltas + begin,
+            out + begin,
+            state + begin,
+            end - begin,
+            alpha_.data() + begin,
+            gain_.data()  + begin,
+            u_min_.data() + begin,
+            u_max_.data() + begin
+        );
+    }
+
+} // namespace ect::sdk
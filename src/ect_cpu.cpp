@@ -0,0 +1,129 @@
+#include "ect_cpu.hpp"
+#include "ect_dispatch.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define ECT_SDK_HAVE_CPU_SUPPORTS 1
+#endif
+
+namespace ect::sdk
+{
+    namespace
+    {
+        constexpr cpu::Isa ALL[] = { cpu::Isa::Scalar, cpu::Isa::Sse2, cpu::Isa::Avx2, cpu::Isa::Avx512 };
+
+        const detail::KernelTable* table_for(cpu::Isa isa)
+        {
+            switch (isa)
+            {
+            case cpu::Isa::Scalar: return detail::scalar_kernel_table();
+            case cpu::Isa::Sse2:   return detail::sse2_kernel_table();
+            case cpu::Isa::Avx2:   return detail::avx2_kernel_table();
+            case cpu::Isa::Avx512: return detail::avx512_kernel_table();
+            }
+            return nullptr;
+        }
+
+        // Variants compiled with the library's global flags need no check:
+        // the rest of the binary already requires them.
+        bool cpu_has(cpu::Isa isa)
+        {
+#if defined(ECT_SDK_HAVE_CPU_SUPPORTS)
+            __builtin_cpu_init();
+            switch (isa)
+            {
+            case cpu::Isa::Scalar: return true;
+            case cpu::Isa::Sse2:   return __builtin_cpu_supports("sse2");
+            case cpu::Isa::Avx2:   return __builtin_cpu_supports("avx2");
+            case cpu::Isa::Avx512: return __builtin_cpu_supports("avx512f");
+            }
+            return false;
+#else
+            (void)isa;
+            return true;
+#endif
+        }
+
+        cpu::Isa startup_isa()
+        {
+            const char* env = std::getenv("ECT_SDK_ISA");
+            if (env != nullptr)
+            {
+                for (cpu::Isa isa : ALL)
+                {
+                    if (std::strcmp(env, cpu::isa_name(isa)) == 0 && cpu::supported(isa)) return isa;
+                }
+            }
+            return cpu::detected();
+        }
+
+        std::atomic<const detail::KernelTable*>& active_table()
+        {
+            static std::atomic<const detail::KernelTable*> table{ table_for(startup_isa()) };
+            return table;
+        }
+    }
+
+    namespace cpu
+    {
+        const char* isa_name(Isa isa)
+        {
+            switch (isa)
+            {
+            case Isa::Scalar: return "scalar";
+            case Isa::Sse2:   return "sse2";
+            case Isa::Avx2:   return "avx2";
+            case Isa::Avx512: return "avx512";
+            }
+            return "unknown";
+        }
+
+        bool supported(Isa isa)
+        {
+            return table_for(isa) != nullptr && cpu_has(isa);
+        }
+
+        Isa detected()
+        {
+            Isa best = Isa::Scalar;
+            for (Isa isa : ALL)
+            {
+                if (supported(isa)) best = isa;
+            }
+            return best;
+        }
+
+        Isa active()
+        {
+            return detail::active_kernels().isa;
+        }
+
+        void force(Isa isa)
+        {
+            if (!supported(isa))
+            {
+                throw std::invalid_argument(std::string("cpu::force: ") + isa_name(isa) + " is not supported here");
+            }
+            active_table().store(table_for(isa), std::memory_order_release);
+        }
+
+        void reset()
+        {
+            active_table().store(table_for(startup_isa()), std::memory_order_release);
+        }
+    }
+
+    namespace detail
+    {
+        const KernelTable& active_kernels()
+        {
+            return *active_table().load(std::memory_order_acquire);
+        }
+    }
+
+} // namespace ect::sdk
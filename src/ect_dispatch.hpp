@@ -0,0 +1,92 @@
+#ifndef ECT_SDK_DISPATCH_HPP
+#define ECT_SDK_DISPATCH_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ect_cpu.hpp"
+
+// Inline namespace around the inline kernels (ect_simd.hpp, the fast-math
+// kernels and functors, the scalar clamp helpers). Each variant defines its
+// own name before including them, so identically named inline functions
+// compiled with different ISA flags never get merged by the linker.
+#ifndef ECT_SDK_ISA_NS
+#define ECT_SDK_ISA_NS isa_native
+#endif
+
+// -----------------------------------------------------------------------------
+// Run-time kernel dispatch.
+//
+// The batch kernels are compiled once per instruction set (see
+// ect_kernel_variant.hpp and the ect_kernels_*.cpp variants) and collected
+// in one KernelTable per variant. The detail::linear_* entry points and the
+// lane functors of ect_nonlinear_functors.hpp call through the active table,
+// chosen once from CPUID and changeable with cpu::force().
+// -----------------------------------------------------------------------------
+
+namespace ect::sdk::detail
+{
+    // Lane-generic functors with a dispatched batch form. Each functor type
+    // names its slot through a static `kernel` member.
+    enum class LaneKernel : std::size_t
+    {
+        Exp,
+        Expm1,
+        Log,
+        Log1p,
+        Tanh,
+        Atanh,
+        Asinh,
+        Sinh,
+        TanhF,
+        AtanhFInv,
+        AsinhF,
+        SinhFInv,
+        SigmoidF,
+        SigmoidFInv,
+        SaturatingE,
+        PowerE,
+        SmoothSaturationG,
+        Count
+    };
+
+    // `functor` points at the caller's functor object; the variant copies it
+    // into its own (layout-identical) instantiation of the same type.
+    using LaneBatchFn = void (*)(const double* in, double* out, std::size_t n, const void* functor);
+
+    struct KernelTable
+    {
+        cpu::Isa isa;
+
+        void (*linear_pipeline)(const double*, double*, std::size_t, double, double, double, double);
+        void (*linear_pipeline_soa)(const double*, double*, std::size_t,
+                                    const double*, const double*, const double*, const double*);
+        void (*linear_clamp_soa)(const double*, double*, std::size_t,
+                                 const double*, const double*, const double*);
+        void (*linear_clamp_state)(const double*, double*, double*, std::int8_t*, std::size_t,
+                                   double, double, double);
+        void (*linear_pipeline_soa_state)(const double*, double*, std::int8_t*, std::size_t,
+                                          const double*, const double*, const double*, const double*);
+
+        LaneBatchFn lanes[static_cast<std::size_t>(LaneKernel::Count)];
+    };
+
+    // Per-variant tables; nullptr when the variant is not part of this
+    // build (wrong architecture, or the compiler lacks the ISA flags).
+    const KernelTable* scalar_kernel_table();
+    const KernelTable* sse2_kernel_table();
+    const KernelTable* avx2_kernel_table();
+    const KernelTable* avx512_kernel_table();
+
+    // The table selected by cpu::active().
+    const KernelTable& active_kernels();
+
+    // Batch form of a lane functor through the active table.
+    template <typename Fn>
+    inline void dispatch_lanes(const double* in, double* out, std::size_t n, const Fn& fn)
+    {
+        active_kernels().lanes[static_cast<std::size_t>(Fn::kernel)](in, out, n, &fn);
+    }
+}
+
+#endif // ECT_SDK_DISPATCH_HPP
@@ -11,4 +11,16 @@ namespace ect::sdk
     {
         return k_ * x; // alpha * x
     }
+
+    bool LinearEOperator::affine_form(AffineForm& form) const
+    {
+        form       = AffineForm{};
+        form.scale = k_;
+        return true;
+    }
+
+    double LinearEOperator::gain() const
+    {
+        return k_;
+    }
 }
@@ -0,0 +1,341 @@
+#include "ect_executor.hpp"
+#include "ect_sdk.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_thread_util.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <time.h>
+#endif
+
+namespace ect::sdk
+{
+    namespace
+    {
+        // Slow groups re-check the stop flag at least this often while
+        // sleeping; the final sleep still targets the exact release.
+        constexpr std::int64_t STOP_POLL_NS = 50'000'000;
+
+        // Lead time between start() and the first release, so every thread
+        // is created and configured before the common epoch.
+        constexpr std::int64_t START_LEAD_NS = 2'000'000;
+
+        // steady_clock is CLOCK_MONOTONIC on Linux, the clock
+        // clock_nanosleep() sleeps against.
+        std::int64_t now_ns()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        void sleep_until_ns(std::int64_t t)
+        {
+#if defined(__linux__)
+            timespec ts;
+            ts.tv_sec  = static_cast<time_t>(t / 1'000'000'000);
+            ts.tv_nsec = static_cast<long>(t % 1'000'000'000);
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+            {
+            }
+#else
+            std::this_thread::sleep_until(std::chrono::steady_clock::time_point(std::chrono::nanoseconds(t)));
+#endif
+        }
+
+        std::uint64_t elapsed(std::int64_t from, std::int64_t to)
+        {
+            return to > from ? static_cast<std::uint64_t>(to - from) : 0;
+        }
+
+        bool make_realtime(std::thread& t, int priority)
+        {
+#if defined(__linux__)
+            const int lo = sched_get_priority_min(SCHED_FIFO);
+            const int hi = sched_get_priority_max(SCHED_FIFO);
+
+            sched_param param{};
+            param.sched_priority = std::min(std::max(priority, lo), hi);
+            return pthread_setschedparam(t.native_handle(), SCHED_FIFO, &param) == 0;
+#else
+            (void)t;
+            (void)priority;
+            return false;
+#endif
+        }
+
+        bool lock_all_memory()
+        {
+#if defined(__linux__)
+            return mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+#else
+            return false;
+#endif
+        }
+    }
+
+    struct RateExecutor::TaskEntry
+    {
+        std::string                name;
+        double                     rate_hz = 0.0;
+        Task                       task;
+        std::atomic<std::uint64_t> runs{0};
+        instrumentation::Histogram execution;
+    };
+
+    struct RateExecutor::Group
+    {
+        double                  rate_hz   = 0.0;
+        std::int64_t            period_ns = 0;
+        std::vector<TaskEntry*> tasks;
+
+        std::atomic<std::uint64_t> cycles{0};
+        std::atomic<std::uint64_t> misses{0};
+        std::atomic<std::uint64_t> skipped{0};
+        instrumentation::Histogram jitter;
+        instrumentation::Histogram execution;
+    };
+
+    RateExecutor::RateExecutor(const ExecutorOptions& options)
+        : options_(options)
+    {
+    }
+
+    RateExecutor::~RateExecutor()
+    {
+        stop();
+    }
+
+    std::size_t RateExecutor::add_task(const std::string& name, double rate_hz, Task task)
+    {
+        if (!std::isfinite(rate_hz) || !(rate_hz > 0.0) || rate_hz > 1e9)
+        {
+            throw std::invalid_argument("RateExecutor::add_task: rate must be in (0, 1e9] Hz");
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (started_)
+        {
+            throw std::logic_error("RateExecutor::add_task: executor already started");
+        }
+
+        auto entry     = std::make_unique<TaskEntry>();
+        entry->name    = name;
+        entry->rate_hz = rate_hz;
+        entry->task    = std::move(task);
+
+        const std::int64_t period = std::max<std::int64_t>(1, std::llround(1e9 / rate_hz));
+
+        // Groups stay sorted by period, i.e. in rate-monotonic order.
+        auto it = std::lower_bound(groups_.begin(), groups_.end(), period,
+            [](const std::unique_ptr<Group>& g, std::int64_t p) { return g->period_ns < p; });
+        if (it == groups_.end() || (*it)->period_ns != period)
+        {
+            auto group       = std::make_unique<Group>();
+            group->rate_hz   = rate_hz;
+            group->period_ns = period;
+            it = groups_.insert(it, std::move(group));
+        }
+        (*it)->tasks.push_back(entry.get());
+
+        tasks_.push_back(std::move(entry));
+        return tasks_.size() - 1;
+    }
+
+    std::size_t RateExecutor::add_controller(
+        const std::string&          name,
+        double                      rate_hz,
+        const Controller&           controller,
+        std::function<double()>     sense,
+        std::function<void(double)> actuate
+    )
+    {
+        return add_task(name, rate_hz,
+            [&controller, sense = std::move(sense), actuate = std::move(actuate)](std::uint64_t) {
+                actuate(controller.update(sense()));
+            });
+    }
+
+    std::size_t RateExecutor::add_bank(
+        const std::string&    name,
+        double                rate_hz,
+        const ControllerBank& bank,
+        const double*         deltas,
+        double*               out
+    )
+    {
+        return add_task(name, rate_hz, [&bank, deltas, out](std::uint64_t) {
+            bank.evaluate(deltas, out);
+        });
+    }
+
+    void RateExecutor::start()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (started_)
+        {
+            throw std::logic_error("RateExecutor::start: executor already started");
+        }
+        if (tasks_.empty())
+        {
+            throw std::logic_error("RateExecutor::start: no tasks registered");
+        }
+        started_ = true;
+
+        status_               = ExecutorStatus{};
+        status_.memory_locked = options_.lock_memory && lock_all_memory();
+        status_.realtime      = options_.realtime;
+        status_.pinned        = options_.pin_threads;
+
+        const std::int64_t epoch = now_ns() + START_LEAD_NS;
+
+        threads_.reserve(groups_.size());
+        for (std::size_t k = 0; k < groups_.size(); ++k)
+        {
+            Group& group = *groups_[k];
+            threads_.emplace_back([this, &group, epoch] { run_group(group, epoch); });
+
+            if (options_.realtime)
+            {
+                const int priority = options_.base_priority - static_cast<int>(k);
+                status_.realtime = make_realtime(threads_.back(), priority) && status_.realtime;
+            }
+            if (options_.pin_threads)
+            {
+                const int cpu = options_.cpus.empty()
+                    ? static_cast<int>(k)
+                    : options_.cpus[k % options_.cpus.size()];
+                status_.pinned = detail::pin_to_cpu(threads_.back(), cpu) && status_.pinned;
+            }
+        }
+    }
+
+    void RateExecutor::stop()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_.store(true, std::memory_order_release);
+        for (std::thread& t : threads_)
+        {
+            t.join();
+        }
+        threads_.clear();
+    }
+
+    bool RateExecutor::running() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return !threads_.empty();
+    }
+
+    ExecutorStatus RateExecutor::status() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return status_;
+    }
+
+    void RateExecutor::run_group(Group& group, std::int64_t epoch_ns)
+    {
+        const std::int64_t period  = group.period_ns;
+        std::int64_t       release = epoch_ns;
+        std::uint64_t      cycle   = 0;
+
+        for (;;)
+        {
+            for (std::int64_t t = now_ns(); t < release; t = now_ns())
+            {
+                if (stop_.load(std::memory_order_acquire)) return;
+                sleep_until_ns(std::min(release, t + STOP_POLL_NS));
+            }
+            if (stop_.load(std::memory_order_acquire)) return;
+
+            const std::int64_t woke = now_ns();
+            group.jitter.record(elapsed(release, woke));
+
+            std::int64_t t0 = woke;
+            for (TaskEntry* task : group.tasks)
+            {
+                task->task(cycle);
+                const std::int64_t t1 = now_ns();
+                task->execution.record(elapsed(t0, t1));
+                detail::bump(task->runs);
+                t0 = t1;
+            }
+
+            const std::int64_t done = t0;
+            group.execution.record(elapsed(woke, done));
+            detail::bump(group.cycles);
+            ++cycle;
+
+            release += period;
+            if (done > release)
+            {
+                // Missed the implicit deadline; resume at the first release
+                // still in the future instead of running late cycles back
+                // to back.
+                const std::int64_t behind = (done - release) / period + 1;
+                detail::bump(group.misses);
+                detail::bump(group.skipped, static_cast<std::uint64_t>(behind));
+                release += behind * period;
+            }
+        }
+    }
+
+    std::size_t RateExecutor::rate_groups() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return groups_.size();
+    }
+
+    RateGroupStats RateExecutor::group_stats(std::size_t index) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (index >= groups_.size())
+        {
+            throw std::out_of_range("RateExecutor::group_stats: unknown group");
+        }
+
+        const Group&   g = *groups_[index];
+        RateGroupStats s;
+        s.rate_hz         = g.rate_hz;
+        s.period_ns       = static_cast<std::uint64_t>(g.period_ns);
+        s.tasks           = g.tasks.size();
+        s.cycles          = g.cycles.load(std::memory_order_relaxed);
+        s.deadline_misses = g.misses.load(std::memory_order_relaxed);
+        s.skipped         = g.skipped.load(std::memory_order_relaxed);
+        s.jitter          = instrumentation::summarize(g.jitter);
+        s.execution       = instrumentation::summarize(g.execution);
+        return s;
+    }
+
+    std::size_t RateExecutor::tasks() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return tasks_.size();
+    }
+
+    TaskStats RateExecutor::task_stats(std::size_t id) const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (id >= tasks_.size())
+        {
+            throw std::out_of_range("RateExecutor::task_stats: unknown task");
+        }
+
+        const TaskEntry& t = *tasks_[id];
+        TaskStats s;
+        s.name      = t.name;
+        s.rate_hz   = t.rate_hz;
+        s.runs      = t.runs.load(std::memory_order_relaxed);
+        s.execution = instrumentation::summarize(t.execution);
+        return s;
+    }
+
+} // namespace ect::sdk
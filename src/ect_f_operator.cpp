@@ -6,4 +6,10 @@ namespace ect::sdk
     {
         return delta; // kF = 1.0
     }
+
+    bool LinearFOperator::affine_form(AffineForm& form) const
+    {
+        form = AffineForm{}; // identity
+        return true;
+    }
 }
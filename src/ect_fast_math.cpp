@@ -0,0 +1,29 @@
+#include "ect_fast_math.hpp"
+#include "ect_fast_math_kernels.hpp"
+
+namespace ect::sdk::fast_math
+{
+    namespace k = detail::fast_math;
+
+#define ECT_SDK_FAST_MATH_FUNCTION(name, Name)                                   \
+    double name(double x)                                                        \
+    {                                                                            \
+        return k::name(x);                                                       \
+    }                                                                            \
+                                                                                 \
+    void name(const double* in, double* out, std::size_t n)                      \
+    {                                                                            \
+        detail::dispatch_lanes(in, out, n, k::Name{});                           \
+    }
+
+    ECT_SDK_FAST_MATH_FUNCTION(exp, Exp)
+    ECT_SDK_FAST_MATH_FUNCTION(expm1, Expm1)
+    ECT_SDK_FAST_MATH_FUNCTION(log, Log)
+    ECT_SDK_FAST_MATH_FUNCTION(log1p, Log1p)
+    ECT_SDK_FAST_MATH_FUNCTION(tanh, Tanh)
+    ECT_SDK_FAST_MATH_FUNCTION(atanh, Atanh)
+    ECT_SDK_FAST_MATH_FUNCTION(asinh, Asinh)
+    ECT_SDK_FAST_MATH_FUNCTION(sinh, Sinh)
+
+#undef ECT_SDK_FAST_MATH_FUNCTION
+}
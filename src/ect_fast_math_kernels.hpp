@@ -0,0 +1,264 @@
+#ifndef ECT_SDK_FAST_MATH_KERNELS_HPP
+#define ECT_SDK_FAST_MATH_KERNELS_HPP
+
+#include <limits>
+
+#include "ect_dispatch.hpp"
+#include "ect_simd.hpp"
+
+// -----------------------------------------------------------------------------
+// Lane-generic elementary functions (see ect_fast_math.hpp for the public
+// interface and the error bounds). Only +, -, *, /, sqrt, compares and exact
+// bit operations are used, so the scalar and vector instantiations agree bit
+// for bit. Odd functions are evaluated on |x| and get the sign of x back by
+// copysign, which makes sign preservation exact. Every result goes through
+// canonical(): the sign and payload of a NaN depend on operand order, which
+// the compiler may commute differently in each instantiation.
+// -----------------------------------------------------------------------------
+
+namespace ect::sdk::detail
+{
+inline namespace ECT_SDK_ISA_NS
+{
+namespace fast_math
+{
+    using simd::abs;
+    using simd::copysign;
+    using simd::eq;
+    using simd::gt;
+    using simd::lt;
+    using simd::select;
+
+    inline constexpr double LN2_HI   = 6.93147180369123816490e-01; // 0x3FE62E42FEE00000
+    inline constexpr double LN2_LO   = 1.90821492927058770002e-10;
+    inline constexpr double LN2      = 6.93147180559945309417e-01;
+    inline constexpr double LOG2E    = 1.44269504088896338700e+00;
+    inline constexpr double EXP_LO   = -708.0;
+    inline constexpr double EXP_HI   = 7.09782712893383973096e+02;
+    inline constexpr double INF      = std::numeric_limits<double>::infinity();
+    inline constexpr double NAN_     = std::numeric_limits<double>::quiet_NaN();
+    inline constexpr double DBL_MIN_ = 2.2250738585072014e-308;
+
+    // Any NaN lane becomes the default quiet NaN.
+    template <typename L>
+    inline L canonical(L y)
+    {
+        return select(eq(y, y), y, L(NAN_));
+    }
+
+    // exp(x): Cody–Waite reduction x = k*ln2 + r, |r| <= ln2/2, Taylor
+    // polynomial to r^13, scaled by 2^k in two exact steps.
+    template <typename L>
+    inline L exp(L x)
+    {
+        L xc = select(lt(x, L(EXP_LO)), L(EXP_LO), x);
+        xc   = select(gt(xc, L(EXP_HI)), L(EXP_HI), xc);
+
+        const L k = simd::round_int(xc * L(LOG2E));
+        const L r = (xc - k * L(LN2_HI)) - k * L(LN2_LO);
+
+        L p = L(1.0 / 6227020800.0);          // 1/13!
+        p = p * r + L(1.0 / 479001600.0);     // 1/12!
+        p = p * r + L(1.0 / 39916800.0);
+        p = p * r + L(1.0 / 3628800.0);
+        p = p * r + L(1.0 / 362880.0);
+        p = p * r + L(1.0 / 40320.0);
+        p = p * r + L(1.0 / 5040.0);
+        p = p * r + L(1.0 / 720.0);
+        p = p * r + L(1.0 / 120.0);
+        p = p * r + L(1.0 / 24.0);
+        p = p * r + L(1.0 / 6.0);
+        p = p * r + L(0.5);
+        p = p * r + L(1.0);
+        p = p * r + L(1.0);
+
+        // k can reach 1024; 2^(k-1) * 2 stays representable.
+        L y = (p * simd::pow2i(k - L(1.0))) * L(2.0);
+
+        y = select(lt(x, L(EXP_LO)), L(0.0), y);
+        y = select(gt(x, L(EXP_HI)), L(INF), y);
+        return canonical(y);
+    }
+
+    // expm1(x): Taylor polynomial to x^17 for |x| < 0.7, exp(x) - 1 above.
+    template <typename L>
+    inline L expm1(L x)
+    {
+        L q = L(1.0 / 355687428096000.0);     // 1/17!
+        q = q * x + L(1.0 / 20922789888000.0);
+        q = q * x + L(1.0 / 1307674368000.0);
+        q = q * x + L(1.0 / 87178291200.0);
+        q = q * x + L(1.0 / 6227020800.0);
+        q = q * x + L(1.0 / 479001600.0);
+        q = q * x + L(1.0 / 39916800.0);
+        q = q * x + L(1.0 / 3628800.0);
+        q = q * x + L(1.0 / 362880.0);
+        q = q * x + L(1.0 / 40320.0);
+        q = q * x + L(1.0 / 5040.0);
+        q = q * x + L(1.0 / 720.0);
+        q = q * x + L(1.0 / 120.0);
+        q = q * x + L(1.0 / 24.0);
+        q = q * x + L(1.0 / 6.0);
+        q = q * x + L(0.5);
+
+        const L small = x + (x * x) * q;
+        const L large = exp(x) - L(1.0);
+
+        return canonical(select(lt(abs(x), L(0.7)), small, large));
+    }
+
+    // log(x) + k*ln2 + c for finite x > 0 and a correction |c| of at most
+    // an ulp or so: x = m * 2^e with m in [sqrt(1/2), sqrt(2)], f = m - 1
+    // exact, and log(1 + f) = f - w with w = hfsq - s * (hfsq + R),
+    // s = f / (2 + f), R the atanh series in s^2 to s^22. e*ln2_hi + f is
+    // split exactly and only the small terms are rounded into its low part,
+    // so the error of w stays far below the change of the result between
+    // adjacent inputs and the kernel is monotone.
+    template <typename L>
+    inline L log_reduced(L x, L k, L c)
+    {
+        const auto sub = lt(x, L(DBL_MIN_));
+        const L    xs  = select(sub, x * L(18014398509481984.0), x); // 2^54
+
+        L e;
+        L m = simd::split_exponent(xs, e);
+        e = select(sub, e - L(54.0), e) + k;
+
+        const auto big = gt(m, L(1.4142135623730951));
+        m = select(big, m * L(0.5), m);
+        e = select(big, e + L(1.0), e);
+
+        const L f = m - L(1.0);
+        const L s = f / (L(2.0) + f);
+        const L z = s * s;
+
+        L q = L(1.0 / 23.0);
+        q = q * z + L(1.0 / 21.0);
+        q = q * z + L(1.0 / 19.0);
+        q = q * z + L(1.0 / 17.0);
+        q = q * z + L(1.0 / 15.0);
+        q = q * z + L(1.0 / 13.0);
+        q = q * z + L(1.0 / 11.0);
+        q = q * z + L(1.0 / 9.0);
+        q = q * z + L(1.0 / 7.0);
+        q = q * z + L(1.0 / 5.0);
+        q = q * z + L(1.0 / 3.0);
+
+        const L R    = (z * q) * L(2.0);
+        const L hfsq = (L(0.5) * f) * f;
+        const L w    = hfsq - s * (hfsq + R);
+
+        // LN2_HI has 32 significant bits, so e * LN2_HI is exact, and it
+        // is either 0 or larger than |f| (Fast2Sum).
+        const L th = e * L(LN2_HI);
+        const L hi = th + f;
+        const L lo = (th - hi) + f;
+
+        return hi + (lo + ((c + e * L(LN2_LO)) - w));
+    }
+
+    template <typename L>
+    inline L log(L x)
+    {
+        L y = log_reduced(x, L(0.0), L(0.0));
+
+        y = select(eq(x, L(0.0)), L(-INF), y);
+        y = select(lt(x, L(0.0)), L(NAN_), y);
+        y = select(eq(x, L(INF)), L(INF), y);
+        y = select(eq(x, x), y, x); // NaN in, NaN out
+        return canonical(y);
+    }
+
+    // log1p(z) for z >= -1: 1 + z = u + (z - (u - 1)) exactly, and the
+    // second part enters log_reduced() as the correction c.
+    template <typename L>
+    inline L log1p(L z)
+    {
+        const L u = L(1.0) + z;
+        L y = log_reduced(u, L(0.0), (z - (u - L(1.0))) / u);
+
+        y = select(eq(u, L(0.0)), L(-INF), y);
+        y = select(lt(u, L(0.0)), L(NAN_), y);
+        y = select(eq(z, L(INF)), L(INF), y);
+        y = select(eq(z, z), y, z);
+        return canonical(y);
+    }
+
+    template <typename L>
+    inline L tanh(L x)
+    {
+        const L a  = abs(x);
+        const L em = expm1(L(-2.0) * a);
+        return canonical(copysign((-em) / (L(2.0) + em), x));
+    }
+
+    template <typename L>
+    inline L atanh(L x)
+    {
+        const L a = abs(x);
+        return canonical(copysign(L(0.5) * log1p((a + a) / (L(1.0) - a)), x));
+    }
+
+    // asinh(a) = log1p(a + (sqrt(1 + a^2) - 1)), the second term written as
+    // 1 / (r + sqrt(r^2 + r)) with r = 1 / a^2 so that every operation is
+    // monotone in a. Past 2^500, where a^2 would overflow, log(2a) comes
+    // from the same reduction with e + 1; below, the sum is exactly 2a
+    // already, so the two branches agree at the switch.
+    template <typename L>
+    inline L asinh(L x)
+    {
+        const L a = abs(x);
+        const L r = L(1.0) / (a * a);
+
+        const L small = log1p(a + L(1.0) / (r + simd::sqrt(r * r + r)));
+        const L large = log_reduced(a, L(1.0), L(0.0));
+
+        L y = select(gt(a, L(3.273390607896142e150)), large, small); // 2^500
+        y = select(eq(a, L(INF)), L(INF), y);
+        return canonical(copysign(y, x));
+    }
+
+    template <typename L>
+    inline L sinh(L x)
+    {
+        const L a  = abs(x);
+        const L em = expm1(a);
+        const L h  = exp(a * L(0.5));
+
+        const L small = L(0.5) * (em + em / (em + L(1.0)));
+        const L large = (L(0.5) * h) * h;
+
+        return canonical(copysign(select(gt(a, L(22.0)), large, small), x));
+    }
+
+    // |x|^p for p > 0; 0 maps to 0.
+    template <typename L>
+    inline L pow_abs(L x, L p)
+    {
+        return exp(p * log(abs(x)));
+    }
+
+    // Functor form of each function for the dispatched batch entry points
+    // of ect_fast_math.hpp.
+#define ECT_SDK_FAST_MATH_LANES(Name, name)                               \
+    struct Name                                                           \
+    {                                                                     \
+        static constexpr LaneKernel kernel = LaneKernel::Name;            \
+        template <typename L> L operator()(L x) const { return name(x); } \
+    };
+
+    ECT_SDK_FAST_MATH_LANES(Exp, exp)
+    ECT_SDK_FAST_MATH_LANES(Expm1, expm1)
+    ECT_SDK_FAST_MATH_LANES(Log, log)
+    ECT_SDK_FAST_MATH_LANES(Log1p, log1p)
+    ECT_SDK_FAST_MATH_LANES(Tanh, tanh)
+    ECT_SDK_FAST_MATH_LANES(Atanh, atanh)
+    ECT_SDK_FAST_MATH_LANES(Asinh, asinh)
+    ECT_SDK_FAST_MATH_LANES(Sinh, sinh)
+
+#undef ECT_SDK_FAST_MATH_LANES
+} // namespace fast_math
+} // namespace ECT_SDK_ISA_NS
+} // namespace ect::sdk::detail
+
+#endif // ECT_SDK_FAST_MATH_KERNELS_HPP
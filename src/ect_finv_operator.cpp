@@ -6,4 +6,10 @@ namespace ect::sdk
     {
         return x; // kF = 1.0 → x / kF
     }
+
+    bool LinearFInvOperator::affine_form(AffineForm& form) const
+    {
+        form = AffineForm{}; // identity
+        return true;
+    }
 }
@@ -1,7 +1,44 @@
 #include "ect_g_operator.hpp"
+#include "ect_linear_kernel.hpp"
 
 namespace ect::sdk
 {
+    GEvaluation GOperator::evaluate(double delta) const
+    {
+        GEvaluation r;
+        r.u   = apply(delta);
+        r.raw = r.u;
+
+        AffineForm form;
+        if (affine_form(form))
+        {
+            double y = delta;
+            if (form.scale  != 1.0) y = form.scale * y;
+            if (form.offset != 0.0) y = y + form.offset;
+
+            r.raw   = y;
+            r.state = detail::clamp_state(y, form.lower, form.upper);
+        }
+        return r;
+    }
+
+    void GOperator::evaluate_batch(
+        const double* in,
+        double*       u,
+        double*       raw,
+        std::int8_t*  state,
+        std::size_t   n
+    ) const
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const GEvaluation r = evaluate(in[i]);
+            u[i]     = r.u;
+            state[i] = static_cast<std::int8_t>(r.state);
+            if (raw != nullptr) raw[i] = r.raw;
+        }
+    }
+
     LinearGOperator::LinearGOperator(double gain, double u_min, double u_max)
         : k_(gain), u_min_(u_min), u_max_(u_max)
     {
@@ -15,4 +52,48 @@ namespace ect::sdk
         if (u > u_max_) return u_max_;
         return u;
     }
+
+    GEvaluation LinearGOperator::evaluate(double delta) const
+    {
+        GEvaluation r;
+        r.raw   = k_ * delta;
+        r.u     = detail::clamp_scalar(r.raw, u_min_, u_max_);
+        r.state = detail::clamp_state(r.raw, u_min_, u_max_);
+        return r;
+    }
+
+    void LinearGOperator::evaluate_batch(
+        const double* in,
+        double*       u,
+        double*       raw,
+        std::int8_t*  state,
+        std::size_t   n
+    ) const
+    {
+        detail::linear_clamp_state(in, u, raw, state, n, k_, u_min_, u_max_);
+    }
+
+    bool LinearGOperator::affine_form(AffineForm& form) const
+    {
+        form       = AffineForm{};
+        form.scale = k_;
+        form.lower = u_min_;
+        form.upper = u_max_;
+        return true;
+    }
+
+    double LinearGOperator::gain() const
+    {
+        return k_;
+    }
+
+    double LinearGOperator::u_min() const
+    {
+        return u_min_;
+    }
+
+    double LinearGOperator::u_max() const
+    {
+        return u_max_;
+    }
 }
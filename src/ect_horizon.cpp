@@ -0,0 +1,241 @@
+#include "ect_horizon.hpp"
+#include "ect_f_operator.hpp"
+#include "ect_e_operator.hpp"
+#include "ect_finv_operator.hpp"
+#include "ect_g_operator.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    namespace
+    {
+        // Saturated phases at least this long are reported as never ending:
+        // Delta - m * step no longer resolves single steps there, and the
+        // step count would not fit a size_t.
+        constexpr double MAX_PHASE = 4.0e18;
+    }
+
+    HorizonPredictor::HorizonPredictor(double gain, double u_min, double u_max, double plant_gain)
+        : gain_(gain)
+        , u_min_(u_min)
+        , u_max_(u_max)
+        , plant_gain_(plant_gain)
+    {
+        if (gain != 1.0)
+        {
+            scales_[scale_count_++] = gain;
+        }
+        validate();
+    }
+
+    HorizonPredictor::HorizonPredictor(
+        const FOperator&    f,
+        const EOperator&    e,
+        const FInvOperator& finv,
+        const GOperator&    g,
+        double              plant_gain
+    )
+    : plant_gain_(plant_gain)
+    {
+        AffineForm forms[4];
+        if (!f.affine_form(forms[0])    ||
+            !e.affine_form(forms[1])    ||
+            !finv.affine_form(forms[2]) ||
+            !g.affine_form(forms[3]))
+        {
+            throw std::invalid_argument("HorizonPredictor: every operator must report an affine form");
+        }
+
+        for (int s = 0; s < 4; ++s)
+        {
+            if (forms[s].offset != 0.0)
+            {
+                throw std::invalid_argument("HorizonPredictor: operator offsets are not supported");
+            }
+            if (s < 3 && !forms[s].is_unbounded())
+            {
+                throw std::invalid_argument("HorizonPredictor: only G may clamp");
+            }
+            if (forms[s].scale != 1.0)
+            {
+                scales_[scale_count_++] = forms[s].scale;
+                gain_ *= forms[s].scale;
+            }
+        }
+
+        u_min_ = forms[3].lower;
+        u_max_ = forms[3].upper;
+        validate();
+    }
+
+    void HorizonPredictor::validate() const
+    {
+        const double loop_gain = plant_gain_ * gain_;
+        if (!std::isfinite(gain_) || !std::isfinite(plant_gain_) || !(loop_gain > 0.0) || !(loop_gain < 2.0))
+        {
+            throw std::invalid_argument("HorizonPredictor: requires finite gains with 0 < plant_gain * gain < 2");
+        }
+        if (!(u_min_ <= 0.0) || !(u_max_ >= 0.0))
+        {
+            throw std::invalid_argument("HorizonPredictor: requires u_min <= 0 <= u_max");
+        }
+    }
+
+    double HorizonPredictor::gain() const
+    {
+        return gain_;
+    }
+
+    double HorizonPredictor::u_min() const
+    {
+        return u_min_;
+    }
+
+    double HorizonPredictor::u_max() const
+    {
+        return u_max_;
+    }
+
+    double HorizonPredictor::plant_gain() const
+    {
+        return plant_gain_;
+    }
+
+    double HorizonPredictor::ratio() const
+    {
+        return 1.0 - plant_gain_ * gain_;
+    }
+
+    double HorizonPredictor::command(double delta) const
+    {
+        double v = delta;
+        for (std::size_t s = 0; s < scale_count_; ++s)
+        {
+            v = scales_[s] * v;
+        }
+        return v;
+    }
+
+    bool HorizonPredictor::saturated_after(double delta, double step, std::size_t j, bool upper) const
+    {
+        const double v = command(delta - static_cast<double>(j) * step);
+        return upper ? v > u_max_ : v < u_min_;
+    }
+
+    HorizonPrediction HorizonPredictor::predict(double delta0, std::size_t horizon) const
+    {
+        const double r = ratio();
+
+        HorizonPrediction p;
+        double            delta   = delta0;
+        double            sum     = 0.0;
+        std::size_t       k       = 0;
+        bool              reached = false;
+
+        const auto reach = [&](double delta_n, double sum_n) {
+            p.delta        = delta_n;
+            p.cumulative_u = sum_n;
+            reached        = true;
+        };
+
+        if (horizon == 0) reach(delta0, 0.0);
+
+        for (;;)
+        {
+            const double v     = command(delta);
+            const bool   upper = v > u_max_;
+
+            if (upper || v < u_min_)
+            {
+                // Saturated phase: u_k = bound, Delta falls by a constant
+                // step until the command is back inside the bounds (or past
+                // the other one).
+                const double bound = upper ? u_max_ : u_min_;
+                if (bound == 0.0)
+                {
+                    // u = 0 holds Delta where it is.
+                    if (!reached)
+                    {
+                        p.saturated_steps += horizon - k;
+                        reach(delta, sum);
+                    }
+                    p.saturation_end = HorizonPrediction::NEVER;
+                    return p;
+                }
+
+                const double step     = plant_gain_ * bound;
+                const double estimate = std::ceil((v - bound) / (gain_ * step));
+
+                if (!(estimate < MAX_PHASE))
+                {
+                    // The run outlasts any representable horizon (or Delta
+                    // is infinite): saturated through N, and no step count
+                    // can name its end.
+                    if (!reached)
+                    {
+                        const std::size_t take = horizon - k;
+                        p.saturated_steps += take;
+                        reach(delta - static_cast<double>(take) * step, sum + static_cast<double>(take) * bound);
+                    }
+                    p.saturation_end = HorizonPrediction::NEVER;
+                    return p;
+                }
+
+                std::size_t m = 1;
+                if (estimate > 1.0) m = static_cast<std::size_t>(estimate);
+                while (m > 1 && !saturated_after(delta, step, m - 1, upper)) --m;
+                while (saturated_after(delta, step, m, upper)) ++m;
+
+                if (!reached && horizon - k <= m)
+                {
+                    const std::size_t take = horizon - k;
+                    p.saturated_steps += take;
+                    reach(delta - static_cast<double>(take) * step, sum + static_cast<double>(take) * bound);
+                }
+                else if (!reached)
+                {
+                    p.saturated_steps += m;
+                }
+
+                delta = delta - static_cast<double>(m) * step;
+                sum   = sum + static_cast<double>(m) * bound;
+                k    += m;
+
+                p.saturation_end = k;
+                continue;
+            }
+
+            // Unsaturated. With r >= 0 the command shrinks toward 0 on one
+            // side and stays inside [u_min, u_max] for good. With r < 0 it
+            // alternates sign while shrinking, so only the very next step
+            // can overshoot the tighter bound; take that step explicitly.
+            const double next = delta - plant_gain_ * v;
+            if (r < 0.0)
+            {
+                const double w = command(next);
+                if (w > u_max_ || w < u_min_)
+                {
+                    delta = next;
+                    sum   = sum + v;
+                    ++k;
+                    if (!reached && k == horizon) reach(delta, sum);
+                    continue;
+                }
+            }
+            break;
+        }
+
+        if (!reached)
+        {
+            // Geometric phase: Delta_{k+j} = r^j * Delta_k, and the commands
+            // sum to (Delta_k - Delta_N) / plant_gain.
+            const double rm = std::pow(r, static_cast<double>(horizon - k));
+            const double dn = delta * rm;
+            reach(dn, sum + (delta - dn) / plant_gain_);
+        }
+        return p;
+    }
+
+} // namespace ect::sdk
@@ -0,0 +1,65 @@
+#include "ect_hot_parameters.hpp"
+#include "ect_linear_kernel.hpp"
+
+namespace ect::sdk
+{
+    namespace
+    {
+        const LinearParameters& validated(const LinearParameters& p, const char* what)
+        {
+            if (!(p.u_min <= p.u_max))
+            {
+                throw std::invalid_argument(what);
+            }
+            return p;
+        }
+    }
+
+    HotLinearController::Handle::Handle(HotParameters<LinearParameters>::Reader reader)
+        : reader_(std::move(reader))
+    {
+    }
+
+    double HotLinearController::Handle::update(double delta) const
+    {
+        const auto p = reader_.pin();
+        return detail::linear_pipeline_scalar(delta, p->alpha, p->gain, p->u_min, p->u_max);
+    }
+
+    void HotLinearController::Handle::update_batch(const double* deltas, double* out, std::size_t n) const
+    {
+        const auto p = reader_.pin();
+        detail::linear_pipeline(deltas, out, n, p->alpha, p->gain, p->u_min, p->u_max);
+    }
+
+    std::uint64_t HotLinearController::Handle::version() const
+    {
+        return reader_.pin().version();
+    }
+
+    HotLinearController::HotLinearController(const LinearParameters& initial, std::size_t max_handles)
+        : cell_(validated(initial, "HotLinearController: u_min > u_max"), max_handles)
+    {
+    }
+
+    HotLinearController::Handle HotLinearController::attach()
+    {
+        return Handle(cell_.reader());
+    }
+
+    std::uint64_t HotLinearController::retune(const LinearParameters& parameters)
+    {
+        return cell_.publish(validated(parameters, "HotLinearController::retune: u_min > u_max"));
+    }
+
+    LinearParameters HotLinearController::parameters() const
+    {
+        return cell_.load();
+    }
+
+    std::uint64_t HotLinearController::version() const
+    {
+        return cell_.version();
+    }
+
+} // namespace ect::sdk
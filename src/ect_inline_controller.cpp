@@ -0,0 +1,263 @@
+#include "ect_inline_controller.hpp"
+#include "ect_linear_kernel.hpp"
+#include "ect_nonlinear_functors.hpp"
+#include "ect_thread_pool.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    using detail::dispatch_lanes;
+
+    namespace
+    {
+        void require(bool cond, const char* msg)
+        {
+            if (!cond) throw std::invalid_argument(msg);
+        }
+
+        template <typename... Fs>
+        struct Overloaded : Fs...
+        {
+            using Fs::operator()...;
+        };
+
+        template <typename... Fs>
+        Overloaded(Fs...) -> Overloaded<Fs...>;
+
+        // Scalar evaluation of each stage, in the exact arithmetic order of
+        // the operator classes.
+        const auto apply_stage = Overloaded{
+            [](const inline_ops::LinearF&, double x)           { return x; },
+            [](const inline_ops::TanhF& s, double x)           { return detail::TanhF{ s.scale }(x); },
+            [](const inline_ops::AsinhF& s, double x)          { return detail::AsinhF{ s.scale }(x); },
+            [](const inline_ops::SigmoidF& s, double x)        { return detail::SigmoidF{ s.scale }(x); },
+            [](const inline_ops::LinearE& s, double x)         { return s.gain * x; },
+            [](const inline_ops::SaturatingE& s, double x)     { return detail::SaturatingE{ s.alpha_limit, s.limit }(x); },
+            [](const inline_ops::PowerE& s, double x)          { return detail::PowerE{ s.alpha, s.exponent, s.limit }(x); },
+            [](const inline_ops::LinearFInv&, double x)        { return x; },
+            [](const inline_ops::AtanhFInv& s, double x)       { return detail::AtanhFInv{ s.scale }(x); },
+            [](const inline_ops::SinhFInv& s, double x)        { return detail::SinhFInv{ s.scale }(x); },
+            [](const inline_ops::SigmoidFInv& s, double x)     { return detail::SigmoidFInv{ s.scale }(x); },
+            [](const inline_ops::LinearG& s, double x)         { return detail::clamp_scalar(s.gain * x, s.u_min, s.u_max); },
+            [](const inline_ops::SmoothSaturationG& s, double x) { return detail::SmoothSaturationG{ s.gain, s.u_min, s.u_max }(x); },
+            [](const InlineOperator& op, double x)             { return op.apply(x); },
+        };
+
+        void copy_or_keep(const double* in, double* out, std::size_t n)
+        {
+            if (in != out && n > 0) std::memcpy(out, in, n * sizeof(double));
+        }
+
+        // Batch evaluation of each stage; in == out is allowed.
+        const auto apply_stage_batch = Overloaded{
+            [](const inline_ops::LinearF&, const double* in, double* out, std::size_t n) { copy_or_keep(in, out, n); },
+            [](const inline_ops::TanhF& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::TanhF{ s.scale });
+            },
+            [](const inline_ops::AsinhF& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::AsinhF{ s.scale });
+            },
+            [](const inline_ops::SigmoidF& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::SigmoidF{ s.scale });
+            },
+            [](const inline_ops::LinearE& s, const double* in, double* out, std::size_t n)
+            {
+                for (std::size_t i = 0; i < n; ++i) out[i] = s.gain * in[i];
+            },
+            [](const inline_ops::SaturatingE& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::SaturatingE{ s.alpha_limit, s.limit });
+            },
+            [](const inline_ops::PowerE& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::PowerE{ s.alpha, s.exponent, s.limit });
+            },
+            [](const inline_ops::LinearFInv&, const double* in, double* out, std::size_t n) { copy_or_keep(in, out, n); },
+            [](const inline_ops::AtanhFInv& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::AtanhFInv{ s.scale });
+            },
+            [](const inline_ops::SinhFInv& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::SinhFInv{ s.scale });
+            },
+            [](const inline_ops::SigmoidFInv& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::SigmoidFInv{ s.scale });
+            },
+            [](const inline_ops::LinearG& s, const double* in, double* out, std::size_t n)
+            {
+                // 1.0 * x == x, so this is the G clamp alone.
+                detail::linear_pipeline(in, out, n, 1.0, s.gain, s.u_min, s.u_max);
+            },
+            [](const inline_ops::SmoothSaturationG& s, const double* in, double* out, std::size_t n)
+            {
+                dispatch_lanes(in, out, n, detail::SmoothSaturationG{ s.gain, s.u_min, s.u_max });
+            },
+            [](const InlineOperator& op, const double* in, double* out, std::size_t n)
+            {
+                for (std::size_t i = 0; i < n; ++i) out[i] = op.apply(in[i]);
+            },
+        };
+
+        template <typename Variant>
+        double run(const Variant& stage, double x)
+        {
+            return std::visit([x](const auto& s) { return apply_stage(s, x); }, stage);
+        }
+
+        template <typename Variant>
+        void run_batch(const Variant& stage, const double* in, double* out, std::size_t n)
+        {
+            std::visit([&](const auto& s) { apply_stage_batch(s, in, out, n); }, stage);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // inline_ops
+    // -------------------------------------------------------------------------
+
+    namespace inline_ops
+    {
+        TanhF::TanhF(double scale)
+            : scale(scale)
+        {
+            require(scale > 0.0, "inline_ops::TanhF: scale must be > 0");
+        }
+
+        AsinhF::AsinhF(double scale)
+            : scale(scale)
+        {
+            require(scale > 0.0, "inline_ops::AsinhF: scale must be > 0");
+        }
+
+        SigmoidF::SigmoidF(double scale)
+            : scale(scale)
+        {
+            require(scale > 0.0, "inline_ops::SigmoidF: scale must be > 0");
+        }
+
+        SaturatingE::SaturatingE(double alpha, double limit)
+            : alpha_limit(alpha * limit)
+            , limit(limit)
+        {
+            require(alpha > 0.0 && alpha < 1.0, "inline_ops::SaturatingE: alpha must be in (0, 1)");
+            require(limit > 0.0, "inline_ops::SaturatingE: limit must be > 0");
+        }
+
+        PowerE::PowerE(double alpha, double exponent, double limit)
+            : alpha(alpha)
+            , exponent(exponent)
+            , limit(limit)
+        {
+            require(alpha > 0.0 && alpha < 1.0, "inline_ops::PowerE: alpha must be in (0, 1)");
+            require(exponent >= 1.0, "inline_ops::PowerE: exponent must be >= 1");
+            require(limit > 0.0, "inline_ops::PowerE: limit must be > 0");
+        }
+
+        AtanhFInv::AtanhFInv(double scale)
+            : scale(scale)
+        {
+            require(scale > 0.0, "inline_ops::AtanhFInv: scale must be > 0");
+        }
+
+        SinhFInv::SinhFInv(double scale)
+            : scale(scale)
+        {
+            require(scale > 0.0, "inline_ops::SinhFInv: scale must be > 0");
+        }
+
+        SigmoidFInv::SigmoidFInv(double scale)
+            : scale(scale)
+        {
+            require(scale > 0.0, "inline_ops::SigmoidFInv: scale must be > 0");
+        }
+
+        SmoothSaturationG::SmoothSaturationG(double gain, double u_min, double u_max)
+            : gain(gain)
+            , u_min(u_min)
+            , u_max(u_max)
+        {
+            require(gain > 0.0, "inline_ops::SmoothSaturationG: gain must be > 0");
+            require(u_min < 0.0 && u_max > 0.0, "inline_ops::SmoothSaturationG: bounds must satisfy u_min < 0 < u_max");
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // InlineController
+    // -------------------------------------------------------------------------
+
+    InlineController::InlineController()
+        : f_(inline_ops::LinearF{})
+        , e_(inline_ops::LinearE(1.0))
+        , finv_(inline_ops::LinearFInv{})
+        , g_(inline_ops::LinearG(1.0, -1.0, 1.0))
+    {
+    }
+
+    InlineController::InlineController(const InlineF& f, const InlineE& e, const InlineFInv& finv, const InlineG& g)
+        : f_(f)
+        , e_(e)
+        , finv_(finv)
+        , g_(g)
+    {
+    }
+
+    double InlineController::update(double delta) const
+    {
+        const double x_f    = run(f_, delta);
+        const double x_e    = run(e_, x_f);
+        const double x_finv = run(finv_, x_e);
+        return run(g_, x_finv);
+    }
+
+    void InlineController::update_batch(const double* deltas, double* out, std::size_t n) const
+    {
+        const auto* e = std::get_if<inline_ops::LinearE>(&e_);
+        const auto* g = std::get_if<inline_ops::LinearG>(&g_);
+        if (e != nullptr && g != nullptr
+            && std::holds_alternative<inline_ops::LinearF>(f_)
+            && std::holds_alternative<inline_ops::LinearFInv>(finv_))
+        {
+            detail::linear_pipeline(deltas, out, n, e->gain, g->gain, g->u_min, g->u_max);
+            return;
+        }
+
+        run_batch(f_, deltas, out, n);
+        run_batch(e_, out, out, n);
+        run_batch(finv_, out, out, n);
+        run_batch(g_, out, out, n);
+    }
+
+    // -------------------------------------------------------------------------
+    // Fleet evaluation
+    // -------------------------------------------------------------------------
+
+    void update_fleet(const InlineController* controllers, const double* deltas, double* out, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out[i] = controllers[i].update(deltas[i]);
+        }
+    }
+
+    void update_fleet(
+        const InlineController* controllers,
+        const double*           deltas,
+        double*                 out,
+        std::size_t             n,
+        ThreadPool&             pool,
+        std::size_t             grain
+    )
+    {
+        pool.parallel_for(n, grain, [&](std::size_t begin, std::size_t end) {
+            update_fleet(controllers + begin, deltas + begin, out + begin, end - begin);
+        });
+    }
+
+} // namespace ect::sdk
@@ -0,0 +1,266 @@
+#include "ect_instrumentation.hpp"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ect::sdk::instrumentation
+{
+    namespace
+    {
+        using Block = std::array<Histogram, STAGE_COUNT>;
+
+        // Blocks are owned by the registry rather than by the thread so that
+        // samples from exited threads remain visible to snapshot().
+        struct Registry
+        {
+            std::mutex                          mutex;
+            std::vector<std::unique_ptr<Block>> blocks;
+        };
+
+        Registry& registry()
+        {
+            static Registry r;
+            return r;
+        }
+
+        unsigned highest_bit(std::uint64_t v)
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return 63u - static_cast<unsigned>(__builtin_clzll(v));
+#else
+            unsigned b = 0;
+            while (v >>= 1)
+            {
+                ++b;
+            }
+            return b;
+#endif
+        }
+    }
+
+    const char* stage_name(Stage stage)
+    {
+        switch (stage)
+        {
+        case Stage::F:      return "F";
+        case Stage::E:      return "E";
+        case Stage::FInv:   return "FInv";
+        case Stage::G:      return "G";
+        case Stage::Update: return "update";
+        }
+        return "unknown";
+    }
+
+    // -------------------------------------------------------------------------
+    // Histogram
+    // -------------------------------------------------------------------------
+
+    Histogram::Histogram()
+    {
+        reset();
+    }
+
+    void Histogram::reset()
+    {
+        for (auto& c : counts_)
+        {
+            c.store(0, std::memory_order_relaxed);
+        }
+        count_.store(0, std::memory_order_relaxed);
+        sum_.store(0, std::memory_order_relaxed);
+        max_.store(0, std::memory_order_relaxed);
+        min_.store(std::numeric_limits<std::uint64_t>::max(), std::memory_order_relaxed);
+    }
+
+    void Histogram::merge_into(Histogram& other) const
+    {
+        for (std::size_t i = 0; i < BUCKETS; ++i)
+        {
+            const std::uint64_t c = counts_[i].load(std::memory_order_relaxed);
+            if (c != 0)
+            {
+                other.counts_[i].fetch_add(c, std::memory_order_relaxed);
+            }
+        }
+        other.count_.fetch_add(count(), std::memory_order_relaxed);
+        other.sum_.fetch_add(sum_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+        if (max() > other.max_.load(std::memory_order_relaxed))
+        {
+            other.max_.store(max(), std::memory_order_relaxed);
+        }
+        const std::uint64_t lo = min_.load(std::memory_order_relaxed);
+        if (lo < other.min_.load(std::memory_order_relaxed))
+        {
+            other.min_.store(lo, std::memory_order_relaxed);
+        }
+    }
+
+    std::uint64_t Histogram::min() const
+    {
+        return count() == 0 ? 0 : min_.load(std::memory_order_relaxed);
+    }
+
+    double Histogram::mean() const
+    {
+        const std::uint64_t n = count();
+        return n == 0 ? 0.0
+                      : static_cast<double>(sum_.load(std::memory_order_relaxed)) / static_cast<double>(n);
+    }
+
+    std::uint64_t Histogram::quantile(double q) const
+    {
+        // Derive the total from the buckets so a concurrent writer cannot
+        // leave the walk short of its target rank.
+        std::uint64_t total = 0;
+        for (const auto& c : counts_)
+        {
+            total += c.load(std::memory_order_relaxed);
+        }
+        if (total == 0)
+        {
+            return 0;
+        }
+
+        q = (q < 0.0) ? 0.0 : (q > 1.0 ? 1.0 : q);
+        std::uint64_t rank = static_cast<std::uint64_t>(std::ceil(q * static_cast<double>(total)));
+        if (rank == 0)
+        {
+            rank = 1;
+        }
+
+        std::uint64_t seen = 0;
+        for (std::size_t i = 0; i < BUCKETS; ++i)
+        {
+            seen += counts_[i].load(std::memory_order_relaxed);
+            if (seen >= rank)
+            {
+                const std::uint64_t upper = bucket_upper(i);
+                const std::uint64_t top   = max();
+                return (top != 0 && upper > top) ? top : upper;
+            }
+        }
+        return max();
+    }
+
+    std::size_t Histogram::bucket_of(std::uint64_t ns)
+    {
+        if (ns < SUB_BUCKETS)
+        {
+            return static_cast<std::size_t>(ns);
+        }
+
+        unsigned e = highest_bit(ns);
+        if (e > MAX_EXPONENT)
+        {
+            return BUCKETS - 1;
+        }
+
+        const std::uint64_t mantissa = (ns >> (e - SUB_BITS)) & (SUB_BUCKETS - 1);
+        return static_cast<std::size_t>(SUB_BUCKETS + (e - SUB_BITS) * SUB_BUCKETS + mantissa);
+    }
+
+    std::uint64_t Histogram::bucket_lower(std::size_t index)
+    {
+        if (index < SUB_BUCKETS)
+        {
+            return index;
+        }
+
+        const std::uint64_t k = index - SUB_BUCKETS;
+        const std::uint64_t e = k / SUB_BUCKETS + SUB_BITS;
+        const std::uint64_t m = k % SUB_BUCKETS;
+        return (SUB_BUCKETS + m) << (e - SUB_BITS);
+    }
+
+    std::uint64_t Histogram::bucket_upper(std::size_t index)
+    {
+        if (index < SUB_BUCKETS)
+        {
+            return index;
+        }
+        if (index == BUCKETS - 1)
+        {
+            return std::numeric_limits<std::uint64_t>::max();
+        }
+
+        const std::uint64_t k = index - SUB_BUCKETS;
+        const std::uint64_t e = k / SUB_BUCKETS + SUB_BITS;
+        return bucket_lower(index) + (std::uint64_t(1) << (e - SUB_BITS)) - 1;
+    }
+
+    // -------------------------------------------------------------------------
+    // Registry / snapshot
+    // -------------------------------------------------------------------------
+
+    namespace detail
+    {
+        std::array<Histogram, STAGE_COUNT>& thread_histograms()
+        {
+            thread_local Block* block = nullptr;
+            if (block == nullptr)
+            {
+                Registry& r = registry();
+                std::lock_guard<std::mutex> lock(r.mutex);
+                r.blocks.push_back(std::make_unique<Block>());
+                block = r.blocks.back().get();
+            }
+            return *block;
+        }
+    }
+
+    Summary summarize(const Histogram& h)
+    {
+        Summary out;
+        out.count   = h.count();
+        out.min_ns  = h.min();
+        out.p50_ns  = h.quantile(0.50);
+        out.p99_ns  = h.quantile(0.99);
+        out.p999_ns = h.quantile(0.999);
+        out.max_ns  = h.max();
+        out.mean_ns = h.mean();
+        return out;
+    }
+
+    Snapshot snapshot()
+    {
+        const auto merged = std::make_unique<Block>();
+        Snapshot   snap;
+
+        {
+            Registry& r = registry();
+            std::lock_guard<std::mutex> lock(r.mutex);
+            snap.threads = r.blocks.size();
+            for (const auto& block : r.blocks)
+            {
+                for (std::size_t s = 0; s < STAGE_COUNT; ++s)
+                {
+                    (*block)[s].merge_into((*merged)[s]);
+                }
+            }
+        }
+
+        for (std::size_t s = 0; s < STAGE_COUNT; ++s)
+        {
+            snap.stages[s] = summarize((*merged)[s]);
+        }
+        return snap;
+    }
+
+    void reset()
+    {
+        Registry& r = registry();
+        std::lock_guard<std::mutex> lock(r.mutex);
+        for (const auto& block : r.blocks)
+        {
+            for (auto& h : *block)
+            {
+                h.reset();
+            }
+        }
+    }
+
+} // namespace ect::sdk::instrumentation
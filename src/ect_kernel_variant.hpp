@@ -0,0 +1,281 @@
+#ifndef ECT_SDK_KERNEL_VARIANT_HPP
+#define ECT_SDK_KERNEL_VARIANT_HPP
+
+// -----------------------------------------------------------------------------
+// Body of one kernel variant. Included exactly once by each ect_kernels_*.cpp,
+// which first defines
+//
+//   ECT_SDK_ISA_NS      a namespace name unique to the variant
+//   ECT_SDK_SIMD_LIMIT  the widest lane it may use (1, 2, 4, 8)
+//
+// and is compiled with the matching ISA flags (and -ffp-contract=off, so
+// no a * b + c is fused on FMA-capable targets). The lanes are written
+// against ect_simd.hpp only; the arithmetic order is the scalar one, which
+// is what makes every variant bit-identical.
+// -----------------------------------------------------------------------------
+
+#include <cstring>
+#include <type_traits>
+
+#include "ect_dispatch.hpp"
+#include "ect_linear_kernel.hpp"
+#include "ect_nonlinear_functors.hpp"
+#include "ect_simd.hpp"
+
+namespace ect::sdk::detail
+{
+inline namespace ECT_SDK_ISA_NS
+{
+    namespace
+    {
+#if ECT_SDK_SIMD_WIDTH > 1
+        using simd::Lane;
+        using simd::Mask;
+
+        constexpr std::size_t W = ECT_SDK_SIMD_WIDTH;
+
+        inline Lane load(const double* p)
+        {
+            return simd::load(p, static_cast<Lane*>(nullptr));
+        }
+
+        // Same priority as LinearGOperator: u < u_min wins over u > u_max;
+        // NaN compares false and passes.
+        inline Lane clamp(Lane u, Mask lt, Mask gt, Lane vmin, Lane vmax)
+        {
+            return simd::select(lt, vmin, simd::select(gt, vmax, u));
+        }
+
+        inline Lane clamp(Lane u, Lane vmin, Lane vmax)
+        {
+            return clamp(u, simd::lt(u, vmin), simd::gt(u, vmax), vmin, vmax);
+        }
+
+        // Lane masks (bit j = lane j) to packed int8 ClampStates. The two
+        // masks are made disjoint first so the byte patterns can be OR-ed.
+        constexpr std::uint64_t byte_mask(unsigned bits, std::uint64_t byte)
+        {
+            std::uint64_t packed = 0;
+            for (unsigned j = 0; j < W; ++j)
+            {
+                if ((bits >> j) & 1u) packed |= byte << (8 * j);
+            }
+            return packed;
+        }
+
+        inline void store_states(std::int8_t* state, Mask lt, Mask gt)
+        {
+            const unsigned      lt_bits = simd::mask_bits(lt);
+            const unsigned      gt_bits = simd::mask_bits(gt);
+            const std::uint64_t packed  = byte_mask(lt_bits, 0xFFu) | byte_mask(gt_bits & ~lt_bits, 0x01u);
+
+            // Lane j goes to state[j] regardless of host byte order.
+            for (std::size_t j = 0; j < W; ++j)
+            {
+                state[j] = static_cast<std::int8_t>(static_cast<std::uint8_t>(packed >> (8 * j)));
+            }
+        }
+#endif
+
+        void pipeline(
+            const double* in,
+            double*       out,
+            std::size_t   n,
+            double        e_gain,
+            double        g_gain,
+            double        u_min,
+            double        u_max
+        )
+        {
+            std::size_t i = 0;
+
+#if ECT_SDK_SIMD_WIDTH > 1
+            const Lane ve(e_gain), vg(g_gain), vmin(u_min), vmax(u_max);
+            for (; i + W <= n; i += W)
+            {
+                simd::store(out + i, clamp(vg * (ve * load(in + i)), vmin, vmax));
+            }
+#endif
+
+            for (; i < n; ++i)
+            {
+                out[i] = linear_pipeline_scalar(in[i], e_gain, g_gain, u_min, u_max);
+            }
+        }
+
+        void pipeline_soa(
+            const double* in,
+            double*       out,
+            std::size_t   n,
+            const double* e_gain,
+            const double* g_gain,
+            const double* u_min,
+            const double* u_max
+        )
+        {
+            std::size_t i = 0;
+
+#if ECT_SDK_SIMD_WIDTH > 1
+            for (; i + W <= n; i += W)
+            {
+                const Lane u = load(g_gain + i) * (load(e_gain + i) * load(in + i));
+                simd::store(out + i, clamp(u, load(u_min + i), load(u_max + i)));
+            }
+#endif
+
+            for (; i < n; ++i)
+            {
+                out[i] = linear_pipeline_scalar(in[i], e_gain[i], g_gain[i], u_min[i], u_max[i]);
+            }
+        }
+
+        void clamp_soa(
+            const double* in,
+            double*       out,
+            std::size_t   n,
+            const double* g_gain,
+            const double* u_min,
+            const double* u_max
+        )
+        {
+            std::size_t i = 0;
+
+#if ECT_SDK_SIMD_WIDTH > 1
+            for (; i + W <= n; i += W)
+            {
+                const Lane u = load(g_gain + i) * load(in + i);
+                simd::store(out + i, clamp(u, load(u_min + i), load(u_max + i)));
+            }
+#endif
+
+            for (; i < n; ++i)
+            {
+                out[i] = clamp_scalar(g_gain[i] * in[i], u_min[i], u_max[i]);
+            }
+        }
+
+        void clamp_with_state(
+            const double* in,
+            double*       out,
+            double*       raw,
+            std::int8_t*  state,
+            std::size_t   n,
+            double        g_gain,
+            double        u_min,
+            double        u_max
+        )
+        {
+            std::size_t i = 0;
+
+#if ECT_SDK_SIMD_WIDTH > 1
+            const Lane vg(g_gain), vmin(u_min), vmax(u_max);
+            for (; i + W <= n; i += W)
+            {
+                const Lane u = vg * load(in + i);
+                if (raw != nullptr) simd::store(raw + i, u);
+
+                const Mask lt = simd::lt(u, vmin);
+                const Mask gt = simd::gt(u, vmax);
+                simd::store(out + i, clamp(u, lt, gt, vmin, vmax));
+                store_states(state + i, lt, gt);
+            }
+#endif
+
+            for (; i < n; ++i)
+            {
+                const double u = g_gain * in[i];
+                if (raw != nullptr) raw[i] = u;
+                out[i]   = clamp_scalar(u, u_min, u_max);
+                state[i] = static_cast<std::int8_t>(clamp_state(u, u_min, u_max));
+            }
+        }
+
+        void pipeline_soa_state(
+            const double* in,
+            double*       out,
+            std::int8_t*  state,
+            std::size_t   n,
+            const double* e_gain,
+            const double* g_gain,
+            const double* u_min,
+            const double* u_max
+        )
+        {
+            std::size_t i = 0;
+
+#if ECT_SDK_SIMD_WIDTH > 1
+            for (; i + W <= n; i += W)
+            {
+                const Lane u    = load(g_gain + i) * (load(e_gain + i) * load(in + i));
+                const Lane vmin = load(u_min + i);
+                const Lane vmax = load(u_max + i);
+
+                const Mask lt = simd::lt(u, vmin);
+                const Mask gt = simd::gt(u, vmax);
+                simd::store(out + i, clamp(u, lt, gt, vmin, vmax));
+                store_states(state + i, lt, gt);
+            }
+#endif
+
+            for (; i < n; ++i)
+            {
+                const double u = g_gain[i] * (e_gain[i] * in[i]);
+                out[i]   = clamp_scalar(u, u_min[i], u_max[i]);
+                state[i] = static_cast<std::int8_t>(clamp_state(u, u_min[i], u_max[i]));
+            }
+        }
+
+        // The caller's functor is this variant's Fn compiled in another
+        // inline namespace: same members, same layout.
+        template <typename Fn>
+        void lanes(const double* in, double* out, std::size_t n, const void* functor)
+        {
+            static_assert(std::is_trivially_copyable_v<Fn>, "lane functors are passed by bytes");
+
+            Fn fn;
+            std::memcpy(static_cast<void*>(&fn), functor, sizeof(Fn));
+            simd::for_each_lane(in, out, n, fn);
+        }
+
+        template <typename... Fns>
+        void add_lanes(KernelTable& table)
+        {
+            ((table.lanes[static_cast<std::size_t>(Fns::kernel)] = &lanes<Fns>), ...);
+        }
+
+        KernelTable make_table()
+        {
+            KernelTable table{};
+#if ECT_SDK_SIMD_WIDTH == 8
+            table.isa = cpu::Isa::Avx512;
+#elif ECT_SDK_SIMD_WIDTH == 4
+            table.isa = cpu::Isa::Avx2;
+#elif ECT_SDK_SIMD_WIDTH == 2
+            table.isa = cpu::Isa::Sse2;
+#else
+            table.isa = cpu::Isa::Scalar;
+#endif
+            table.linear_pipeline           = &pipeline;
+            table.linear_pipeline_soa       = &pipeline_soa;
+            table.linear_clamp_soa          = &clamp_soa;
+            table.linear_clamp_state        = &clamp_with_state;
+            table.linear_pipeline_soa_state = &pipeline_soa_state;
+
+            add_lanes<fast_math::Exp, fast_math::Expm1, fast_math::Log, fast_math::Log1p,
+                      fast_math::Tanh, fast_math::Atanh, fast_math::Asinh, fast_math::Sinh>(table);
+            add_lanes<TanhF, AtanhFInv, AsinhF, SinhFInv, SigmoidF, SigmoidFInv,
+                      SaturatingE, PowerE, SmoothSaturationG>(table);
+            return table;
+        }
+    }
+
+    // This variant's table (the name is unique through ECT_SDK_ISA_NS).
+    const KernelTable& variant_kernels()
+    {
+        static const KernelTable table = make_table();
+        return table;
+    }
+} // namespace ECT_SDK_ISA_NS
+} // namespace ect::sdk::detail
+
+#endif // ECT_SDK_KERNEL_VARIANT_HPP
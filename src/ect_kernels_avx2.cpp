@@ -0,0 +1,17 @@
+// Four-lane AVX2 variant, built with -mavx2 (see CMakeLists.txt).
+#define ECT_SDK_ISA_NS     isa_avx2
+#define ECT_SDK_SIMD_LIMIT 4
+
+#include "ect_kernel_variant.hpp"
+
+namespace ect::sdk::detail
+{
+    const KernelTable* avx2_kernel_table()
+    {
+#if ECT_SDK_SIMD_WIDTH == 4
+        return &variant_kernels();
+#else
+        return nullptr;   // compiler flags do not provide AVX2
+#endif
+    }
+}
@@ -0,0 +1,17 @@
+// Eight-lane AVX-512F variant, built with -mavx512f (see CMakeLists.txt).
+#define ECT_SDK_ISA_NS     isa_avx512
+#define ECT_SDK_SIMD_LIMIT 8
+
+#include "ect_kernel_variant.hpp"
+
+namespace ect::sdk::detail
+{
+    const KernelTable* avx512_kernel_table()
+    {
+#if ECT_SDK_SIMD_WIDTH == 8
+        return &variant_kernels();
+#else
+        return nullptr;   // compiler flags do not provide AVX-512
+#endif
+    }
+}
@@ -0,0 +1,14 @@
+// One double per lane: the reference every other variant must match, and
+// the fallback on targets without a vector variant.
+#define ECT_SDK_ISA_NS     isa_scalar
+#define ECT_SDK_SIMD_LIMIT 1
+
+#include "ect_kernel_variant.hpp"
+
+namespace ect::sdk::detail
+{
+    const KernelTable* scalar_kernel_table()
+    {
+        return &variant_kernels();
+    }
+}
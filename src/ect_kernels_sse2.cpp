@@ -0,0 +1,17 @@
+// Two-lane SSE2 variant; baseline on x86-64, also what SSE4.x hosts run.
+#define ECT_SDK_ISA_NS     isa_sse2
+#define ECT_SDK_SIMD_LIMIT 2
+
+#include "ect_kernel_variant.hpp"
+
+namespace ect::sdk::detail
+{
+    const KernelTable* sse2_kernel_table()
+    {
+#if ECT_SDK_SIMD_WIDTH == 2
+        return &variant_kernels();
+#else
+        return nullptr;   // compiler flags do not provide SSE2
+#endif
+    }
+}
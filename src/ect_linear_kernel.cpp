@@ -0,0 +1,73 @@
+#include "ect_linear_kernel.hpp"
+
+// The kernels themselves live in ect_kernel_variant.hpp, compiled once per
+// instruction set; these entry points forward to the active variant.
+
+namespace ect::sdk::detail
+{
+    void linear_pipeline(
+        const double* in,
+        double*       out,
+        std::size_t   n,
+        double        e_gain,
+        double        g_gain,
+        double        u_min,
+        double        u_max
+    )
+    {
+        active_kernels().linear_pipeline(in, out, n, e_gain, g_gain, u_min, u_max);
+    }
+
+    void linear_pipeline_soa(
+        const double* in,
+        double*       out,
+        std::size_t   n,
+        const double* e_gain,
+        const double* g_gain,
+        const double* u_min,
+        const double* u_max
+    )
+    {
+        active_kernels().linear_pipeline_soa(in, out, n, e_gain, g_gain, u_min, u_max);
+    }
+
+    void linear_clamp_soa(
+        const double* in,
+        double*       out,
+        std::size_t   n,
+        const double* g_gain,
+        const double* u_min,
+        const double* u_max
+    )
+    {
+        active_kernels().linear_clamp_soa(in, out, n, g_gain, u_min, u_max);
+    }
+
+    void linear_clamp_state(
+        const double* in,
+        double*       out,
+        double*       raw,
+        std::int8_t*  state,
+        std::size_t   n,
+        double        g_gain,
+        double        u_min,
+        double        u_max
+    )
+    {
+        active_kernels().linear_clamp_state(in, out, raw, state, n, g_gain, u_min, u_max);
+    }
+
+    void linear_pipeline_soa_state(
+        const double* in,
+        double*       out,
+        std::int8_t*  state,
+        std::size_t   n,
+        const double* e_gain,
+        const double* g_gain,
+        const double* u_min,
+        const double* u_max
+    )
+    {
+        active_kernels().linear_pipeline_soa_state(in, out, state, n, e_gain, g_gain, u_min, u_max);
+    }
+}
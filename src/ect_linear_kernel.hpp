@@ -0,0 +1,115 @@
+#ifndef ECT_SDK_LINEAR_KERNEL_HPP
+#define ECT_SDK_LINEAR_KERNEL_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ect_dispatch.hpp"
+#include "ect_g_operator.hpp"
+
+namespace ect::sdk::detail
+{
+    // Batch form of the all-linear pipeline:
+    //   out[i] = clamp(g_gain * (e_gain * in[i]), u_min, u_max)
+    //
+    // F and F⁻¹ are the identity and are folded away. The multiplication
+    // order and the clamp comparisons are the same as in LinearEOperator and
+    // LinearGOperator, so every lane is bit-identical to the scalar path
+    // (including NaN propagation and signed zeros). in == out is allowed.
+    //
+    // These entry points call the variant selected by cpu::active() (see
+    // ect_dispatch.hpp); every variant produces the same bits.
+    void linear_pipeline(
+        const double* in,
+        double*       out,
+        std::size_t   n,
+        double        e_gain,
+        double        g_gain,
+        double        u_min,
+        double        u_max
+    );
+
+    // Structure-of-arrays form: every element has its own parameters.
+    //   out[i] = clamp(g_gain[i] * (e_gain[i] * in[i]), u_min[i], u_max[i])
+    void linear_pipeline_soa(
+        const double* in,
+        double*       out,
+        std::size_t   n,
+        const double* e_gain,
+        const double* g_gain,
+        const double* u_min,
+        const double* u_max
+    );
+
+    // G stage alone, structure-of-arrays:
+    //   out[i] = clamp(g_gain[i] * in[i], u_min[i], u_max[i])
+    void linear_clamp_soa(
+        const double* in,
+        double*       out,
+        std::size_t   n,
+        const double* g_gain,
+        const double* u_min,
+        const double* u_max
+    );
+
+    // G stage with clamp classification (see GOperator::evaluate_batch):
+    //   raw[i] = g_gain * in[i]           (skipped when raw == nullptr)
+    //   out[i] = clamp(raw[i], u_min, u_max)
+    //   state[i] = ClampState of the clamp branch taken
+    void linear_clamp_state(
+        const double* in,
+        double*       out,
+        double*       raw,
+        std::int8_t*  state,
+        std::size_t   n,
+        double        g_gain,
+        double        u_min,
+        double        u_max
+    );
+
+    // Structure-of-arrays pipeline that also classifies the clamp:
+    //   out[i]   = clamp(g_gain[i] * (e_gain[i] * in[i]), u_min[i], u_max[i])
+    //   state[i] = ClampState of the clamp branch taken
+    void linear_pipeline_soa_state(
+        const double* in,
+        double*       out,
+        std::int8_t*  state,
+        std::size_t   n,
+        const double* e_gain,
+        const double* g_gain,
+        const double* u_min,
+        const double* u_max
+    );
+
+inline namespace ECT_SDK_ISA_NS
+{
+    // Scalar reference of the clamp, used for the loop tails.
+    inline double clamp_scalar(double u, double u_min, double u_max)
+    {
+        if (u < u_min) return u_min;
+        if (u > u_max) return u_max;
+        return u;
+    }
+
+    // Branch taken by clamp_scalar(): u < u_min wins over u > u_max.
+    inline ClampState clamp_state(double u, double u_min, double u_max)
+    {
+        if (u < u_min) return ClampState::SatMin;
+        if (u > u_max) return ClampState::SatMax;
+        return ClampState::Free;
+    }
+
+    inline double linear_pipeline_scalar(
+        double x,
+        double e_gain,
+        double g_gain,
+        double u_min,
+        double u_max
+    )
+    {
+        return clamp_scalar(g_gain * (e_gain * x), u_min, u_max);
+    }
+} // namespace ECT_SDK_ISA_NS
+}
+
+#endif // ECT_SDK_LINEAR_KERNEL_HPP
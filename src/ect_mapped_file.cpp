@@ -0,0 +1,226 @@
+#include "ect_mapped_file.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ect::sdk::detail
+{
+    namespace
+    {
+        [[noreturn]] void fail(const std::string& path, const char* what)
+        {
+#if defined(_WIN32)
+            throw std::runtime_error(path + ": " + what + " (error " + std::to_string(GetLastError()) + ")");
+#else
+            throw std::runtime_error(path + ": " + what + " (" + std::strerror(errno) + ")");
+#endif
+        }
+    }
+
+#if defined(_WIN32)
+
+    MappedFile::MappedFile(const std::string& path, Mode mode, std::size_t size)
+        : path_(path)
+        , writable_(mode == Mode::Create)
+    {
+        const DWORD access = writable_ ? (GENERIC_READ | GENERIC_WRITE) : GENERIC_READ;
+        const DWORD share  = writable_ ? 0 : FILE_SHARE_READ;
+        const DWORD disp   = writable_ ? CREATE_ALWAYS : OPEN_EXISTING;
+
+        HANDLE file = CreateFileA(path.c_str(), access, share, nullptr, disp, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            fail(path, "cannot open");
+        }
+        file_ = file;
+
+        if (!writable_)
+        {
+            LARGE_INTEGER bytes;
+            if (!GetFileSizeEx(file, &bytes))
+            {
+                release();
+                fail(path, "cannot stat");
+            }
+            size = static_cast<std::size_t>(bytes.QuadPart);
+        }
+        if (size == 0)
+        {
+            release();
+            throw std::runtime_error(path + ": cannot map an empty file");
+        }
+
+        const unsigned long long wide = size;
+        HANDLE mapping = CreateFileMappingA(
+            file, nullptr, writable_ ? PAGE_READWRITE : PAGE_READONLY,
+            static_cast<DWORD>(wide >> 32), static_cast<DWORD>(wide & 0xFFFFFFFFull), nullptr);
+        if (mapping == nullptr)
+        {
+            release();
+            fail(path, "cannot create mapping");
+        }
+        mapping_ = mapping;
+
+        data_ = MapViewOfFile(mapping, writable_ ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+        if (data_ == nullptr)
+        {
+            release();
+            fail(path, "cannot map");
+        }
+        size_ = size;
+    }
+
+    void MappedFile::advise_sequential() const
+    {
+    }
+
+    void MappedFile::flush() const
+    {
+        if (data_ == nullptr || !writable_) return;
+
+        if (!FlushViewOfFile(data_, 0) || !FlushFileBuffers(static_cast<HANDLE>(file_)))
+        {
+            fail(path_, "cannot flush");
+        }
+    }
+
+    void MappedFile::release() noexcept
+    {
+        if (data_ != nullptr)    UnmapViewOfFile(data_);
+        if (mapping_ != nullptr) CloseHandle(static_cast<HANDLE>(mapping_));
+        if (file_ != nullptr)    CloseHandle(static_cast<HANDLE>(file_));
+        data_    = nullptr;
+        mapping_ = nullptr;
+        file_    = nullptr;
+        size_    = 0;
+    }
+
+#else
+
+    MappedFile::MappedFile(const std::string& path, Mode mode, std::size_t size)
+        : path_(path)
+        , writable_(mode == Mode::Create)
+    {
+        const int fd = writable_
+            ? ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644)
+            : ::open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            fail(path, "cannot open");
+        }
+
+        if (writable_)
+        {
+            if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+            {
+                ::close(fd);
+                fail(path, "cannot resize");
+            }
+        }
+        else
+        {
+            struct stat st;
+            if (::fstat(fd, &st) != 0)
+            {
+                ::close(fd);
+                fail(path, "cannot stat");
+            }
+            size = static_cast<std::size_t>(st.st_size);
+        }
+
+        if (size == 0)
+        {
+            ::close(fd);
+            throw std::runtime_error(path + ": cannot map an empty file");
+        }
+
+        void* p = ::mmap(nullptr, size, writable_ ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+        // The mapping keeps its own reference to the file.
+        ::close(fd);
+        if (p == MAP_FAILED)
+        {
+            fail(path, "cannot map");
+        }
+
+        data_ = p;
+        size_ = size;
+    }
+
+    void MappedFile::advise_sequential() const
+    {
+        if (data_ != nullptr)
+        {
+            ::madvise(data_, size_, MADV_SEQUENTIAL);
+        }
+    }
+
+    void MappedFile::flush() const
+    {
+        if (data_ == nullptr || !writable_) return;
+
+        if (::msync(data_, size_, MS_SYNC) != 0)
+        {
+            fail(path_, "cannot flush");
+        }
+    }
+
+    void MappedFile::release() noexcept
+    {
+        if (data_ != nullptr)
+        {
+            ::munmap(data_, size_);
+        }
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+#endif
+
+    MappedFile::~MappedFile()
+    {
+        release();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            path_     = std::move(other.path_);
+            data_     = std::exchange(other.data_, nullptr);
+            size_     = std::exchange(other.size_, 0);
+            writable_ = other.writable_;
+#if defined(_WIN32)
+            file_     = std::exchange(other.file_, nullptr);
+            mapping_  = std::exchange(other.mapping_, nullptr);
+#endif
+        }
+        return *this;
+    }
+
+    void MappedFile::close()
+    {
+        flush();
+        release();
+    }
+
+} // namespace ect::sdk::detail
@@ -0,0 +1,58 @@
+#ifndef ECT_SDK_MAPPED_FILE_HPP
+#define ECT_SDK_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <string>
+
+namespace ect::sdk::detail
+{
+    // Whole-file memory mapping (POSIX mmap / Win32 file mapping).
+    // Errors are reported as std::runtime_error naming the path.
+    class MappedFile
+    {
+    public:
+        enum class Mode
+        {
+            ReadOnly,
+            Create      // create or truncate to `size` bytes, map read-write
+        };
+
+        MappedFile() = default;
+        MappedFile(const std::string& path, Mode mode, std::size_t size = 0);
+        ~MappedFile();
+
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        MappedFile(const MappedFile&)            = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        bool        is_open() const { return data_ != nullptr; }
+        std::size_t size()    const { return size_; }
+        void*       data()    const { return data_; }
+
+        // Hint that the mapping will be read front to back.
+        void advise_sequential() const;
+
+        // Writes dirty pages back to the file (writable mappings only).
+        void flush() const;
+
+        // Flushes (if writable) and unmaps; a no-op when not open.
+        void close();
+
+    private:
+        void release() noexcept;
+
+        std::string path_;
+        void*       data_     = nullptr;
+        std::size_t size_     = 0;
+        bool        writable_ = false;
+#if defined(_WIN32)
+        void*       file_     = nullptr;
+        void*       mapping_  = nullptr;
+#endif
+    };
+
+} // namespace ect::sdk::detail
+
+#endif // ECT_SDK_MAPPED_FILE_HPP
@@ -0,0 +1,122 @@
+#ifndef ECT_SDK_NONLINEAR_FUNCTORS_HPP
+#define ECT_SDK_NONLINEAR_FUNCTORS_HPP
+
+#include "ect_fast_math_kernels.hpp"
+
+namespace ect::sdk::detail
+{
+inline namespace ECT_SDK_ISA_NS
+{
+    namespace fm = fast_math;
+
+    // Each operator defines its arithmetic once as a lane-generic
+    // functor; apply() runs it on a double, apply_batch() on SIMD lanes.
+    // InlineController evaluates its built-in stages through the same
+    // functors, so both paths stay bit-identical. `kernel` is the functor's
+    // slot in the dispatched kernel tables (ect_dispatch.hpp). Results that
+    // may be NaN leave through fm::canonical() for the same reason as the
+    // fast_math kernels.
+
+    struct TanhF
+    {
+        static constexpr LaneKernel kernel = LaneKernel::TanhF;
+
+        double scale;
+        template <typename L> L operator()(L d) const { return fm::tanh(d / L(scale)); }
+    };
+
+    struct AtanhFInv
+    {
+        static constexpr LaneKernel kernel = LaneKernel::AtanhFInv;
+
+        double scale;
+        template <typename L> L operator()(L x) const { return fm::canonical(L(scale) * fm::atanh(x)); }
+    };
+
+    struct AsinhF
+    {
+        static constexpr LaneKernel kernel = LaneKernel::AsinhF;
+
+        double scale;
+        template <typename L> L operator()(L d) const { return fm::asinh(d / L(scale)); }
+    };
+
+    struct SinhFInv
+    {
+        static constexpr LaneKernel kernel = LaneKernel::SinhFInv;
+
+        double scale;
+        template <typename L> L operator()(L x) const { return fm::canonical(L(scale) * fm::sinh(x)); }
+    };
+
+    struct SigmoidF
+    {
+        static constexpr LaneKernel kernel = LaneKernel::SigmoidF;
+
+        // |v| / (1 + |v|) as 1 / (1 / |v| + 1): each step is monotone in
+        // |v|, which the quotient form is not between adjacent doubles.
+        double scale;
+        template <typename L> L operator()(L d) const
+        {
+            const L v = d / L(scale);
+            return fm::canonical(fm::copysign(L(1.0) / (L(1.0) / fm::abs(v) + L(1.0)), v));
+        }
+    };
+
+    struct SigmoidFInv
+    {
+        static constexpr LaneKernel kernel = LaneKernel::SigmoidFInv;
+
+        double scale;
+        template <typename L> L operator()(L x) const
+        {
+            return fm::canonical((L(scale) * x) / (L(1.0) - fm::abs(x)));
+        }
+    };
+
+    struct SaturatingE
+    {
+        static constexpr LaneKernel kernel = LaneKernel::SaturatingE;
+
+        double alpha_limit;
+        double limit;
+        template <typename L> L operator()(L x) const
+        {
+            return fm::canonical(L(alpha_limit) * fm::tanh(x / L(limit)));
+        }
+    };
+
+    struct PowerE
+    {
+        static constexpr LaneKernel kernel = LaneKernel::PowerE;
+
+        double alpha;
+        double exponent;
+        double limit;
+        template <typename L> L operator()(L x) const
+        {
+            const L r      = fm::abs(x) / L(limit);
+            const L inside = (L(alpha) * L(limit)) * fm::pow_abs(r, L(exponent));
+            const L mag    = fm::select(fm::gt(r, L(1.0)), L(alpha) * fm::abs(x), inside);
+            return fm::canonical(fm::copysign(mag, x));
+        }
+    };
+
+    struct SmoothSaturationG
+    {
+        static constexpr LaneKernel kernel = LaneKernel::SmoothSaturationG;
+
+        double k;
+        double u_min;
+        double u_max;
+        template <typename L> L operator()(L x) const
+        {
+            const L v     = L(k) * x;
+            const L bound = fm::select(fm::lt(v, L(0.0)), L(-u_min), L(u_max));
+            return fm::canonical(bound * fm::tanh(v / bound));
+        }
+    };
+} // namespace ECT_SDK_ISA_NS
+} // namespace ect::sdk::detail
+
+#endif // ECT_SDK_NONLINEAR_FUNCTORS_HPP
@@ -0,0 +1,223 @@
+#include "ect_nonlinear_operators.hpp"
+#include "ect_nonlinear_functors.hpp"
+
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    using detail::dispatch_lanes;
+    using detail::TanhF;
+    using detail::AtanhFInv;
+    using detail::AsinhF;
+    using detail::SinhFInv;
+    using detail::SigmoidF;
+    using detail::SigmoidFInv;
+    using detail::SaturatingE;
+    using detail::PowerE;
+    using detail::SmoothSaturationG;
+
+    namespace
+    {
+        void require(bool cond, const char* msg)
+        {
+            if (!cond) throw std::invalid_argument(msg);
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // TanhFOperator / AtanhFInvOperator
+    // -------------------------------------------------------------------------
+
+    TanhFOperator::TanhFOperator(double scale)
+        : scale_(scale)
+    {
+        require(scale > 0.0, "TanhFOperator: scale must be > 0");
+    }
+
+    double TanhFOperator::apply(double delta) const
+    {
+        return TanhF{ scale_ }(delta);
+    }
+
+    void TanhFOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, TanhF{ scale_ });
+    }
+
+    AtanhFInvOperator::AtanhFInvOperator(double scale)
+        : scale_(scale)
+    {
+        require(scale > 0.0, "AtanhFInvOperator: scale must be > 0");
+    }
+
+    double AtanhFInvOperator::apply(double x) const
+    {
+        return AtanhFInv{ scale_ }(x);
+    }
+
+    void AtanhFInvOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, AtanhFInv{ scale_ });
+    }
+
+    // -------------------------------------------------------------------------
+    // AsinhFOperator / SinhFInvOperator
+    // -------------------------------------------------------------------------
+
+    AsinhFOperator::AsinhFOperator(double scale)
+        : scale_(scale)
+    {
+        require(scale > 0.0, "AsinhFOperator: scale must be > 0");
+    }
+
+    double AsinhFOperator::apply(double delta) const
+    {
+        return AsinhF{ scale_ }(delta);
+    }
+
+    void AsinhFOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, AsinhF{ scale_ });
+    }
+
+    SinhFInvOperator::SinhFInvOperator(double scale)
+        : scale_(scale)
+    {
+        require(scale > 0.0, "SinhFInvOperator: scale must be > 0");
+    }
+
+    double SinhFInvOperator::apply(double x) const
+    {
+        return SinhFInv{ scale_ }(x);
+    }
+
+    void SinhFInvOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, SinhFInv{ scale_ });
+    }
+
+    // -------------------------------------------------------------------------
+    // SigmoidFOperator / SigmoidFInvOperator
+    // -------------------------------------------------------------------------
+
+    SigmoidFOperator::SigmoidFOperator(double scale)
+        : scale_(scale)
+    {
+        require(scale > 0.0, "SigmoidFOperator: scale must be > 0");
+    }
+
+    double SigmoidFOperator::apply(double delta) const
+    {
+        return SigmoidF{ scale_ }(delta);
+    }
+
+    void SigmoidFOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, SigmoidF{ scale_ });
+    }
+
+    SigmoidFInvOperator::SigmoidFInvOperator(double scale)
+        : scale_(scale)
+    {
+        require(scale > 0.0, "SigmoidFInvOperator: scale must be > 0");
+    }
+
+    double SigmoidFInvOperator::apply(double x) const
+    {
+        return SigmoidFInv{ scale_ }(x);
+    }
+
+    void SigmoidFInvOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, SigmoidFInv{ scale_ });
+    }
+
+    // -------------------------------------------------------------------------
+    // SaturatingEOperator
+    // -------------------------------------------------------------------------
+
+    SaturatingEOperator::SaturatingEOperator(double alpha, double limit)
+        : alpha_limit_(alpha * limit)
+        , limit_(limit)
+    {
+        require(alpha > 0.0 && alpha < 1.0, "SaturatingEOperator: alpha must be in (0, 1)");
+        require(limit > 0.0, "SaturatingEOperator: limit must be > 0");
+    }
+
+    double SaturatingEOperator::apply(double x) const
+    {
+        return SaturatingE{ alpha_limit_, limit_ }(x);
+    }
+
+    void SaturatingEOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, SaturatingE{ alpha_limit_, limit_ });
+    }
+
+    // -------------------------------------------------------------------------
+    // PowerEOperator
+    // -------------------------------------------------------------------------
+
+    PowerEOperator::PowerEOperator(double alpha, double exponent, double limit)
+        : alpha_(alpha)
+        , exponent_(exponent)
+        , limit_(limit)
+    {
+        require(alpha > 0.0 && alpha < 1.0, "PowerEOperator: alpha must be in (0, 1)");
+        require(exponent >= 1.0, "PowerEOperator: exponent must be >= 1");
+        require(limit > 0.0, "PowerEOperator: limit must be > 0");
+    }
+
+    double PowerEOperator::apply(double x) const
+    {
+        return PowerE{ alpha_, exponent_, limit_ }(x);
+    }
+
+    void PowerEOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, PowerE{ alpha_, exponent_, limit_ });
+    }
+
+    // -------------------------------------------------------------------------
+    // SmoothSaturationGOperator
+    // -------------------------------------------------------------------------
+
+    SmoothSaturationGOperator::SmoothSaturationGOperator(double gain, double u_min, double u_max)
+        : k_(gain)
+        , u_min_(u_min)
+        , u_max_(u_max)
+    {
+        require(gain > 0.0, "SmoothSaturationGOperator: gain must be > 0");
+        require(u_min < 0.0 && u_max > 0.0, "SmoothSaturationGOperator: bounds must satisfy u_min < 0 < u_max");
+    }
+
+    double SmoothSaturationGOperator::apply(double delta) const
+    {
+        return SmoothSaturationG{ k_, u_min_, u_max_ }(delta);
+    }
+
+    void SmoothSaturationGOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        dispatch_lanes(in, out, n, SmoothSaturationG{ k_, u_min_, u_max_ });
+    }
+
+    GEvaluation SmoothSaturationGOperator::evaluate(double delta) const
+    {
+        GEvaluation r;
+        r.u   = apply(delta);
+        r.raw = k_ * delta;
+        if (r.u <= u_min_)      r.state = ClampState::SatMin;
+        else if (r.u >= u_max_) r.state = ClampState::SatMax;
+        return r;
+    }
+
+    double SmoothSaturationGOperator::u_min() const
+    {
+        return u_min_;
+    }
+
+    double SmoothSaturationGOperator::u_max() const
+    {
+        return u_max_;
+    }
+}
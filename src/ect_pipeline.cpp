@@ -0,0 +1,197 @@
+#include "ect_pipeline.hpp"
+#include "ect_sdk.hpp"
+#include "ect_thread_util.hpp"
+
+#include <chrono>
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    namespace
+    {
+        using clock = std::chrono::steady_clock;
+
+        // Empty polls the worker answers with a yield before it starts
+        // sleeping poll_interval_us between polls.
+        constexpr unsigned IDLE_SPINS = 64;
+    }
+
+    ControlPipeline::ControlPipeline(const Controller& controller, const PipelineOptions& options)
+        : controller_(controller)
+        , options_(options)
+        , input_(options.input_capacity)
+        , output_(options.output_capacity)
+    {
+        if (options_.batch == 0)
+        {
+            throw std::invalid_argument("ControlPipeline: batch must be > 0");
+        }
+
+        samples_.resize(options_.batch);
+        deltas_.resize(options_.batch);
+        u_.resize(options_.batch);
+        outputs_.resize(options_.batch);
+
+        worker_ = std::thread([this] { worker_loop(); });
+        if (options_.cpu >= 0)
+        {
+            pinned_ = detail::pin_to_cpu(worker_, options_.cpu);
+        }
+    }
+
+    ControlPipeline::~ControlPipeline()
+    {
+        stop();
+    }
+
+    bool ControlPipeline::push(const PipelineSample& sample)
+    {
+        return push(&sample, 1) == 1;
+    }
+
+    std::size_t ControlPipeline::push(const PipelineSample* samples, std::size_t n)
+    {
+        std::size_t accepted = 0;
+        while (!stop_.load(std::memory_order_acquire))
+        {
+            // Count the chunk before it is published, so the worker can
+            // never have processed samples that accepted_ does not cover
+            // yet; whatever did not fit is taken back afterwards.
+            const std::size_t chunk = n - accepted;
+            detail::bump(accepted_, chunk);
+            const std::size_t pushed = input_.push(samples + accepted, chunk);
+            if (pushed < chunk)
+            {
+                accepted_.store(accepted_.load(std::memory_order_relaxed) - (chunk - pushed), std::memory_order_relaxed);
+            }
+
+            accepted += pushed;
+            if (accepted == n || options_.backpressure == Backpressure::Drop) break;
+            std::this_thread::yield();
+        }
+
+        if (accepted < n && options_.backpressure == Backpressure::Drop)
+        {
+            detail::bump(dropped_, n - accepted);
+        }
+        return accepted;
+    }
+
+    bool ControlPipeline::pop(PipelineOutput& output)
+    {
+        return output_.try_pop(output);
+    }
+
+    std::size_t ControlPipeline::pop(PipelineOutput* outputs, std::size_t max)
+    {
+        return output_.pop(outputs, max);
+    }
+
+    void ControlPipeline::stop()
+    {
+        stop_.store(true, std::memory_order_release);
+        if (worker_.joinable())
+        {
+            worker_.join();
+        }
+        joined_.store(true, std::memory_order_release);
+    }
+
+    bool ControlPipeline::pinned() const
+    {
+        return pinned_;
+    }
+
+    PipelineStats ControlPipeline::stats() const
+    {
+        // processed_ first: its release store happens after the input
+        // ring handed the samples over, so the accepted_ read below already
+        // covers every sample it counts.
+        PipelineStats s;
+        s.processed  = processed_.load(std::memory_order_acquire);
+        s.accepted   = accepted_.load(std::memory_order_relaxed);
+        s.dropped    = dropped_.load(std::memory_order_relaxed);
+        s.batches    = batches_.load(std::memory_order_relaxed);
+        s.evaluation = instrumentation::summarize(evaluation_);
+        if (joined_.load(std::memory_order_acquire) && s.accepted > s.processed)
+        {
+            s.discarded = s.accepted - s.processed;
+        }
+        return s;
+    }
+
+    void ControlPipeline::worker_loop()
+    {
+        const std::size_t batch = options_.batch;
+        const auto        flush = std::chrono::microseconds(options_.flush_us);
+        const auto        idle  = std::chrono::microseconds(options_.poll_interval_us);
+
+        unsigned empty_polls = 0;
+        while (!stop_.load(std::memory_order_acquire))
+        {
+            std::size_t n = input_.pop(samples_.data(), batch);
+            if (n == 0)
+            {
+                if (++empty_polls < IDLE_SPINS || options_.poll_interval_us == 0)
+                {
+                    std::this_thread::yield();
+                }
+                else
+                {
+                    std::this_thread::sleep_for(idle);
+                }
+                continue;
+            }
+            empty_polls = 0;
+
+            // Partial batch: trade at most flush_us of latency for a fuller
+            // update_batch() call.
+            if (n < batch && options_.flush_us > 0)
+            {
+                const clock::time_point deadline = clock::now() + flush;
+                while (n < batch && !stop_.load(std::memory_order_relaxed))
+                {
+                    const std::size_t got = input_.pop(samples_.data() + n, batch - n);
+                    n += got;
+                    if (got == 0)
+                    {
+                        if (clock::now() >= deadline) break;
+                        std::this_thread::yield();
+                    }
+                }
+            }
+
+            const clock::time_point t0 = clock::now();
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                deltas_[k] = samples_[k].setpoint - samples_[k].estimate;
+            }
+            controller_.update_batch(deltas_.data(), u_.data(), n);
+            for (std::size_t k = 0; k < n; ++k)
+            {
+                outputs_[k] = PipelineOutput{ samples_[k].tag, deltas_[k], u_[k] };
+            }
+            evaluation_.record(detail::ns(t0, clock::now()));
+            detail::bump(batches_);
+
+            if (!publish(outputs_.data(), n)) return;
+        }
+    }
+
+    bool ControlPipeline::publish(const PipelineOutput* outputs, std::size_t n)
+    {
+        std::size_t done = 0;
+        for (;;)
+        {
+            const std::size_t pushed = output_.push(outputs + done, n - done);
+            done += pushed;
+            detail::bump(processed_, pushed, std::memory_order_release);
+            if (done == n) return true;
+
+            // Output queue full: stall here so the input queue backs up.
+            if (stop_.load(std::memory_order_acquire)) return false;
+            std::this_thread::yield();
+        }
+    }
+
+} // namespace ect::sdk
@@ -0,0 +1,128 @@
+#include "ect_plan.hpp"
+#include "ect_f_operator.hpp"
+#include "ect_e_operator.hpp"
+#include "ect_finv_operator.hpp"
+#include "ect_g_operator.hpp"
+#include "ect_linear_kernel.hpp"
+
+namespace ect::sdk
+{
+    ExecutionPlan::ExecutionPlan(
+        const FOperator&    f,
+        const EOperator&    e,
+        const FInvOperator& finv,
+        const GOperator&    g,
+        const PlanOptions&  options
+    )
+    : f_(&f)
+    , e_(&e)
+    , finv_(&finv)
+    , g_(&g)
+    {
+        AffineForm forms[4];
+
+        if (!f.affine_form(forms[0])    ||
+            !e.affine_form(forms[1])    ||
+            !finv.affine_form(forms[2]) ||
+            !g.affine_form(forms[3]))
+        {
+            return; // opaque operator → Generic
+        }
+
+        // Only the last stage may clamp; an intermediate clamp cannot be
+        // moved past the following stages.
+        for (int s = 0; s < 3; ++s)
+        {
+            if (!forms[s].is_unbounded()) return;
+        }
+
+        for (const AffineForm& form : forms)
+        {
+            if (form.scale == 1.0 && form.offset == 0.0) continue; // identity stage
+
+            if (options.allow_reassociation && steps_ > 0)
+            {
+                // (a*x + b)*c + d  →  (a*c)*x + (b*c + d)
+                const std::size_t last = steps_ - 1;
+                scale_[last]  = scale_[last] * form.scale;
+                offset_[last] = offset_[last] * form.scale + form.offset;
+                exact_ = false;
+                continue;
+            }
+
+            scale_[steps_]  = form.scale;
+            offset_[steps_] = form.offset;
+            ++steps_;
+        }
+
+        lower_ = forms[3].lower;
+        upper_ = forms[3].upper;
+        kind_  = Kind::Affine;
+    }
+
+    ExecutionPlan::Kind ExecutionPlan::kind() const
+    {
+        return kind_;
+    }
+
+    bool ExecutionPlan::exact() const
+    {
+        return exact_;
+    }
+
+    std::size_t ExecutionPlan::steps() const
+    {
+        return steps_;
+    }
+
+    double ExecutionPlan::evaluate(double delta) const
+    {
+        if (kind_ == Kind::Generic)
+        {
+            const double x_f    = f_->apply(delta);
+            const double x_e    = e_->apply(x_f);
+            const double x_finv = finv_->apply(x_e);
+            return g_->apply(x_finv);
+        }
+
+        double y = delta;
+        for (std::size_t s = 0; s < steps_; ++s)
+        {
+            if (scale_[s]  != 1.0) y = scale_[s] * y;
+            if (offset_[s] != 0.0) y = y + offset_[s];
+        }
+        return detail::clamp_scalar(y, lower_, upper_);
+    }
+
+    void ExecutionPlan::evaluate_batch(const double* deltas, double* out, std::size_t n) const
+    {
+        // Pure-scale chains of up to two steps map onto the vectorized
+        // kernel; a missing step uses gain 1.0, which is exact.
+        if (kind_ == Kind::Affine && steps_ <= 2
+            && (steps_ < 1 || offset_[0] == 0.0)
+            && (steps_ < 2 || offset_[1] == 0.0))
+        {
+            const double first  = steps_ >= 1 ? scale_[0] : 1.0;
+            const double second = steps_ >= 2 ? scale_[1] : 1.0;
+            detail::linear_pipeline(deltas, out, n, first, second, lower_, upper_);
+            return;
+        }
+
+        if (kind_ == Kind::Affine)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                out[i] = evaluate(deltas[i]);
+            }
+            return;
+        }
+
+        // Stage by stage through the operators' batch hooks; every stage is
+        // element-wise, so this matches update() element for element.
+        f_->apply_batch(deltas, out, n);
+        e_->apply_batch(out, out, n);
+        finv_->apply_batch(out, out, n);
+        g_->apply_batch(out, out, n);
+    }
+
+} // namespace ect::sdk
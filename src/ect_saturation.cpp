@@ -0,0 +1,158 @@
+#include "ect_saturation.hpp"
+#include "ect_thread_pool.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    SaturationStats saturation_stats(const std::int8_t* state, std::size_t n)
+    {
+        SaturationStats s;
+        s.samples = n;
+        if (n == 0) return s;
+
+        // Counting passes are plain reductions the compiler vectorizes.
+        std::uint64_t lower  = 0;
+        std::uint64_t upper  = 0;
+        std::uint64_t starts = state[0] != 0 ? 1 : 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            lower += state[i] < 0 ? 1 : 0;
+            upper += state[i] > 0 ? 1 : 0;
+        }
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            starts += (state[i] != 0 && state[i] != state[i - 1]) ? 1 : 0;
+        }
+
+        s.sat_min = lower;
+        s.sat_max = upper;
+        s.runs    = starts;
+
+        // The longest run needs a sequential scan; skip it when there is none.
+        if (starts > 0)
+        {
+            std::uint64_t run  = 0;
+            std::int8_t   prev = 0;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const std::int8_t v = state[i];
+                run  = v == 0 ? 0 : (v == prev ? run + 1 : 1);
+                prev = v;
+                if (run > s.longest_run) s.longest_run = run;
+            }
+        }
+        return s;
+    }
+
+    // -------------------------------------------------------------------------
+    // SaturationTracker
+    // -------------------------------------------------------------------------
+
+    SaturationTracker::SaturationTracker(std::size_t size)
+        : previous_(size, 0)
+        , sat_min_(size, 0)
+        , sat_max_(size, 0)
+        , runs_(size, 0)
+        , current_run_(size, 0)
+        , longest_run_(size, 0)
+    {
+    }
+
+    std::size_t SaturationTracker::size() const
+    {
+        return previous_.size();
+    }
+
+    std::uint64_t SaturationTracker::ticks() const
+    {
+        return ticks_;
+    }
+
+    void SaturationTracker::record(const std::int8_t* state)
+    {
+        record_range(state, 0, size());
+        ++ticks_;
+    }
+
+    void SaturationTracker::record(const std::int8_t* state, ThreadPool& pool, std::size_t grain)
+    {
+        pool.parallel_for(size(), grain, [&](std::size_t begin, std::size_t end) {
+            record_range(state, begin, end);
+        });
+        ++ticks_;
+    }
+
+    void SaturationTracker::record_range(const std::int8_t* state, std::size_t begin, std::size_t end)
+    {
+        std::int8_t*   prev    = previous_.data();
+        std::uint64_t* lower   = sat_min_.data();
+        std::uint64_t* upper   = sat_max_.data();
+        std::uint64_t* runs    = runs_.data();
+        std::uint64_t* current = current_run_.data();
+        std::uint64_t* longest = longest_run_.data();
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const std::int8_t   v    = state[i];
+            const bool          sat  = v != 0;
+            const bool          same = v == prev[i];
+            const std::uint64_t run  = sat ? (same ? current[i] + 1 : 1) : 0;
+
+            lower[i]   += v < 0 ? 1 : 0;
+            upper[i]   += v > 0 ? 1 : 0;
+            runs[i]    += (sat && !same) ? 1 : 0;
+            current[i]  = run;
+            longest[i]  = run > longest[i] ? run : longest[i];
+            prev[i]     = v;
+        }
+    }
+
+    SaturationStats SaturationTracker::entity(std::size_t i) const
+    {
+        if (i >= size())
+        {
+            throw std::out_of_range("SaturationTracker::entity: index out of range");
+        }
+
+        SaturationStats s;
+        s.samples     = ticks_;
+        s.sat_min     = sat_min_[i];
+        s.sat_max     = sat_max_[i];
+        s.runs        = runs_[i];
+        s.longest_run = longest_run_[i];
+        return s;
+    }
+
+    SaturationStats SaturationTracker::total() const
+    {
+        SaturationStats s;
+        s.samples = ticks_ * size();
+        for (std::size_t i = 0; i < size(); ++i)
+        {
+            s.sat_min    += sat_min_[i];
+            s.sat_max    += sat_max_[i];
+            s.runs       += runs_[i];
+            s.longest_run = longest_run_[i] > s.longest_run ? longest_run_[i] : s.longest_run;
+        }
+        return s;
+    }
+
+    const std::uint64_t* SaturationTracker::sat_min()     const { return sat_min_.data(); }
+    const std::uint64_t* SaturationTracker::sat_max()     const { return sat_max_.data(); }
+    const std::uint64_t* SaturationTracker::runs()        const { return runs_.data(); }
+    const std::uint64_t* SaturationTracker::longest_run() const { return longest_run_.data(); }
+
+    void SaturationTracker::reset()
+    {
+        ticks_ = 0;
+        std::fill(previous_.begin(), previous_.end(), std::int8_t(0));
+        std::fill(sat_min_.begin(), sat_min_.end(), 0);
+        std::fill(sat_max_.begin(), sat_max_.end(), 0);
+        std::fill(runs_.begin(), runs_.end(), 0);
+        std::fill(current_run_.begin(), current_run_.end(), 0);
+        std::fill(longest_run_.begin(), longest_run_.end(), 0);
+    }
+
+} // namespace ect::sdk
@@ -1,5 +1,9 @@
 #include "ect_sdk.hpp"
 
+#if ECT_SDK_INSTRUMENTATION
+#include <chrono>
+#endif
+
 namespace ect::sdk
 {
     Controller::Controller(
@@ -17,10 +21,71 @@ namespace ect::sdk
 
     double Controller::update(double delta) const
     {
+#if ECT_SDK_INSTRUMENTATION
+        using clock = std::chrono::steady_clock;
+        using instrumentation::Stage;
+
+        const auto ns = [](clock::time_point a, clock::time_point b) {
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count());
+        };
+
+        auto& hist = instrumentation::detail::thread_histograms();
+
+        const clock::time_point t0     = clock::now();
+        const double            x_f    = f_.apply(delta);
+        const clock::time_point t1     = clock::now();
+        const double            x_e    = e_.apply(x_f);
+        const clock::time_point t2     = clock::now();
+        const double            x_finv = finv_.apply(x_e);
+        const clock::time_point t3     = clock::now();
+        const double            u      = g_.apply(x_finv);
+        const clock::time_point t4     = clock::now();
+
+        hist[static_cast<std::size_t>(Stage::F)].record(ns(t0, t1));
+        hist[static_cast<std::size_t>(Stage::E)].record(ns(t1, t2));
+        hist[static_cast<std::size_t>(Stage::FInv)].record(ns(t2, t3));
+        hist[static_cast<std::size_t>(Stage::G)].record(ns(t3, t4));
+        hist[static_cast<std::size_t>(Stage::Update)].record(ns(t0, t4));
+        return u;
+#else
         const double x_f    = f_.apply(delta);
         const double x_e    = e_.apply(x_f);
         const double x_finv = finv_.apply(x_e);
         return g_.apply(x_finv);
+#endif
+    }
+
+    void Controller::update_batch(const double* deltas, double* out, std::size_t n) const
+    {
+        plan().evaluate_batch(deltas, out, n);
+    }
+
+    GEvaluation Controller::evaluate(double delta) const
+    {
+        const double x_f    = f_.apply(delta);
+        const double x_e    = e_.apply(x_f);
+        const double x_finv = finv_.apply(x_e);
+        return g_.evaluate(x_finv);
+    }
+
+    void Controller::evaluate_batch(
+        const double* deltas,
+        double*       u,
+        double*       raw,
+        std::int8_t*  state,
+        std::size_t   n
+    ) const
+    {
+        // u doubles as the scratch column for the stages before G.
+        f_.apply_batch(deltas, u, n);
+        e_.apply_batch(u, u, n);
+        finv_.apply_batch(u, u, n);
+        g_.evaluate_batch(u, u, raw, state, n);
+    }
+
+    ExecutionPlan Controller::plan(const PlanOptions& options) const
+    {
+        return ExecutionPlan(f_, e_, finv_, g_, options);
     }
 
 } // namespace ect::sdk
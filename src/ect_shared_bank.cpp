@@ -0,0 +1,415 @@
+#include "ect_shared_bank.hpp"
+#include "ect_controller_bank.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+#if !defined(_WIN32)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ect::sdk
+{
+    namespace
+    {
+        constexpr char          MAGIC[8]            = { 'E', 'C', 'T', 'S', 'H', 'B', 'K', '\0' };
+        constexpr std::uint32_t SHARED_BANK_VERSION = 1;
+        constexpr std::size_t   ALIGN               = 64;
+        constexpr unsigned      IDLE_SPINS          = 64;
+
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "shared counters must be lock-free");
+        static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "shared counters must be lock-free");
+
+        // Seqlock state of one channel. A buffer's sequence is odd while its
+        // writer fills it; `current` names the buffer holding the newest tick.
+        struct alignas(ALIGN) Channel
+        {
+            std::atomic<std::uint32_t> current;
+            std::atomic<std::uint64_t> sequence[2];
+            std::atomic<std::uint64_t> tick[2];
+        };
+
+        // Region layout: this header, then the buffers
+        //   [Deviation 0][Deviation 1][Output 0][Output 1]
+        // each `buffer_bytes` apart. `ready` is set last by the creator.
+        struct alignas(ALIGN) Header
+        {
+            char                       magic[8];
+            std::uint32_t              version;
+            std::uint32_t              header_bytes;
+            std::uint64_t              size;
+            std::uint64_t              buffer_bytes;
+            std::atomic<std::uint32_t> ready;
+            Channel                    channels[2];
+        };
+
+        constexpr std::size_t round_up(std::size_t n)
+        {
+            return (n + ALIGN - 1) / ALIGN * ALIGN;
+        }
+
+        std::size_t region_bytes(std::size_t buffer_bytes)
+        {
+            return sizeof(Header) + 4 * buffer_bytes;
+        }
+
+        void validate_name(const std::string& name)
+        {
+            if (name.size() < 2 || name.size() > 255 || name[0] != '/' || name.find('/', 1) != std::string::npos)
+            {
+                throw std::invalid_argument("SharedBank: name must be \"/name\" without further slashes");
+            }
+        }
+
+        Header& header_of(void* base)
+        {
+            return *static_cast<Header*>(base);
+        }
+
+        Channel& channel_of(void* base, SharedChannel channel)
+        {
+            return header_of(base).channels[static_cast<std::uint32_t>(channel)];
+        }
+
+        double* buffer_of(void* base, SharedChannel channel, std::uint32_t buffer)
+        {
+            const Header&     h     = header_of(base);
+            const std::size_t index = static_cast<std::uint32_t>(channel) * 2 + buffer;
+            return reinterpret_cast<double*>(static_cast<unsigned char*>(base) + sizeof(Header) + index * h.buffer_bytes);
+        }
+
+#if !defined(_WIN32)
+        [[noreturn]] void fail(const std::string& name, const char* what)
+        {
+            throw std::runtime_error(name + ": " + what + " (" + std::strerror(errno) + ")");
+        }
+
+        void* map_shared(int fd, std::size_t bytes, const std::string& name)
+        {
+            void* p = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            // The mapping keeps its own reference to the object.
+            ::close(fd);
+            if (p == MAP_FAILED)
+            {
+                fail(name, "cannot map shared memory");
+            }
+            return p;
+        }
+#endif
+    }
+
+#if defined(_WIN32)
+
+    SharedBank::SharedBank(const std::string& name, std::size_t)
+        : name_(name)
+    {
+        throw std::runtime_error(name + ": POSIX shared memory is not available on this platform");
+    }
+
+    SharedBank::SharedBank(const std::string& name)
+        : name_(name)
+    {
+        throw std::runtime_error(name + ": POSIX shared memory is not available on this platform");
+    }
+
+    bool SharedBank::remove(const std::string&)
+    {
+        return false;
+    }
+
+    void SharedBank::release() noexcept
+    {
+        base_  = nullptr;
+        bytes_ = 0;
+    }
+
+#else
+
+    SharedBank::SharedBank(const std::string& name, std::size_t size)
+        : name_(name)
+        , size_(size)
+    {
+        validate_name(name);
+        if (size == 0 || size > (SIZE_MAX - sizeof(Header)) / (4 * sizeof(double)) - ALIGN)
+        {
+            throw std::invalid_argument("SharedBank: size must be > 0 and addressable");
+        }
+
+        const std::size_t buffer_bytes = round_up(size * sizeof(double));
+        const std::size_t bytes        = region_bytes(buffer_bytes);
+
+        const int fd = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (fd < 0)
+        {
+            fail(name, "cannot create shared memory");
+        }
+        if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0)
+        {
+            const int err = errno;
+            ::close(fd);
+            ::shm_unlink(name.c_str());
+            errno = err;
+            fail(name, "cannot resize shared memory");
+        }
+
+        try
+        {
+            base_ = map_shared(fd, bytes, name);
+        }
+        catch (...)
+        {
+            ::shm_unlink(name.c_str());
+            throw;
+        }
+        bytes_ = bytes;
+
+        // The object is zero-filled; construct the header in place and
+        // announce it only when complete.
+        Header* h = new (base_) Header{};
+        std::memcpy(h->magic, MAGIC, sizeof(MAGIC));
+        h->version      = SHARED_BANK_VERSION;
+        h->header_bytes = static_cast<std::uint32_t>(sizeof(Header));
+        h->size         = size;
+        h->buffer_bytes = buffer_bytes;
+        h->ready.store(1, std::memory_order_release);
+    }
+
+    SharedBank::SharedBank(const std::string& name)
+        : name_(name)
+    {
+        validate_name(name);
+
+        const int fd = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (fd < 0)
+        {
+            fail(name, "cannot open shared memory");
+        }
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0)
+        {
+            const int err = errno;
+            ::close(fd);
+            errno = err;
+            fail(name, "cannot stat shared memory");
+        }
+
+        const std::size_t bytes = static_cast<std::size_t>(st.st_size);
+        if (bytes < sizeof(Header))
+        {
+            ::close(fd);
+            throw std::runtime_error(name + ": shared bank not initialised yet");
+        }
+
+        base_  = map_shared(fd, bytes, name);
+        bytes_ = bytes;
+
+        const Header& h = header_of(base_);
+        if (h.ready.load(std::memory_order_acquire) != 1)
+        {
+            release();
+            throw std::runtime_error(name + ": shared bank not initialised yet");
+        }
+        if (std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0)
+        {
+            release();
+            throw std::runtime_error(name + ": not a shared bank (bad magic)");
+        }
+        if (h.version != SHARED_BANK_VERSION || h.header_bytes != sizeof(Header))
+        {
+            release();
+            throw std::runtime_error(name + ": unsupported shared bank version " + std::to_string(h.version));
+        }
+        if (h.size == 0 || h.buffer_bytes < h.size * sizeof(double) || region_bytes(h.buffer_bytes) > bytes)
+        {
+            release();
+            throw std::runtime_error(name + ": shared bank layout does not fit the region");
+        }
+        size_ = static_cast<std::size_t>(h.size);
+    }
+
+    bool SharedBank::remove(const std::string& name)
+    {
+        validate_name(name);
+        if (::shm_unlink(name.c_str()) == 0) return true;
+        if (errno == ENOENT) return false;
+        fail(name, "cannot remove shared memory");
+    }
+
+    void SharedBank::release() noexcept
+    {
+        if (base_ != nullptr)
+        {
+            ::munmap(base_, bytes_);
+        }
+        base_  = nullptr;
+        bytes_ = 0;
+    }
+
+#endif
+
+    SharedBank::~SharedBank()
+    {
+        release();
+    }
+
+    SharedBank::SharedBank(SharedBank&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    SharedBank& SharedBank::operator=(SharedBank&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            name_       = std::move(other.name_);
+            base_       = std::exchange(other.base_, nullptr);
+            bytes_      = std::exchange(other.bytes_, 0);
+            size_       = std::exchange(other.size_, 0);
+            pending_[0] = std::exchange(other.pending_[0], -1);
+            pending_[1] = std::exchange(other.pending_[1], -1);
+        }
+        return *this;
+    }
+
+    const std::string& SharedBank::name() const
+    {
+        return name_;
+    }
+
+    std::size_t SharedBank::size() const
+    {
+        return size_;
+    }
+
+    double* SharedBank::write_begin(SharedChannel channel)
+    {
+        std::ptrdiff_t& pending = pending_[static_cast<std::uint32_t>(channel)];
+        if (pending < 0)
+        {
+            Channel&            ch = channel_of(base_, channel);
+            const std::uint32_t b  = 1 - ch.current.load(std::memory_order_relaxed);
+
+            // Odd sequence first: a reader still on this buffer from two
+            // ticks ago must see the change before any of the new data.
+            // The parity is set, not toggled, so a writer that died between
+            // write_begin() and publish() (sequence left odd) cannot flip
+            // it for its successor.
+            ch.sequence[b].store(ch.sequence[b].load(std::memory_order_relaxed) | 1u, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            pending = static_cast<std::ptrdiff_t>(b);
+        }
+        return buffer_of(base_, channel, static_cast<std::uint32_t>(pending));
+    }
+
+    void SharedBank::publish(SharedChannel channel, std::uint64_t tick)
+    {
+        std::ptrdiff_t& pending = pending_[static_cast<std::uint32_t>(channel)];
+        if (pending < 0)
+        {
+            throw std::logic_error("SharedBank::publish: no write_begin() pending on this channel");
+        }
+        if (tick <= latest(channel))
+        {
+            throw std::logic_error("SharedBank::publish: ticks must increase");
+        }
+
+        Channel&            ch = channel_of(base_, channel);
+        const std::uint32_t b  = static_cast<std::uint32_t>(pending);
+
+        ch.tick[b].store(tick, std::memory_order_relaxed);
+        ch.sequence[b].store((ch.sequence[b].load(std::memory_order_relaxed) | 1u) + 1, std::memory_order_release);
+        ch.current.store(b, std::memory_order_release);
+        pending = -1;
+    }
+
+    std::uint64_t SharedBank::latest(SharedChannel channel) const
+    {
+        const Channel& ch = channel_of(base_, channel);
+        return ch.tick[ch.current.load(std::memory_order_acquire)].load(std::memory_order_relaxed);
+    }
+
+    SharedFrame SharedBank::read_begin(SharedChannel channel) const
+    {
+        const Channel& ch = channel_of(base_, channel);
+        for (;;)
+        {
+            const std::uint32_t b = ch.current.load(std::memory_order_acquire);
+            const std::uint64_t s = ch.sequence[b].load(std::memory_order_acquire);
+            if (s & 1u)
+            {
+                // The writer lapped this read and already moved `current`.
+                continue;
+            }
+
+            SharedFrame frame;
+            frame.tick = ch.tick[b].load(std::memory_order_relaxed);
+            if (frame.tick == 0) return SharedFrame{};
+
+            frame.data     = buffer_of(base_, channel, b);
+            frame.sequence = s;
+            frame.buffer   = b;
+            return frame;
+        }
+    }
+
+    bool SharedBank::read_valid(SharedChannel channel, const SharedFrame& frame) const
+    {
+        if (frame.data == nullptr) return false;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return channel_of(base_, channel).sequence[frame.buffer].load(std::memory_order_relaxed) == frame.sequence;
+    }
+
+    std::uint64_t SharedBank::wait(SharedChannel channel, std::uint64_t after, std::chrono::nanoseconds timeout) const
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        for (unsigned spins = 0;; ++spins)
+        {
+            const std::uint64_t t = latest(channel);
+            if (t > after) return t;
+
+            if (spins >= IDLE_SPINS)
+            {
+                if (std::chrono::steady_clock::now() >= deadline) return 0;
+                std::this_thread::yield();
+            }
+        }
+    }
+
+    std::uint64_t SharedBank::step(const ControllerBank& bank)
+    {
+        if (bank.size() != size_)
+        {
+            throw std::invalid_argument("SharedBank::step: bank size does not match the region");
+        }
+
+        for (;;)
+        {
+            const SharedFrame in = read_begin(SharedChannel::Deviation);
+            if (in.data == nullptr || in.tick <= latest(SharedChannel::Output)) return 0;
+
+            bank.evaluate(in.data, write_begin(SharedChannel::Output));
+
+            // Torn input: the estimator published twice during the
+            // evaluation. Redo it on the newer deviations.
+            if (read_valid(SharedChannel::Deviation, in))
+            {
+                publish(SharedChannel::Output, in.tick);
+                return in.tick;
+            }
+        }
+    }
+
+} // namespace ect::sdk
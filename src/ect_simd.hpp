@@ -0,0 +1,357 @@
+#ifndef ECT_SDK_SIMD_HPP
+#define ECT_SDK_SIMD_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "ect_dispatch.hpp"
+
+// Widest lane this translation unit may use. The per-ISA kernel variants
+// (ect_kernel_variant.hpp) lower it to build narrower lanes next to wider
+// ones; everything else gets whatever the compiler flags allow.
+#ifndef ECT_SDK_SIMD_LIMIT
+#define ECT_SDK_SIMD_LIMIT 8
+#endif
+
+#if ECT_SDK_SIMD_LIMIT >= 8 && defined(__AVX512F__)
+#define ECT_SDK_SIMD_WIDTH 8
+#include <immintrin.h>
+#elif ECT_SDK_SIMD_LIMIT >= 4 && defined(__AVX2__)
+#define ECT_SDK_SIMD_WIDTH 4
+#include <immintrin.h>
+#elif ECT_SDK_SIMD_LIMIT >= 2 && (defined(__SSE2__) || defined(_M_X64))
+#define ECT_SDK_SIMD_WIDTH 2
+#include <emmintrin.h>
+#else
+#define ECT_SDK_SIMD_WIDTH 1
+#endif
+
+// -----------------------------------------------------------------------------
+// Minimal lane abstraction for the fast-math kernels.
+//
+// Kernels are written once as templates over a lane type L and instantiated
+// for `double` (scalar) and, when available, for the SSE2/AVX2/AVX-512
+// vector types below. Every operation used here is a single correctly
+// rounded IEEE-754 operation or an exact bit manipulation, so all
+// instantiations produce the same bits for the same input.
+// -----------------------------------------------------------------------------
+
+namespace ect::sdk::detail
+{
+inline namespace ECT_SDK_ISA_NS
+{
+namespace simd
+{
+    // -------------------------------------------------------------------------
+    // Scalar lane
+    // -------------------------------------------------------------------------
+
+    inline std::uint64_t bits_of(double x)
+    {
+        std::uint64_t b = 0;
+        std::memcpy(&b, &x, sizeof(b));
+        return b;
+    }
+
+    inline double from_bits(std::uint64_t b)
+    {
+        double x = 0.0;
+        std::memcpy(&x, &b, sizeof(x));
+        return x;
+    }
+
+    inline double load(const double* p, double*) { return *p; }
+    inline void   store(double* p, double x)     { *p = x; }
+
+    inline bool lt(double a, double b) { return a < b; }
+    inline bool gt(double a, double b) { return a > b; }
+    inline bool eq(double a, double b) { return a == b; }
+
+    inline double select(bool m, double a, double b) { return m ? a : b; }
+
+    // Lane j of the mask in bit j.
+    inline unsigned mask_bits(bool m) { return m ? 1u : 0u; }
+
+    inline double abs(double x)  { return from_bits(bits_of(x) & 0x7FFFFFFFFFFFFFFFull); }
+    inline double sqrt(double x) { return std::sqrt(x); }
+
+    // Magnitude of `mag` with the sign bit of `sign`.
+    inline double copysign(double mag, double sign)
+    {
+        return from_bits((bits_of(mag) & 0x7FFFFFFFFFFFFFFFull) | (bits_of(sign) & 0x8000000000000000ull));
+    }
+
+    // Nearest integer (ties to even) for |x| < 2^51.
+    inline double round_int(double x)
+    {
+        const double magic = 6755399441055744.0; // 1.5 * 2^52
+        return (x + magic) - magic;
+    }
+
+    // 2^k for integral k in [-1022, 1023].
+    inline double pow2i(double k)
+    {
+        const std::uint64_t b = bits_of((k + 1023.0) + 4503599627370496.0); // + 2^52
+        return from_bits(b << 52);
+    }
+
+    // For positive normal x: returns m in [1, 2) and sets e so x = m * 2^e.
+    inline double split_exponent(double x, double& e)
+    {
+        const std::uint64_t b = bits_of(x);
+        e = from_bits((b >> 52) | 0x4330000000000000ull) - 4503599627370496.0 - 1023.0;
+        return from_bits((b & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull);
+    }
+
+    // -------------------------------------------------------------------------
+    // Vector lanes
+    // -------------------------------------------------------------------------
+
+#if ECT_SDK_SIMD_WIDTH == 8
+
+    struct Lane
+    {
+        __m512d v;
+
+        Lane() = default;
+        Lane(__m512d x) : v(x) {}
+        Lane(double c) : v(_mm512_set1_pd(c)) {}
+    };
+
+    struct Mask
+    {
+        __mmask8 m;
+    };
+
+    // AVX-512F has no floating-point logic ops (those are AVX-512DQ), so
+    // sign manipulation goes through the integer domain.
+    inline __m512d bit_and(__m512d a, std::uint64_t b)
+    {
+        return _mm512_castsi512_pd(_mm512_and_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(static_cast<long long>(b))));
+    }
+
+    inline Lane operator+(Lane a, Lane b) { return _mm512_add_pd(a.v, b.v); }
+    inline Lane operator-(Lane a, Lane b) { return _mm512_sub_pd(a.v, b.v); }
+    inline Lane operator*(Lane a, Lane b) { return _mm512_mul_pd(a.v, b.v); }
+    inline Lane operator/(Lane a, Lane b) { return _mm512_div_pd(a.v, b.v); }
+    inline Lane operator-(Lane a)
+    {
+        return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a.v), _mm512_set1_epi64(static_cast<long long>(0x8000000000000000ull))));
+    }
+
+    inline Lane load(const double* p, Lane*) { return _mm512_loadu_pd(p); }
+    inline void store(double* p, Lane x)     { _mm512_storeu_pd(p, x.v); }
+
+    inline Mask lt(Lane a, Lane b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_LT_OQ) }; }
+    inline Mask gt(Lane a, Lane b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_GT_OQ) }; }
+    inline Mask eq(Lane a, Lane b) { return { _mm512_cmp_pd_mask(a.v, b.v, _CMP_EQ_OQ) }; }
+
+    inline Lane select(Mask m, Lane a, Lane b) { return _mm512_mask_blend_pd(m.m, b.v, a.v); }
+
+    inline unsigned mask_bits(Mask m) { return static_cast<unsigned>(m.m); }
+
+    inline Lane abs(Lane x)  { return bit_and(x.v, 0x7FFFFFFFFFFFFFFFull); }
+    inline Lane sqrt(Lane x) { return _mm512_sqrt_pd(x.v); }
+
+    inline Lane copysign(Lane mag, Lane sign)
+    {
+        return _mm512_castsi512_pd(_mm512_or_si512(_mm512_castpd_si512(bit_and(mag.v, 0x7FFFFFFFFFFFFFFFull)),
+                                                   _mm512_castpd_si512(bit_and(sign.v, 0x8000000000000000ull))));
+    }
+
+    inline Lane round_int(Lane x)
+    {
+        const __m512d magic = _mm512_set1_pd(6755399441055744.0);
+        return _mm512_sub_pd(_mm512_add_pd(x.v, magic), magic);
+    }
+
+    inline Lane pow2i(Lane k)
+    {
+        const __m512d b = _mm512_add_pd(_mm512_add_pd(k.v, _mm512_set1_pd(1023.0)),
+                                        _mm512_set1_pd(4503599627370496.0));
+        return _mm512_castsi512_pd(_mm512_slli_epi64(_mm512_castpd_si512(b), 52));
+    }
+
+    inline Lane split_exponent(Lane x, Lane& e)
+    {
+        const __m512i b  = _mm512_castpd_si512(x.v);
+        const __m512i eb = _mm512_or_si512(_mm512_srli_epi64(b, 52),
+                                           _mm512_set1_epi64(0x4330000000000000ll));
+        e = _mm512_sub_pd(_mm512_sub_pd(_mm512_castsi512_pd(eb), _mm512_set1_pd(4503599627370496.0)),
+                          _mm512_set1_pd(1023.0));
+
+        const __m512i mb = _mm512_or_si512(_mm512_and_si512(b, _mm512_set1_epi64(0x000FFFFFFFFFFFFFll)),
+                                           _mm512_set1_epi64(0x3FF0000000000000ll));
+        return _mm512_castsi512_pd(mb);
+    }
+
+#elif ECT_SDK_SIMD_WIDTH == 4
+
+    struct Lane
+    {
+        __m256d v;
+
+        Lane() = default;
+        Lane(__m256d x) : v(x) {}
+        Lane(double c) : v(_mm256_set1_pd(c)) {}
+    };
+
+    struct Mask
+    {
+        __m256d m;
+    };
+
+    inline Lane operator+(Lane a, Lane b) { return _mm256_add_pd(a.v, b.v); }
+    inline Lane operator-(Lane a, Lane b) { return _mm256_sub_pd(a.v, b.v); }
+    inline Lane operator*(Lane a, Lane b) { return _mm256_mul_pd(a.v, b.v); }
+    inline Lane operator/(Lane a, Lane b) { return _mm256_div_pd(a.v, b.v); }
+    inline Lane operator-(Lane a)         { return _mm256_xor_pd(a.v, _mm256_set1_pd(-0.0)); }
+
+    inline Lane load(const double* p, Lane*) { return _mm256_loadu_pd(p); }
+    inline void store(double* p, Lane x)     { _mm256_storeu_pd(p, x.v); }
+
+    inline Mask lt(Lane a, Lane b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_LT_OQ) }; }
+    inline Mask gt(Lane a, Lane b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_GT_OQ) }; }
+    inline Mask eq(Lane a, Lane b) { return { _mm256_cmp_pd(a.v, b.v, _CMP_EQ_OQ) }; }
+
+    inline Lane select(Mask m, Lane a, Lane b) { return _mm256_blendv_pd(b.v, a.v, m.m); }
+
+    inline unsigned mask_bits(Mask m) { return static_cast<unsigned>(_mm256_movemask_pd(m.m)); }
+
+    inline Lane abs(Lane x)  { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x.v); }
+    inline Lane sqrt(Lane x) { return _mm256_sqrt_pd(x.v); }
+
+    inline Lane copysign(Lane mag, Lane sign)
+    {
+        const __m256d s = _mm256_set1_pd(-0.0);
+        return _mm256_or_pd(_mm256_andnot_pd(s, mag.v), _mm256_and_pd(s, sign.v));
+    }
+
+    inline Lane round_int(Lane x)
+    {
+        const __m256d magic = _mm256_set1_pd(6755399441055744.0);
+        return _mm256_sub_pd(_mm256_add_pd(x.v, magic), magic);
+    }
+
+    inline Lane pow2i(Lane k)
+    {
+        const __m256d b = _mm256_add_pd(_mm256_add_pd(k.v, _mm256_set1_pd(1023.0)),
+                                        _mm256_set1_pd(4503599627370496.0));
+        return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(b), 52));
+    }
+
+    inline Lane split_exponent(Lane x, Lane& e)
+    {
+        const __m256i b  = _mm256_castpd_si256(x.v);
+        const __m256i eb = _mm256_or_si256(_mm256_srli_epi64(b, 52),
+                                           _mm256_set1_epi64x(0x4330000000000000ll));
+        e = _mm256_sub_pd(_mm256_sub_pd(_mm256_castsi256_pd(eb), _mm256_set1_pd(4503599627370496.0)),
+                          _mm256_set1_pd(1023.0));
+
+        const __m256i mb = _mm256_or_si256(_mm256_and_si256(b, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFll)),
+                                           _mm256_set1_epi64x(0x3FF0000000000000ll));
+        return _mm256_castsi256_pd(mb);
+    }
+
+#elif ECT_SDK_SIMD_WIDTH == 2
+
+    struct Lane
+    {
+        __m128d v;
+
+        Lane() = default;
+        Lane(__m128d x) : v(x) {}
+        Lane(double c) : v(_mm_set1_pd(c)) {}
+    };
+
+    struct Mask
+    {
+        __m128d m;
+    };
+
+    inline Lane operator+(Lane a, Lane b) { return _mm_add_pd(a.v, b.v); }
+    inline Lane operator-(Lane a, Lane b) { return _mm_sub_pd(a.v, b.v); }
+    inline Lane operator*(Lane a, Lane b) { return _mm_mul_pd(a.v, b.v); }
+    inline Lane operator/(Lane a, Lane b) { return _mm_div_pd(a.v, b.v); }
+    inline Lane operator-(Lane a)         { return _mm_xor_pd(a.v, _mm_set1_pd(-0.0)); }
+
+    inline Lane load(const double* p, Lane*) { return _mm_loadu_pd(p); }
+    inline void store(double* p, Lane x)     { _mm_storeu_pd(p, x.v); }
+
+    inline Mask lt(Lane a, Lane b) { return { _mm_cmplt_pd(a.v, b.v) }; }
+    inline Mask gt(Lane a, Lane b) { return { _mm_cmpgt_pd(a.v, b.v) }; }
+    inline Mask eq(Lane a, Lane b) { return { _mm_cmpeq_pd(a.v, b.v) }; }
+
+    inline Lane select(Mask m, Lane a, Lane b)
+    {
+        return _mm_or_pd(_mm_and_pd(m.m, a.v), _mm_andnot_pd(m.m, b.v));
+    }
+
+    inline unsigned mask_bits(Mask m) { return static_cast<unsigned>(_mm_movemask_pd(m.m)); }
+
+    inline Lane abs(Lane x)  { return _mm_andnot_pd(_mm_set1_pd(-0.0), x.v); }
+    inline Lane sqrt(Lane x) { return _mm_sqrt_pd(x.v); }
+
+    inline Lane copysign(Lane mag, Lane sign)
+    {
+        const __m128d s = _mm_set1_pd(-0.0);
+        return _mm_or_pd(_mm_andnot_pd(s, mag.v), _mm_and_pd(s, sign.v));
+    }
+
+    inline Lane round_int(Lane x)
+    {
+        const __m128d magic = _mm_set1_pd(6755399441055744.0);
+        return _mm_sub_pd(_mm_add_pd(x.v, magic), magic);
+    }
+
+    inline Lane pow2i(Lane k)
+    {
+        const __m128d b = _mm_add_pd(_mm_add_pd(k.v, _mm_set1_pd(1023.0)),
+                                     _mm_set1_pd(4503599627370496.0));
+        return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(b), 52));
+    }
+
+    inline Lane split_exponent(Lane x, Lane& e)
+    {
+        const __m128i b  = _mm_castpd_si128(x.v);
+        const __m128i eb = _mm_or_si128(_mm_srli_epi64(b, 52),
+                                        _mm_set1_epi64x(0x4330000000000000ll));
+        e = _mm_sub_pd(_mm_sub_pd(_mm_castsi128_pd(eb), _mm_set1_pd(4503599627370496.0)),
+                       _mm_set1_pd(1023.0));
+
+        const __m128i mb = _mm_or_si128(_mm_and_si128(b, _mm_set1_epi64x(0x000FFFFFFFFFFFFFll)),
+                                        _mm_set1_epi64x(0x3FF0000000000000ll));
+        return _mm_castsi128_pd(mb);
+    }
+
+#endif
+
+    // -------------------------------------------------------------------------
+    // Batch driver: applies a lane-generic functor to n elements, using the
+    // vector lane for full blocks and the scalar lane for the tail.
+    // -------------------------------------------------------------------------
+
+    template <typename Fn>
+    inline void for_each_lane(const double* in, double* out, std::size_t n, const Fn& fn)
+    {
+        std::size_t i = 0;
+
+#if ECT_SDK_SIMD_WIDTH > 1
+        for (; i + ECT_SDK_SIMD_WIDTH <= n; i += ECT_SDK_SIMD_WIDTH)
+        {
+            store(out + i, fn(load(in + i, static_cast<Lane*>(nullptr))));
+        }
+#endif
+
+        for (; i < n; ++i)
+        {
+            out[i] = fn(in[i]);
+        }
+    }
+} // namespace simd
+} // namespace ECT_SDK_ISA_NS
+} // namespace ect::sdk::detail
+
+#endif // ECT_SDK_SIMD_HPP
@@ -0,0 +1,390 @@
+#include "ect_simulation.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_thread_pool.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // Plant models
+    // -------------------------------------------------------------------------
+
+    IntegratorPlant::IntegratorPlant(double gain)
+        : gain_(gain)
+    {
+    }
+
+    void IntegratorPlant::step(
+        double*       position,
+        double*       /*velocity*/,
+        const double* u,
+        std::size_t   begin,
+        std::size_t   end
+    ) const
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            position[i] += gain_ * u[i];
+        }
+    }
+
+    FirstOrderLagPlant::FirstOrderLagPlant(double gain, double tau, double dt)
+        : gain_(gain)
+        , rate_(0.0)
+    {
+        if (!(tau > 0.0) || !(dt > 0.0) || !(dt <= tau))
+        {
+            throw std::invalid_argument("FirstOrderLagPlant: requires tau > 0 and 0 < dt <= tau");
+        }
+        rate_ = dt / tau;
+    }
+
+    void FirstOrderLagPlant::step(
+        double*       position,
+        double*       /*velocity*/,
+        const double* u,
+        std::size_t   begin,
+        std::size_t   end
+    ) const
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            position[i] += rate_ * (gain_ * u[i] - position[i]);
+        }
+    }
+
+    SecondOrderLagPlant::SecondOrderLagPlant(double gain, double omega, double zeta, double dt)
+        : gain_(gain)
+        , omega2_(omega * omega)
+        , damping_(2.0 * zeta * omega)
+        , dt_(dt)
+    {
+        if (!(omega > 0.0) || !(zeta >= 0.0) || !(dt > 0.0))
+        {
+            throw std::invalid_argument("SecondOrderLagPlant: requires omega > 0, zeta >= 0, dt > 0");
+        }
+    }
+
+    void SecondOrderLagPlant::step(
+        double*       position,
+        double*       velocity,
+        const double* u,
+        std::size_t   begin,
+        std::size_t   end
+    ) const
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const double a = omega2_ * (gain_ * u[i] - position[i]) - damping_ * velocity[i];
+            velocity[i] += dt_ * a;
+            position[i] += dt_ * velocity[i];
+        }
+    }
+
+    MassSpringDamperPlant::MassSpringDamperPlant(double mass, double stiffness, double damping, double dt)
+        : inv_mass_(0.0)
+        , stiffness_(stiffness)
+        , damping_(damping)
+        , dt_(dt)
+    {
+        if (!(mass > 0.0) || !(stiffness >= 0.0) || !(damping >= 0.0) || !(dt > 0.0))
+        {
+            throw std::invalid_argument(
+                "MassSpringDamperPlant: requires mass > 0, stiffness >= 0, damping >= 0, dt > 0");
+        }
+        inv_mass_ = 1.0 / mass;
+    }
+
+    void MassSpringDamperPlant::step(
+        double*       position,
+        double*       velocity,
+        const double* u,
+        std::size_t   begin,
+        std::size_t   end
+    ) const
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const double a = inv_mass_ * (u[i] - stiffness_ * position[i] - damping_ * velocity[i]);
+            velocity[i] += dt_ * a;
+            position[i] += dt_ * velocity[i];
+        }
+    }
+
+    DroneVerticalPlant::DroneVerticalPlant(
+        double mass,
+        double drag,
+        double dt,
+        bool   hover_feedforward,
+        double gravity
+    )
+    : inv_mass_(0.0)
+    , drag_(drag)
+    , dt_(dt)
+    , bias_(hover_feedforward ? 0.0 : -gravity)
+    {
+        if (!(mass > 0.0) || !(drag >= 0.0) || !(dt > 0.0) || !(gravity >= 0.0))
+        {
+            throw std::invalid_argument(
+                "DroneVerticalPlant: requires mass > 0, drag >= 0, dt > 0, gravity >= 0");
+        }
+        inv_mass_ = 1.0 / mass;
+    }
+
+    void DroneVerticalPlant::step(
+        double*       position,
+        double*       velocity,
+        const double* u,
+        std::size_t   begin,
+        std::size_t   end
+    ) const
+    {
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            const double a = inv_mass_ * (u[i] - drag_ * velocity[i]) + bias_;
+            velocity[i] += dt_ * a;
+            position[i] += dt_ * velocity[i];
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Target profiles
+    // -------------------------------------------------------------------------
+
+    TargetProfile TargetProfile::constant(double value)
+    {
+        TargetProfile t;
+        t.base = value;
+        return t;
+    }
+
+    TargetProfile TargetProfile::ramp_sine(double base, double ramp_rate, double amplitude, double omega)
+    {
+        TargetProfile t;
+        t.base      = base;
+        t.ramp_rate = ramp_rate;
+        t.amplitude = amplitude;
+        t.omega     = omega;
+        return t;
+    }
+
+    double TargetProfile::at(std::size_t step) const
+    {
+        const double k = static_cast<double>(step);
+        double t = base + ramp_rate * k;
+        if (amplitude != 0.0)
+        {
+            t += amplitude * std::sin(omega * k);
+        }
+        return t;
+    }
+
+    // -------------------------------------------------------------------------
+    // Simulation
+    // -------------------------------------------------------------------------
+
+    namespace
+    {
+        // Structure-of-arrays scratch for all scenarios; each task touches
+        // only its own [begin, end) slice.
+        struct Workspace
+        {
+            explicit Workspace(std::size_t n)
+                : position(n)
+                , velocity(n, 0.0)
+                , delta(n)
+                , u(n)
+                , state(n)
+                , initial_error(n)
+                , band(n)
+                , last_outside(n, 0)
+                , saturated(n, 0)
+            {
+            }
+
+            std::vector<double>      position;
+            std::vector<double>      velocity;
+            std::vector<double>      delta;
+            std::vector<double>      u;
+            std::vector<std::int8_t> state;
+            std::vector<double>      initial_error;
+            std::vector<double>      band;
+            std::vector<std::size_t> last_outside;
+            std::vector<std::size_t> saturated;
+        };
+
+        void run_range(
+            const ControllerBank&             bank,
+            const PlantModel&                 plant,
+            const std::vector<TargetProfile>& targets,
+            const SimulationOptions&          options,
+            Workspace&                        ws,
+            std::vector<ScenarioMetrics>&     metrics,
+            std::size_t                       begin,
+            std::size_t                       end
+        )
+        {
+            for (std::size_t k = 0; k < options.steps; ++k)
+            {
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    const double d = targets[i].at(k) - ws.position[i];
+                    ws.delta[i] = d;
+
+                    if (k == 0)
+                    {
+                        ws.initial_error[i] = d;
+                        ws.band[i] = std::fmax(options.settling_fraction * std::fabs(d), options.settling_floor);
+                    }
+
+                    const double abs_d = std::fabs(d);
+                    if (abs_d > ws.band[i])
+                    {
+                        ws.last_outside[i] = k + 1;
+                    }
+
+                    ScenarioMetrics& m = metrics[i];
+                    if (abs_d > m.max_abs_error)
+                    {
+                        m.max_abs_error = abs_d;
+                    }
+
+                    // Past the target means delta has the opposite sign of delta_0.
+                    const double e0     = ws.initial_error[i];
+                    const double excess = (e0 > 0.0) ? -d : (e0 < 0.0 ? d : abs_d);
+                    if (excess > m.overshoot)
+                    {
+                        m.overshoot = excess;
+                    }
+                }
+
+                bank.evaluate_range(ws.delta.data(), ws.u.data(), ws.state.data(), begin, end);
+
+                for (std::size_t i = begin; i < end; ++i)
+                {
+                    ws.saturated[i] += ws.state[i] != 0 ? 1 : 0;
+                }
+
+                plant.step(ws.position.data(), ws.velocity.data(), ws.u.data(), begin, end);
+            }
+
+            const double steps = static_cast<double>(options.steps);
+
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                ScenarioMetrics& m = metrics[i];
+
+                m.settling_step = ws.last_outside[i];
+                m.settled       = ws.last_outside[i] < options.steps || options.steps == 0;
+
+                const double e0 = std::fabs(ws.initial_error[i]);
+                if (e0 > 0.0)
+                {
+                    m.overshoot /= e0;
+                }
+
+                m.saturation_fraction = options.steps == 0 ? 0.0 : static_cast<double>(ws.saturated[i]) / steps;
+                m.final_position      = ws.position[i];
+                m.final_error         = targets[i].at(options.steps) - ws.position[i];
+            }
+        }
+
+        SimulationSummary summarize(const std::vector<ScenarioMetrics>& metrics)
+        {
+            SimulationSummary s;
+            s.scenarios = metrics.size();
+
+            double settling_sum   = 0.0;
+            double saturation_sum = 0.0;
+
+            for (const ScenarioMetrics& m : metrics)
+            {
+                if (m.settled)
+                {
+                    ++s.settled;
+                    settling_sum += static_cast<double>(m.settling_step);
+                    if (m.settling_step > s.max_settling_step)
+                    {
+                        s.max_settling_step = m.settling_step;
+                    }
+                }
+                s.max_overshoot       = std::fmax(s.max_overshoot, m.overshoot);
+                s.max_abs_final_error = std::fmax(s.max_abs_final_error, std::fabs(m.final_error));
+                saturation_sum       += m.saturation_fraction;
+            }
+
+            if (s.settled > 0)
+            {
+                s.mean_settling_step = settling_sum / static_cast<double>(s.settled);
+            }
+            if (s.scenarios > 0)
+            {
+                s.mean_saturation_fraction = saturation_sum / static_cast<double>(s.scenarios);
+            }
+            return s;
+        }
+
+        void validate(
+            const ControllerBank&             bank,
+            const std::vector<TargetProfile>& targets,
+            const std::vector<double>&        initial_position
+        )
+        {
+            if (targets.size() != bank.size() || initial_position.size() != bank.size())
+            {
+                throw std::invalid_argument("simulate: targets / initial_position must match bank.size()");
+            }
+        }
+    }
+
+    SimulationResult simulate(
+        const ControllerBank&             bank,
+        const PlantModel&                 plant,
+        const std::vector<TargetProfile>& targets,
+        const std::vector<double>&        initial_position,
+        const SimulationOptions&          options
+    )
+    {
+        validate(bank, targets, initial_position);
+
+        Workspace ws(bank.size());
+        ws.position = initial_position;
+
+        SimulationResult result;
+        result.scenarios.resize(bank.size());
+
+        run_range(bank, plant, targets, options, ws, result.scenarios, 0, bank.size());
+
+        result.summary = summarize(result.scenarios);
+        return result;
+    }
+
+    SimulationResult simulate(
+        const ControllerBank&             bank,
+        const PlantModel&                 plant,
+        const std::vector<TargetProfile>& targets,
+        const std::vector<double>&        initial_position,
+        const SimulationOptions&          options,
+        ThreadPool&                       pool
+    )
+    {
+        validate(bank, targets, initial_position);
+
+        Workspace ws(bank.size());
+        ws.position = initial_position;
+
+        SimulationResult result;
+        result.scenarios.resize(bank.size());
+
+        pool.parallel_for(bank.size(), options.grain, [&](std::size_t begin, std::size_t end) {
+            run_range(bank, plant, targets, options, ws, result.scenarios, begin, end);
+        });
+
+        result.summary = summarize(result.scenarios);
+        return result;
+    }
+
+} // namespace ect::sdk
@@ -0,0 +1,437 @@
+#include "ect_tabulated_operators.hpp"
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    namespace
+    {
+        // Elements per evaluate_batch() pass; the per-pass scratch
+        // (eight arrays) stays well inside L1.
+        constexpr std::size_t BATCH_BLOCK = 256;
+    }
+
+    // -------------------------------------------------------------------------
+    // LookupTable
+    // -------------------------------------------------------------------------
+
+    LookupTable::LookupTable(
+        const std::function<double(double)>& fn,
+        const TableSpec&                     spec,
+        TableReport*                         report
+    )
+    : interpolation_(spec.interpolation)
+    , uniform_(!spec.adaptive)
+    , lo_(spec.lo)
+    , hi_(spec.hi)
+    {
+        if (!(std::isfinite(spec.lo) && std::isfinite(spec.hi) && spec.lo < spec.hi))
+        {
+            throw std::invalid_argument("LookupTable: domain must be finite with lo < hi");
+        }
+        if (spec.points < 2)
+        {
+            throw std::invalid_argument("LookupTable: at least two points are required");
+        }
+        if (spec.adaptive && (spec.max_points < spec.points || !(spec.tolerance > 0.0)))
+        {
+            throw std::invalid_argument("LookupTable: adaptive tables need max_points >= points and tolerance > 0");
+        }
+
+        const std::size_t n = spec.points;
+        x_.reserve(n + 1);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            x_.push_back(i + 1 == n ? hi_ : lo_ + (hi_ - lo_) * static_cast<double>(i) / static_cast<double>(n - 1));
+        }
+        inv_step_ = static_cast<double>(n - 1) / (hi_ - lo_);
+
+        if (spec.adaptive && lo_ < 0.0 && hi_ > 0.0)
+        {
+            for (std::size_t i = 0; i + 1 < x_.size(); ++i)
+            {
+                if (x_[i] < 0.0 && x_[i + 1] > 0.0)
+                {
+                    x_.insert(x_.begin() + static_cast<std::ptrdiff_t>(i + 1), 0.0);
+                    break;
+                }
+            }
+        }
+
+        y_.resize(x_.size());
+        for (std::size_t i = 0; i < x_.size(); ++i)
+        {
+            y_[i] = fn(x_[i]);
+        }
+        compute_slopes();
+
+        // Bisect every segment whose midpoint error exceeds the tolerance.
+        while (spec.adaptive && x_.size() < spec.max_points)
+        {
+            std::vector<double> nx;
+            std::vector<double> ny;
+            nx.reserve(x_.size() * 2);
+            ny.reserve(x_.size() * 2);
+
+            std::size_t budget = spec.max_points - x_.size();
+
+            for (std::size_t i = 0; i + 1 < x_.size(); ++i)
+            {
+                nx.push_back(x_[i]);
+                ny.push_back(y_[i]);
+
+                const double mid = 0.5 * (x_[i] + x_[i + 1]);
+                if (budget == 0 || mid <= x_[i] || mid >= x_[i + 1]) continue;
+
+                const double f_mid = fn(mid);
+                if (std::fabs(interpolate(i, mid) - f_mid) > spec.tolerance)
+                {
+                    nx.push_back(mid);
+                    ny.push_back(f_mid);
+                    --budget;
+                }
+            }
+            nx.push_back(x_.back());
+            ny.push_back(y_.back());
+
+            if (nx.size() == x_.size()) break;
+
+            x_.swap(nx);
+            y_.swap(ny);
+            compute_slopes();
+        }
+
+        if (report == nullptr) return;
+
+        TableReport r;
+        r.points          = x_.size();
+        r.monotone        = true;
+        r.sign_preserving = true;
+
+        double prev = -std::numeric_limits<double>::infinity();
+
+        for (std::size_t i = 0; i + 1 < x_.size(); ++i)
+        {
+            for (int q = 0; q < 4; ++q)
+            {
+                const double x = x_[i] + (x_[i + 1] - x_[i]) * (0.25 * q);
+                const double v = evaluate(x);
+
+                if (q > 0)
+                {
+                    const double err = std::fabs(v - fn(x));
+                    if (err > r.max_abs_error)
+                    {
+                        r.max_abs_error = err;
+                        r.max_error_at  = x;
+                    }
+                }
+
+                if (v < prev) r.monotone = false;
+                prev = v;
+
+                if ((x > 0.0 && v < 0.0) || (x < 0.0 && v > 0.0)) r.sign_preserving = false;
+            }
+        }
+        if (evaluate(hi_) < prev) r.monotone = false;
+
+        // Closest inputs to the origin on both sides.
+        const double tiny = std::numeric_limits<double>::denorm_min();
+        if (lo_ < 0.0 && hi_ > 0.0)
+        {
+            if (evaluate(tiny) < 0.0 || evaluate(-tiny) > 0.0) r.sign_preserving = false;
+        }
+
+        *report = r;
+    }
+
+    void LookupTable::compute_slopes()
+    {
+        if (interpolation_ != Interpolation::Cubic)
+        {
+            d_.clear();
+            return;
+        }
+
+        const std::size_t n = x_.size();
+        d_.assign(n, 0.0);
+
+        std::vector<double> h(n - 1);
+        std::vector<double> delta(n - 1);
+        for (std::size_t k = 0; k + 1 < n; ++k)
+        {
+            h[k]     = x_[k + 1] - x_[k];
+            delta[k] = (y_[k + 1] - y_[k]) / h[k];
+        }
+
+        d_[0]     = delta[0];
+        d_[n - 1] = delta[n - 2];
+
+        // Fritsch–Butland weighted harmonic mean: keeps each segment
+        // monotone whenever the data is.
+        for (std::size_t k = 1; k + 1 < n; ++k)
+        {
+            if (delta[k - 1] * delta[k] <= 0.0)
+            {
+                d_[k] = 0.0;
+                continue;
+            }
+
+            const double w1 = 2.0 * h[k] + h[k - 1];
+            const double w2 = h[k] + 2.0 * h[k - 1];
+            d_[k] = (w1 + w2) / (w1 / delta[k - 1] + w2 / delta[k]);
+        }
+    }
+
+    double LookupTable::interpolate(std::size_t i, double x) const
+    {
+        const double h  = x_[i + 1] - x_[i];
+        const double t  = (x - x_[i]) / h;
+        const double y0 = y_[i];
+        const double y1 = y_[i + 1];
+
+        if (interpolation_ == Interpolation::Linear)
+        {
+            return y0 + t * (y1 - y0);
+        }
+
+        const double t2  = t * t;
+        const double s   = 1.0 - t;
+        const double h00 = (1.0 + 2.0 * t) * s * s;
+        const double h10 = t * s * s;
+        const double h01 = t2 * (3.0 - 2.0 * t);
+        const double h11 = t2 * (t - 1.0);
+
+        return h00 * y0 + h10 * h * d_[i] + h01 * y1 + h11 * h * d_[i + 1];
+    }
+
+    double LookupTable::evaluate(double x) const
+    {
+        if (x != x) return x; // NaN
+
+        x = x < lo_ ? lo_ : (x > hi_ ? hi_ : x);
+
+        const std::size_t last = x_.size() - 2;
+        std::size_t       i    = 0;
+
+        if (uniform_)
+        {
+            i = static_cast<std::size_t>((x - lo_) * inv_step_);
+            i = i > last ? last : i;
+        }
+        else
+        {
+            // Branchless lower bound; the iteration count depends only on
+            // the table size.
+            std::size_t len = last + 1;
+            while (len > 1)
+            {
+                const std::size_t half = len / 2;
+                i   = (x_[i + half] <= x) ? i + half : i;
+                len -= half;
+            }
+        }
+
+        return interpolate(i, x);
+    }
+
+    void LookupTable::evaluate_batch(const double* in, double* out, std::size_t n) const
+    {
+        const std::size_t last  = x_.size() - 2;
+        const double*     xs    = x_.data();
+        const double*     ys    = y_.data();
+        const double*     ds    = d_.data();
+        const bool        cubic = interpolation_ == Interpolation::Cubic;
+
+        double      xc[BATCH_BLOCK];
+        std::size_t idx[BATCH_BLOCK];
+        double      x0[BATCH_BLOCK];
+        double      x1[BATCH_BLOCK];
+        double      y0[BATCH_BLOCK];
+        double      y1[BATCH_BLOCK];
+        double      d0[BATCH_BLOCK];
+        double      d1[BATCH_BLOCK];
+
+        for (std::size_t begin = 0; begin < n; begin += BATCH_BLOCK)
+        {
+            const std::size_t m = n - begin < BATCH_BLOCK ? n - begin : BATCH_BLOCK;
+
+            // Clamp the whole block first; the input is read only here, so
+            // in and out may alias. NaN passes through the clamp unchanged.
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                const double x = in[begin + k];
+                xc[k] = x < lo_ ? lo_ : (x > hi_ ? hi_ : x);
+            }
+
+            // Segment indices, same arithmetic as evaluate(). NaN is located
+            // at lo_ so the index stays valid; its result is discarded below.
+            if (uniform_)
+            {
+                for (std::size_t k = 0; k < m; ++k)
+                {
+                    const double      x = xc[k] != xc[k] ? lo_ : xc[k];
+                    const std::size_t i = static_cast<std::size_t>((x - lo_) * inv_step_);
+                    idx[k] = i > last ? last : i;
+                }
+            }
+            else
+            {
+                // The branchless search runs step by step across the block;
+                // the step sequence depends only on the table size.
+                for (std::size_t k = 0; k < m; ++k) idx[k] = 0;
+                for (std::size_t len = last + 1; len > 1; )
+                {
+                    const std::size_t half = len / 2;
+                    for (std::size_t k = 0; k < m; ++k)
+                    {
+                        idx[k] = (xs[idx[k] + half] <= xc[k]) ? idx[k] + half : idx[k];
+                    }
+                    len -= half;
+                }
+            }
+
+            // Gather the segment endpoints.
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                const std::size_t i = idx[k];
+                x0[k] = xs[i];
+                x1[k] = xs[i + 1];
+                y0[k] = ys[i];
+                y1[k] = ys[i + 1];
+            }
+
+            // Interpolate; the expressions match interpolate() term for term.
+            if (!cubic)
+            {
+                for (std::size_t k = 0; k < m; ++k)
+                {
+                    const double t = (xc[k] - x0[k]) / (x1[k] - x0[k]);
+                    const double v = y0[k] + t * (y1[k] - y0[k]);
+                    out[begin + k] = xc[k] != xc[k] ? xc[k] : v;
+                }
+                continue;
+            }
+
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                d0[k] = ds[idx[k]];
+                d1[k] = ds[idx[k] + 1];
+            }
+            for (std::size_t k = 0; k < m; ++k)
+            {
+                const double h   = x1[k] - x0[k];
+                const double t   = (xc[k] - x0[k]) / h;
+                const double t2  = t * t;
+                const double s   = 1.0 - t;
+                const double h00 = (1.0 + 2.0 * t) * s * s;
+                const double h10 = t * s * s;
+                const double h01 = t2 * (3.0 - 2.0 * t);
+                const double h11 = t2 * (t - 1.0);
+                const double v   = h00 * y0[k] + h10 * h * d0[k] + h01 * y1[k] + h11 * h * d1[k];
+                out[begin + k] = xc[k] != xc[k] ? xc[k] : v;
+            }
+        }
+    }
+
+    std::size_t LookupTable::size() const
+    {
+        return x_.size();
+    }
+
+    double LookupTable::lo() const
+    {
+        return lo_;
+    }
+
+    double LookupTable::hi() const
+    {
+        return hi_;
+    }
+
+    // -------------------------------------------------------------------------
+    // Tabulated operators
+    // -------------------------------------------------------------------------
+
+    TabulatedFOperator::TabulatedFOperator(const FOperator& source, const TableSpec& spec, TableReport* report)
+        : table_([&source](double x) { return source.apply(x); }, spec, report)
+    {
+    }
+
+    double TabulatedFOperator::apply(double delta) const
+    {
+        return table_.evaluate(delta);
+    }
+
+    void TabulatedFOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        table_.evaluate_batch(in, out, n);
+    }
+
+    const LookupTable& TabulatedFOperator::table() const
+    {
+        return table_;
+    }
+
+    TabulatedEOperator::TabulatedEOperator(const EOperator& source, const TableSpec& spec, TableReport* report)
+        : table_([&source](double x) { return source.apply(x); }, spec, report)
+    {
+    }
+
+    double TabulatedEOperator::apply(double x) const
+    {
+        return table_.evaluate(x);
+    }
+
+    void TabulatedEOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        table_.evaluate_batch(in, out, n);
+    }
+
+    const LookupTable& TabulatedEOperator::table() const
+    {
+        return table_;
+    }
+
+    TabulatedFInvOperator::TabulatedFInvOperator(const FInvOperator& source, const TableSpec& spec, TableReport* report)
+        : table_([&source](double x) { return source.apply(x); }, spec, report)
+    {
+    }
+
+    double TabulatedFInvOperator::apply(double x) const
+    {
+        return table_.evaluate(x);
+    }
+
+    void TabulatedFInvOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        table_.evaluate_batch(in, out, n);
+    }
+
+    const LookupTable& TabulatedFInvOperator::table() const
+    {
+        return table_;
+    }
+
+    TabulatedGOperator::TabulatedGOperator(const GOperator& source, const TableSpec& spec, TableReport* report)
+        : table_([&source](double x) { return source.apply(x); }, spec, report)
+    {
+    }
+
+    double TabulatedGOperator::apply(double delta) const
+    {
+        return table_.evaluate(delta);
+    }
+
+    void TabulatedGOperator::apply_batch(const double* in, double* out, std::size_t n) const
+    {
+        table_.evaluate_batch(in, out, n);
+    }
+
+    const LookupTable& TabulatedGOperator::table() const
+    {
+        return table_;
+    }
+}
@@ -0,0 +1,341 @@
+#include "ect_telemetry.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    namespace
+    {
+        constexpr char          MAGIC[8]    = { 'E', 'C', 'T', 'T', 'E', 'L', 'E', 'M' };
+        constexpr std::uint32_t VERSION     = 1;
+        constexpr std::size_t   RECORD_SIZE = 32;
+        constexpr std::size_t   HEADER_SIZE = 16;
+
+        // Longest CSV line: 20-digit step, 10-digit channel, two %.17g
+        // doubles (<= 24 chars each), a 2-char flag, separators, newline.
+        constexpr std::size_t CSV_LINE_MAX = 96;
+
+        std::size_t round_up_pow2(std::size_t n)
+        {
+            std::size_t p = 2;
+            while (p < n) p <<= 1;
+            return p;
+        }
+
+        void pack(const TelemetryRecord& r, char* out)
+        {
+            std::memset(out, 0, RECORD_SIZE);
+            std::memcpy(out + 0,  &r.step,       sizeof(r.step));
+            std::memcpy(out + 8,  &r.delta,      sizeof(r.delta));
+            std::memcpy(out + 16, &r.u,          sizeof(r.u));
+            std::memcpy(out + 24, &r.channel,    sizeof(r.channel));
+            std::memcpy(out + 28, &r.saturation, sizeof(r.saturation));
+        }
+
+        TelemetryRecord unpack(const char* in)
+        {
+            TelemetryRecord r;
+            std::memcpy(&r.step,       in + 0,  sizeof(r.step));
+            std::memcpy(&r.delta,      in + 8,  sizeof(r.delta));
+            std::memcpy(&r.u,          in + 16, sizeof(r.u));
+            std::memcpy(&r.channel,    in + 24, sizeof(r.channel));
+            std::memcpy(&r.saturation, in + 28, sizeof(r.saturation));
+            return r;
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // TelemetryRing
+    // -------------------------------------------------------------------------
+
+    TelemetryRing::TelemetryRing(std::size_t capacity)
+        : slots_(new Slot[round_up_pow2(capacity)])
+        , mask_(round_up_pow2(capacity) - 1)
+    {
+        for (std::size_t i = 0; i <= mask_; ++i)
+        {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t TelemetryRing::capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    bool TelemetryRing::try_push(const TelemetryRecord& record) noexcept
+    {
+        std::size_t pos = head_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Slot&             slot = slots_[pos & mask_];
+            const std::size_t seq  = slot.sequence.load(std::memory_order_acquire);
+            const std::intptr_t diff = static_cast<std::intptr_t>(seq) - static_cast<std::intptr_t>(pos);
+
+            if (diff == 0)
+            {
+                if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    slot.record = record;
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;   // full: the consumer has not released this slot yet
+            }
+            else
+            {
+                pos = head_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TelemetryRing::try_pop(TelemetryRecord& record) noexcept
+    {
+        const std::size_t pos  = tail_.load(std::memory_order_relaxed);
+        Slot&             slot = slots_[pos & mask_];
+
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+        {
+            return false;   // empty, or the producer is still writing
+        }
+
+        record = slot.record;
+        slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+        tail_.store(pos + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // -------------------------------------------------------------------------
+    // TelemetrySink
+    // -------------------------------------------------------------------------
+
+    TelemetrySink::TelemetrySink(const std::string& path, const TelemetryOptions& options)
+        : ring_(options.capacity)
+        , options_(options)
+    {
+        if (options_.batch == 0)
+        {
+            throw std::invalid_argument("TelemetrySink: batch must be > 0");
+        }
+
+        file_ = std::fopen(path.c_str(), options_.format == TelemetryFormat::Csv ? "w" : "wb");
+        if (file_ == nullptr)
+        {
+            throw std::runtime_error(path + ": cannot open telemetry file");
+        }
+
+        batch_.resize(options_.batch);
+        text_.resize(options_.batch * (options_.format == TelemetryFormat::Csv ? CSV_LINE_MAX : RECORD_SIZE));
+
+        if (options_.format == TelemetryFormat::Csv)
+        {
+            std::fputs("step,channel,delta,u,saturation\n", file_);
+        }
+        else
+        {
+            char header[HEADER_SIZE];
+            const std::uint32_t record_size = RECORD_SIZE;
+            std::memcpy(header, MAGIC, sizeof(MAGIC));
+            std::memcpy(header + 8,  &VERSION,     sizeof(VERSION));
+            std::memcpy(header + 12, &record_size, sizeof(record_size));
+            std::fwrite(header, 1, HEADER_SIZE, file_);
+        }
+
+        writer_ = std::thread([this] { writer_loop(); });
+    }
+
+    TelemetrySink::~TelemetrySink()
+    {
+        try
+        {
+            close();
+        }
+        catch (...)
+        {
+        }
+    }
+
+    std::uint64_t TelemetrySink::dropped() const
+    {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    std::uint64_t TelemetrySink::written() const
+    {
+        return written_.load(std::memory_order_relaxed);
+    }
+
+    void TelemetrySink::writer_loop()
+    {
+        const auto interval = std::chrono::microseconds(options_.poll_interval_us);
+
+        for (;;)
+        {
+            std::size_t n = 0;
+            while (n < batch_.size() && ring_.try_pop(batch_[n]))
+            {
+                ++n;
+            }
+
+            if (n > 0)
+            {
+                write_batch(batch_.data(), n);
+                continue;
+            }
+
+            // Ring empty. closing_ is set before the final wake-up, so one
+            // more drain after observing it picks up every accepted record.
+            if (closing_.load(std::memory_order_acquire))
+            {
+                while (n < batch_.size() && ring_.try_pop(batch_[n]))
+                {
+                    ++n;
+                }
+                if (n == 0) break;
+                write_batch(batch_.data(), n);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait_for(lock, interval, [this] { return closing_.load(std::memory_order_acquire); });
+        }
+    }
+
+    void TelemetrySink::write_batch(const TelemetryRecord* records, std::size_t n)
+    {
+        char*       out  = text_.data();
+        std::size_t used = 0;
+
+        if (options_.format == TelemetryFormat::Csv)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const TelemetryRecord& r = records[i];
+                const int len = std::snprintf(
+                    out + used, CSV_LINE_MAX, "%llu,%lu,%.17g,%.17g,%d\n",
+                    static_cast<unsigned long long>(r.step),
+                    static_cast<unsigned long>(r.channel),
+                    r.delta, r.u, static_cast<int>(r.saturation));
+                if (len > 0)
+                {
+                    used += static_cast<std::size_t>(len) < CSV_LINE_MAX ? static_cast<std::size_t>(len) : CSV_LINE_MAX - 1;
+                }
+            }
+        }
+        else
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                pack(records[i], out + used);
+                used += RECORD_SIZE;
+            }
+        }
+
+        if (std::fwrite(out, 1, used, file_) != used)
+        {
+            failed_.store(true, std::memory_order_relaxed);
+        }
+        written_.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void TelemetrySink::close()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_) return;
+            closed_ = true;
+            closing_.store(true);
+        }
+        wake_.notify_one();
+        writer_.join();
+
+        // A push that saw closing_ still false may land after the writer's
+        // last drain. closing_ and pushing_ are both sequentially
+        // consistent, so once no push is in flight every accepted record is
+        // in the ring.
+        while (pushing_.load() != 0)
+        {
+            std::this_thread::yield();
+        }
+        for (;;)
+        {
+            std::size_t n = 0;
+            while (n < batch_.size() && ring_.try_pop(batch_[n]))
+            {
+                ++n;
+            }
+            if (n == 0) break;
+            write_batch(batch_.data(), n);
+        }
+
+        if (std::fclose(file_) != 0)
+        {
+            failed_.store(true, std::memory_order_relaxed);
+        }
+        file_ = nullptr;
+
+        if (failed_.load(std::memory_order_relaxed))
+        {
+            throw std::runtime_error("TelemetrySink: write failed");
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // Reading
+    // -------------------------------------------------------------------------
+
+    std::vector<TelemetryRecord> read_telemetry(const std::string& path)
+    {
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        if (f == nullptr)
+        {
+            throw std::runtime_error(path + ": cannot open telemetry file");
+        }
+
+        char          header[HEADER_SIZE];
+        std::uint32_t version     = 0;
+        std::uint32_t record_size = 0;
+        const bool    ok = std::fread(header, 1, HEADER_SIZE, f) == HEADER_SIZE;
+        if (ok)
+        {
+            std::memcpy(&version,     header + 8,  sizeof(version));
+            std::memcpy(&record_size, header + 12, sizeof(record_size));
+        }
+        if (!ok || std::memcmp(header, MAGIC, sizeof(MAGIC)) != 0 || version != VERSION || record_size != RECORD_SIZE)
+        {
+            std::fclose(f);
+            throw std::runtime_error(path + ": not a binary telemetry file");
+        }
+
+        std::vector<TelemetryRecord> records;
+        char buffer[RECORD_SIZE * 256];
+        for (;;)
+        {
+            const std::size_t got = std::fread(buffer, 1, sizeof(buffer), f);
+            for (std::size_t i = 0; i + RECORD_SIZE <= got; i += RECORD_SIZE)
+            {
+                records.push_back(unpack(buffer + i));
+            }
+            if (got % RECORD_SIZE != 0)
+            {
+                std::fclose(f);
+                throw std::runtime_error(path + ": truncated telemetry record");
+            }
+            if (got < sizeof(buffer)) break;
+        }
+
+        const bool read_error = std::ferror(f) != 0;
+        std::fclose(f);
+        if (read_error)
+        {
+            throw std::runtime_error(path + ": read error");
+        }
+        return records;
+    }
+
+} // namespace ect::sdk
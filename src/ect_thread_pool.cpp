@@ -0,0 +1,153 @@
+#include "ect_thread_pool.hpp"
+#include "ect_thread_util.hpp"
+
+namespace ect::sdk
+{
+    ThreadPool::ThreadPool(const ThreadPoolOptions& options)
+        : size_(options.threads)
+    {
+        if (size_ == 0)
+        {
+            size_ = std::thread::hardware_concurrency();
+            if (size_ == 0) size_ = 1;
+        }
+
+        slots_.reset(new Slot[size_]);
+
+        pinned_ = options.pin_threads && size_ > 1;
+        workers_.reserve(size_ - 1);
+
+        for (std::size_t w = 1; w < size_; ++w)
+        {
+            workers_.emplace_back(&ThreadPool::worker_loop, this, w);
+
+            if (options.pin_threads)
+            {
+                const std::size_t k   = w - 1;
+                const int         cpu = options.cpus.empty()
+                    ? static_cast<int>(k)
+                    : options.cpus[k % options.cpus.size()];
+
+                pinned_ = detail::pin_to_cpu(workers_.back(), cpu) && pinned_;
+            }
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+
+        for (std::thread& t : workers_)
+        {
+            t.join();
+        }
+    }
+
+    std::size_t ThreadPool::size() const
+    {
+        return size_;
+    }
+
+    bool ThreadPool::pinned() const
+    {
+        return pinned_;
+    }
+
+    void ThreadPool::parallel_for(
+        std::size_t n,
+        std::size_t grain,
+        const std::function<void(std::size_t, std::size_t)>& fn
+    )
+    {
+        if (n == 0) return;
+        if (grain == 0) grain = 1;
+
+        std::lock_guard<std::mutex> submit(submit_mutex_);
+
+        const std::size_t chunks = (n + grain - 1) / grain;
+
+        if (size_ == 1 || chunks == 1)
+        {
+            for (std::size_t begin = 0; begin < n; begin += grain)
+            {
+                fn(begin, begin + grain < n ? begin + grain : n);
+            }
+            return;
+        }
+
+        // Contiguous block of chunk indices per participant.
+        for (std::size_t w = 0; w < size_; ++w)
+        {
+            slots_[w].next.store(chunks * w / size_, std::memory_order_relaxed);
+            slots_[w].end = chunks * (w + 1) / size_;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            fn_       = &fn;
+            n_        = n;
+            grain_    = grain;
+            finished_ = 0;
+            ++generation_;
+        }
+        wake_.notify_all();
+
+        run_chunks(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++finished_;
+        done_.wait(lock, [this] { return finished_ == size_; });
+        fn_ = nullptr;
+    }
+
+    void ThreadPool::worker_loop(std::size_t index)
+    {
+        std::uint64_t seen = 0;
+
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+            }
+
+            run_chunks(index);
+
+            bool last = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                last = (++finished_ == size_);
+            }
+            if (last) done_.notify_one();
+        }
+    }
+
+    void ThreadPool::run_chunks(std::size_t index)
+    {
+        const auto& fn    = *fn_;
+        const std::size_t n     = n_;
+        const std::size_t grain = grain_;
+
+        // Own block first, then steal from the others in ring order.
+        for (std::size_t k = 0; k < size_; ++k)
+        {
+            Slot& slot = slots_[(index + k) % size_];
+
+            for (;;)
+            {
+                const std::size_t c = slot.next.fetch_add(1, std::memory_order_relaxed);
+                if (c >= slot.end) break;
+
+                const std::size_t begin = c * grain;
+                fn(begin, begin + grain < n ? begin + grain : n);
+            }
+        }
+    }
+
+} // namespace ect::sdk
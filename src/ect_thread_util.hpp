@@ -0,0 +1,54 @@
+#ifndef ECT_SDK_THREAD_UTIL_HPP
+#define ECT_SDK_THREAD_UTIL_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ect::sdk::detail
+{
+    // Nanoseconds from a to b on the steady clock.
+    inline std::uint64_t ns(std::chrono::steady_clock::time_point a, std::chrono::steady_clock::time_point b)
+    {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(b - a).count());
+    }
+
+    // Single-writer counter update, as in the histograms: a plain load and
+    // store instead of a read-modify-write. Readers that must see the
+    // writes the counter covers pass a release order here and acquire on
+    // their side.
+    inline void bump(
+        std::atomic<std::uint64_t>& c,
+        std::uint64_t               by    = 1,
+        std::memory_order           order = std::memory_order_relaxed
+    )
+    {
+        c.store(c.load(std::memory_order_relaxed) + by, order);
+    }
+
+    // Restricts t to one CPU. Returns false if the CPU is out of range,
+    // the call fails or the platform has no affinity API.
+    inline bool pin_to_cpu(std::thread& t, int cpu)
+    {
+#if defined(__linux__)
+        if (cpu < 0 || cpu >= CPU_SETSIZE) return false;
+
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return pthread_setaffinity_np(t.native_handle(), sizeof(set), &set) == 0;
+#else
+        (void)t;
+        (void)cpu;
+        return false;
+#endif
+    }
+}
+
+#endif // ECT_SDK_THREAD_UTIL_HPP
@@ -0,0 +1,489 @@
+#include "ect_trace.hpp"
+#include "ect_sdk.hpp"
+#include "ect_thread_pool.hpp"
+
+#include "ect_mapped_file.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <vector>
+
+namespace ect::sdk
+{
+    namespace
+    {
+        constexpr char        MAGIC[8]     = { 'E', 'C', 'T', 'T', 'R', 'A', 'C', 'E' };
+        constexpr std::size_t HEADER_SIZE  = 64;
+        constexpr std::size_t COLUMN_ALIGN = 64;
+
+        struct Header
+        {
+            char          magic[8];
+            std::uint32_t version;
+            std::uint32_t columns;
+            std::uint64_t samples;
+            std::uint64_t offset[TRACE_COLUMN_COUNT];
+        };
+
+        static_assert(sizeof(Header) == HEADER_SIZE, "trace header layout");
+
+        constexpr std::size_t ELEMENT_SIZE[TRACE_COLUMN_COUNT] = {
+            sizeof(std::int64_t),   // Timestamp
+            sizeof(double),         // Deviation
+            sizeof(double),         // Target
+            sizeof(double),         // Output
+            sizeof(std::int8_t)     // Saturation
+        };
+
+        std::size_t align_up(std::size_t n)
+        {
+            return (n + COLUMN_ALIGN - 1) / COLUMN_ALIGN * COLUMN_ALIGN;
+        }
+
+        // Fills header.offset for `capacity` rows and returns the file size.
+        std::size_t layout(Header& header, std::uint32_t columns, std::size_t capacity)
+        {
+            std::size_t end = HEADER_SIZE;
+            for (std::size_t c = 0; c < TRACE_COLUMN_COUNT; ++c)
+            {
+                header.offset[c] = 0;
+                if (columns & (std::uint32_t(1) << c))
+                {
+                    if (capacity > (std::numeric_limits<std::size_t>::max() - end) / ELEMENT_SIZE[c] - COLUMN_ALIGN)
+                    {
+                        throw std::length_error("TraceWriter: capacity too large");
+                    }
+                    header.offset[c] = end;
+                    end = align_up(end + capacity * ELEMENT_SIZE[c]);
+                }
+            }
+            return end;
+        }
+
+        unsigned char* base(const std::unique_ptr<detail::MappedFile>& file)
+        {
+            return static_cast<unsigned char*>(file->data());
+        }
+    }
+
+    const char* trace_column_name(TraceColumn column)
+    {
+        switch (column)
+        {
+            case TraceColumn::Timestamp:  return "timestamp";
+            case TraceColumn::Deviation:  return "deviation";
+            case TraceColumn::Target:     return "target";
+            case TraceColumn::Output:     return "output";
+            case TraceColumn::Saturation: return "saturation";
+        }
+        return "unknown";
+    }
+
+    // -------------------------------------------------------------------------
+    // TraceReader
+    // -------------------------------------------------------------------------
+
+    TraceReader::TraceReader(const std::string& path)
+        : file_(new detail::MappedFile(path, detail::MappedFile::Mode::ReadOnly))
+    {
+        if (file_->size() < HEADER_SIZE)
+        {
+            throw std::runtime_error(path + ": not a trace file (too short)");
+        }
+
+        Header header;
+        std::memcpy(&header, file_->data(), HEADER_SIZE);
+
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        {
+            throw std::runtime_error(path + ": not a trace file (bad magic)");
+        }
+        if (header.version != TRACE_VERSION)
+        {
+            throw std::runtime_error(path + ": unsupported trace version " + std::to_string(header.version));
+        }
+        if ((header.columns & ~TRACE_ALL_COLUMNS) != 0)
+        {
+            throw std::runtime_error(path + ": unknown trace columns");
+        }
+
+        const std::uint64_t size = file_->size();
+        for (std::size_t c = 0; c < TRACE_COLUMN_COUNT; ++c)
+        {
+            if (!(header.columns & (std::uint32_t(1) << c))) continue;
+
+            const std::uint64_t offset = header.offset[c];
+            if (offset < HEADER_SIZE || offset % COLUMN_ALIGN != 0 || offset > size
+                || header.samples > (size - offset) / ELEMENT_SIZE[c])
+            {
+                throw std::runtime_error(path + ": trace column '"
+                    + trace_column_name(static_cast<TraceColumn>(c)) + "' out of bounds");
+            }
+        }
+
+        samples_ = static_cast<std::size_t>(header.samples);
+        columns_ = header.columns;
+        file_->advise_sequential();
+    }
+
+    TraceReader::~TraceReader() = default;
+
+    TraceReader::TraceReader(TraceReader&&) noexcept            = default;
+    TraceReader& TraceReader::operator=(TraceReader&&) noexcept = default;
+
+    std::size_t TraceReader::samples() const
+    {
+        return samples_;
+    }
+
+    std::uint32_t TraceReader::columns() const
+    {
+        return columns_;
+    }
+
+    bool TraceReader::has(TraceColumn column) const
+    {
+        return (columns_ & trace_column_bit(column)) != 0;
+    }
+
+    const void* TraceReader::column(TraceColumn column) const
+    {
+        if (!has(column)) return nullptr;
+
+        std::uint64_t offset;
+        std::memcpy(&offset,
+                    base(file_) + offsetof(Header, offset) + static_cast<std::size_t>(column) * sizeof(offset),
+                    sizeof(offset));
+        return base(file_) + offset;
+    }
+
+    const std::int64_t* TraceReader::timestamp() const
+    {
+        return static_cast<const std::int64_t*>(column(TraceColumn::Timestamp));
+    }
+
+    const double* TraceReader::deviation() const
+    {
+        return static_cast<const double*>(column(TraceColumn::Deviation));
+    }
+
+    const double* TraceReader::target() const
+    {
+        return static_cast<const double*>(column(TraceColumn::Target));
+    }
+
+    const double* TraceReader::output() const
+    {
+        return static_cast<const double*>(column(TraceColumn::Output));
+    }
+
+    const std::int8_t* TraceReader::saturation() const
+    {
+        return static_cast<const std::int8_t*>(column(TraceColumn::Saturation));
+    }
+
+    // -------------------------------------------------------------------------
+    // TraceWriter
+    // -------------------------------------------------------------------------
+
+    TraceWriter::TraceWriter(const std::string& path, std::size_t capacity, std::uint32_t columns)
+        : capacity_(capacity)
+        , columns_(columns)
+    {
+        if ((columns & ~TRACE_ALL_COLUMNS) != 0)
+        {
+            throw std::invalid_argument("TraceWriter: unknown trace columns");
+        }
+
+        Header header;
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = TRACE_VERSION;
+        header.columns = columns;
+        header.samples = 0;
+
+        const std::size_t bytes = layout(header, columns, capacity);
+
+        file_.reset(new detail::MappedFile(path, detail::MappedFile::Mode::Create, bytes));
+        std::memcpy(file_->data(), &header, HEADER_SIZE);
+    }
+
+    TraceWriter::~TraceWriter()
+    {
+        try
+        {
+            if (file_ && file_->is_open())
+            {
+                close();
+            }
+        }
+        catch (...)
+        {
+        }
+    }
+
+    TraceWriter::TraceWriter(TraceWriter&&) noexcept = default;
+
+    TraceWriter& TraceWriter::operator=(TraceWriter&& other) noexcept
+    {
+        if (this != &other)
+        {
+            // Finish the current trace instead of dropping its header update.
+            try
+            {
+                if (file_ && file_->is_open())
+                {
+                    close();
+                }
+            }
+            catch (...)
+            {
+            }
+
+            file_     = std::move(other.file_);
+            capacity_ = other.capacity_;
+            size_     = other.size_;
+            columns_  = other.columns_;
+        }
+        return *this;
+    }
+
+    std::size_t TraceWriter::capacity() const
+    {
+        return capacity_;
+    }
+
+    std::size_t TraceWriter::size() const
+    {
+        return size_;
+    }
+
+    std::uint32_t TraceWriter::columns() const
+    {
+        return columns_;
+    }
+
+    bool TraceWriter::has(TraceColumn column) const
+    {
+        return (columns_ & trace_column_bit(column)) != 0;
+    }
+
+    void* TraceWriter::column(TraceColumn column)
+    {
+        if (!has(column) || !file_ || !file_->is_open()) return nullptr;
+
+        std::uint64_t offset;
+        std::memcpy(&offset,
+                    base(file_) + offsetof(Header, offset) + static_cast<std::size_t>(column) * sizeof(offset),
+                    sizeof(offset));
+        return base(file_) + offset;
+    }
+
+    std::int64_t* TraceWriter::timestamp()
+    {
+        return static_cast<std::int64_t*>(column(TraceColumn::Timestamp));
+    }
+
+    double* TraceWriter::deviation()
+    {
+        return static_cast<double*>(column(TraceColumn::Deviation));
+    }
+
+    double* TraceWriter::target()
+    {
+        return static_cast<double*>(column(TraceColumn::Target));
+    }
+
+    double* TraceWriter::output()
+    {
+        return static_cast<double*>(column(TraceColumn::Output));
+    }
+
+    std::int8_t* TraceWriter::saturation()
+    {
+        return static_cast<std::int8_t*>(column(TraceColumn::Saturation));
+    }
+
+    void TraceWriter::append(const TraceSample& sample)
+    {
+        if (size_ >= capacity_)
+        {
+            throw std::length_error("TraceWriter::append: trace is full");
+        }
+
+        const std::size_t i = size_;
+        if (std::int64_t* p = timestamp())  p[i] = sample.timestamp;
+        if (double*       p = deviation())  p[i] = sample.deviation;
+        if (double*       p = target())     p[i] = sample.target;
+        if (double*       p = output())     p[i] = sample.output;
+        if (std::int8_t*  p = saturation()) p[i] = sample.saturation;
+        ++size_;
+    }
+
+    void TraceWriter::commit(std::size_t n)
+    {
+        if (n > capacity_)
+        {
+            throw std::length_error("TraceWriter::commit: n exceeds capacity");
+        }
+        size_ = n;
+    }
+
+    void TraceWriter::close()
+    {
+        if (!file_ || !file_->is_open())
+        {
+            throw std::logic_error("TraceWriter::close: already closed");
+        }
+
+        const std::uint64_t samples = size_;
+        std::memcpy(base(file_) + offsetof(Header, samples), &samples, sizeof(samples));
+        file_->close();
+    }
+
+    // -------------------------------------------------------------------------
+    // Replay
+    // -------------------------------------------------------------------------
+
+    namespace
+    {
+        struct ReplayJob
+        {
+            const Controller*    controller;
+            const TraceReader*   in;
+            TraceWriter*         out;
+            const ReplayOptions* options;
+        };
+
+        template <typename T>
+        void carry(const T* from, T* to, std::size_t begin, std::size_t end)
+        {
+            if (from != nullptr && to != nullptr)
+            {
+                std::memcpy(to + begin, from + begin, (end - begin) * sizeof(T));
+            }
+        }
+
+        ReplaySummary replay_range(const ReplayJob& job, std::size_t begin, std::size_t end)
+        {
+            TraceWriter&       out = *job.out;
+            const TraceReader& in  = *job.in;
+
+            // The flags come from the G stage's own clamp classification,
+            // written straight into the saturation column when there is one.
+            thread_local std::vector<std::int8_t> scratch;
+
+            std::int8_t* sat  = out.saturation();
+            std::int8_t* flag = sat + begin;
+            if (sat == nullptr)
+            {
+                scratch.resize(end - begin);
+                flag = scratch.data();
+            }
+
+            double* u = out.output();
+            job.controller->evaluate_batch(in.deviation() + begin, u + begin, nullptr, flag, end - begin);
+
+            carry(in.timestamp(), out.timestamp(), begin, end);
+            carry(in.deviation(), out.deviation(), begin, end);
+            carry(in.target(),    out.target(),    begin, end);
+
+            ReplaySummary s;
+            s.samples = end - begin;
+            for (std::size_t i = 0; i < end - begin; ++i)
+            {
+                s.saturated_lower += (flag[i] < 0) ? 1 : 0;
+                s.saturated_upper += (flag[i] > 0) ? 1 : 0;
+                s.max_abs_output   = std::fmax(s.max_abs_output, std::fabs(u[begin + i]));
+            }
+            return s;
+        }
+
+        void merge(ReplaySummary& into, const ReplaySummary& part)
+        {
+            into.samples         += part.samples;
+            into.saturated_lower += part.saturated_lower;
+            into.saturated_upper += part.saturated_upper;
+            into.max_abs_output   = std::fmax(into.max_abs_output, part.max_abs_output);
+        }
+
+        void validate(const TraceReader& in, const TraceWriter& out, const ReplayOptions& options)
+        {
+            if (!in.has(TraceColumn::Deviation))
+            {
+                throw std::invalid_argument("replay: input trace has no deviation column");
+            }
+            if (!out.has(TraceColumn::Output))
+            {
+                throw std::invalid_argument("replay: output trace has no output column");
+            }
+            if (out.capacity() < in.samples())
+            {
+                throw std::invalid_argument("replay: output trace capacity is smaller than the input");
+            }
+            if (options.chunk == 0)
+            {
+                throw std::invalid_argument("replay: chunk must be > 0");
+            }
+        }
+    }
+
+    ReplaySummary replay(
+        const Controller&    controller,
+        const TraceReader&   in,
+        TraceWriter&         out,
+        const ReplayOptions& options
+    )
+    {
+        validate(in, out, options);
+
+        const ReplayJob job{ &controller, &in, &out, &options };
+
+        ReplaySummary summary;
+        for (std::size_t begin = 0; begin < in.samples(); begin += options.chunk)
+        {
+            const std::size_t end = std::min(in.samples(), begin + options.chunk);
+            merge(summary, replay_range(job, begin, end));
+        }
+
+        out.commit(in.samples());
+        return summary;
+    }
+
+    ReplaySummary replay(
+        const Controller&    controller,
+        const TraceReader&   in,
+        TraceWriter&         out,
+        const ReplayOptions& options,
+        ThreadPool&          pool
+    )
+    {
+        validate(in, out, options);
+
+        const ReplayJob job{ &controller, &in, &out, &options };
+
+        const std::size_t n      = in.samples();
+        const std::size_t chunks = (n + options.chunk - 1) / options.chunk;
+
+        // Chunk boundaries depend only on n and chunk; partial summaries are
+        // merged in chunk order.
+        std::vector<ReplaySummary> parts(chunks);
+        pool.parallel_for(n, options.chunk, [&](std::size_t begin, std::size_t end) {
+            parts[begin / options.chunk] = replay_range(job, begin, end);
+        });
+
+        ReplaySummary summary;
+        for (const ReplaySummary& part : parts)
+        {
+            merge(summary, part);
+        }
+
+        out.commit(n);
+        return summary;
+    }
+
+} // namespace ect::sdk
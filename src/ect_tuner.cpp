@@ -0,0 +1,355 @@
+#include "ect_tuner.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_simulation.hpp"
+#include "ect_thread_pool.hpp"
+#include "ect_trace.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace ect::sdk
+{
+    namespace
+    {
+        // Lane layout: candidate-major, then scenario, then (clean, noisy).
+        // Every candidate owns a contiguous block of lanes, so a task over a
+        // candidate range touches one contiguous slice of every column.
+        struct Workspace
+        {
+            explicit Workspace(std::size_t lanes)
+                : position(lanes)
+                , velocity(lanes, 0.0)
+                , delta(lanes)
+                , u(lanes)
+                , state(lanes)
+                , band(lanes)
+                , last_outside(lanes, 0)
+                , saturated(lanes, 0)
+                , noise_energy(lanes, 0.0)
+            {
+            }
+
+            std::vector<double>      position;
+            std::vector<double>      velocity;
+            std::vector<double>      delta;
+            std::vector<double>      u;
+            std::vector<std::int8_t> state;
+
+            // Meaningful on clean lanes only.
+            std::vector<double>      band;
+            std::vector<std::size_t> last_outside;
+            std::vector<std::size_t> saturated;
+            std::vector<double>      noise_energy;   // sum of (u_noisy - u_clean)^2
+        };
+
+        std::size_t validate(
+            const std::vector<TuningCandidate>& candidates,
+            const std::vector<TuningScenario>&  scenarios,
+            const TuningOptions&                options
+        )
+        {
+            if (scenarios.empty())
+            {
+                throw std::invalid_argument("tune: at least one scenario is required");
+            }
+
+            const std::size_t steps = scenarios.front().target.size();
+            for (const TuningScenario& s : scenarios)
+            {
+                if (s.target.size() != steps)
+                {
+                    throw std::invalid_argument("tune: all scenarios must have the same number of steps");
+                }
+            }
+            if (!options.noise.empty() && options.noise.size() < steps)
+            {
+                throw std::invalid_argument("tune: options.noise is shorter than the scenarios");
+            }
+            for (const TuningCandidate& c : candidates)
+            {
+                if (!(c.u_min <= c.u_max))
+                {
+                    throw std::invalid_argument("tune: candidate with u_min > u_max");
+                }
+            }
+            return steps;
+        }
+
+        ControllerBank make_lanes(const std::vector<TuningCandidate>& candidates, std::size_t per_candidate)
+        {
+            const std::size_t   lanes = candidates.size() * per_candidate;
+            std::vector<double> alpha(lanes), gain(lanes), u_min(lanes), u_max(lanes);
+
+            for (std::size_t c = 0; c < candidates.size(); ++c)
+            {
+                for (std::size_t l = c * per_candidate; l < (c + 1) * per_candidate; ++l)
+                {
+                    alpha[l] = candidates[c].alpha;
+                    gain[l]  = candidates[c].gain;
+                    u_min[l] = candidates[c].u_min;
+                    u_max[l] = candidates[c].u_max;
+                }
+            }
+            return ControllerBank(std::move(alpha), std::move(gain), std::move(u_min), std::move(u_max));
+        }
+
+        void run_candidates(
+            const ControllerBank&              bank,
+            const PlantModel&                  plant,
+            const std::vector<TuningScenario>& scenarios,
+            const TuningOptions&               options,
+            std::size_t                        steps,
+            Workspace&                         ws,
+            std::vector<TuningScore>&          scores,
+            std::size_t                        first,
+            std::size_t                        last
+        )
+        {
+            const bool        noisy = !options.noise.empty();
+            const std::size_t lanes = noisy ? 2 : 1;
+            const std::size_t per   = scenarios.size() * lanes;
+            const std::size_t begin = first * per;
+            const std::size_t end   = last * per;
+
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                ws.position[i] = scenarios[(i % per) / lanes].initial_position;
+            }
+
+            for (std::size_t k = 0; k < steps; ++k)
+            {
+                std::size_t i = begin;
+                for (std::size_t c = first; c < last; ++c)
+                {
+                    for (const TuningScenario& s : scenarios)
+                    {
+                        const double d = s.target[k] - ws.position[i];
+                        if (k == 0)
+                        {
+                            ws.band[i] = std::fmax(options.settling_fraction * std::fabs(d), options.settling_floor);
+                        }
+                        if (std::fabs(d) > ws.band[i])
+                        {
+                            ws.last_outside[i] = k + 1;
+                        }
+                        ws.delta[i] = d;
+
+                        if (noisy)
+                        {
+                            ws.delta[i + 1] = (s.target[k] - ws.position[i + 1]) + options.noise[k];
+                        }
+                        i += lanes;
+                    }
+                }
+
+                bank.evaluate_range(ws.delta.data(), ws.u.data(), ws.state.data(), begin, end);
+
+                for (std::size_t j = begin; j < end; j += lanes)
+                {
+                    ws.saturated[j] += ws.state[j] != 0 ? 1 : 0;
+                    if (noisy)
+                    {
+                        const double diff = ws.u[j + 1] - ws.u[j];
+                        ws.noise_energy[j] += diff * diff;
+                    }
+                }
+
+                plant.step(ws.position.data(), ws.velocity.data(), ws.u.data(), begin, end);
+            }
+
+            double noise_rms = 0.0;
+            if (noisy)
+            {
+                for (std::size_t k = 0; k < steps; ++k) noise_rms += options.noise[k] * options.noise[k];
+                noise_rms = steps > 0 ? std::sqrt(noise_rms / static_cast<double>(steps)) : 0.0;
+            }
+
+            const double n_steps     = static_cast<double>(steps);
+            const double n_scenarios = static_cast<double>(scenarios.size());
+
+            for (std::size_t c = first; c < last; ++c)
+            {
+                TuningScore score;
+                for (std::size_t j = c * per; j < (c + 1) * per; j += lanes)
+                {
+                    score.settling_steps += static_cast<double>(ws.last_outside[j]);
+                    if (steps > 0 && ws.last_outside[j] >= steps) ++score.unsettled;
+
+                    if (steps > 0)
+                    {
+                        score.saturation_duty += static_cast<double>(ws.saturated[j]) / n_steps;
+                    }
+                    if (noise_rms > 0.0)
+                    {
+                        score.noise_gain += std::sqrt(ws.noise_energy[j] / n_steps) / noise_rms;
+                    }
+                }
+                score.settling_steps  /= n_scenarios;
+                score.saturation_duty /= n_scenarios;
+                score.noise_gain      /= n_scenarios;
+                scores[c] = score;
+            }
+        }
+
+        template <typename Run>
+        TuningReport tune_with(
+            const std::vector<TuningCandidate>& candidates,
+            const PlantModel&                   plant,
+            const std::vector<TuningScenario>&  scenarios,
+            const TuningOptions&                options,
+            Run                                 run
+        )
+        {
+            const std::size_t steps = validate(candidates, scenarios, options);
+            const std::size_t per   = scenarios.size() * (options.noise.empty() ? 1 : 2);
+
+            const ControllerBank bank = make_lanes(candidates, per);
+            Workspace            ws(bank.size());
+
+            TuningReport report;
+            report.scores.resize(candidates.size());
+
+            run([&](std::size_t first, std::size_t last) {
+                run_candidates(bank, plant, scenarios, options, steps, ws, report.scores, first, last);
+            });
+
+            report.pareto = pareto_front(report.scores);
+            return report;
+        }
+    }
+
+    std::vector<TuningCandidate> tuning_grid(
+        const std::vector<double>& alphas,
+        const std::vector<double>& gains,
+        const std::vector<double>& bounds
+    )
+    {
+        std::vector<TuningCandidate> grid;
+        grid.reserve(alphas.size() * gains.size() * bounds.size());
+        for (double alpha : alphas)
+        {
+            for (double gain : gains)
+            {
+                for (double bound : bounds)
+                {
+                    grid.push_back(TuningCandidate{ alpha, gain, -bound, bound });
+                }
+            }
+        }
+        return grid;
+    }
+
+    TuningScenario tuning_scenario(const TargetProfile& target, double initial_position, std::size_t steps)
+    {
+        TuningScenario s;
+        s.initial_position = initial_position;
+        s.target.resize(steps);
+        for (std::size_t k = 0; k < steps; ++k)
+        {
+            s.target[k] = target.at(k);
+        }
+        return s;
+    }
+
+    TuningScenario tuning_scenario(const TraceReader& trace, double plant_gain)
+    {
+        const double* deviation = trace.deviation();
+        const double* output    = trace.output();
+        if (deviation == nullptr || output == nullptr)
+        {
+            throw std::invalid_argument("tuning_scenario: trace needs deviation and output columns");
+        }
+
+        TuningScenario s;
+        s.target.resize(trace.samples());
+
+        double position = 0.0;
+        for (std::size_t k = 0; k < trace.samples(); ++k)
+        {
+            s.target[k] = deviation[k] + position;
+            position   += plant_gain * output[k];
+        }
+        return s;
+    }
+
+    std::vector<double> deterministic_noise(std::size_t steps, double amplitude)
+    {
+        std::vector<double> noise(steps);
+        for (std::size_t k = 0; k < steps; ++k)
+        {
+            const double x = static_cast<double>(k);
+            noise[k] = amplitude * (0.6 * std::sin(0.37 * x) + 0.3 * std::sin(1.11 * x) + 0.1 * std::sin(2.73 * x));
+        }
+        return noise;
+    }
+
+    TuningReport tune(
+        const std::vector<TuningCandidate>& candidates,
+        const PlantModel&                   plant,
+        const std::vector<TuningScenario>&  scenarios,
+        const TuningOptions&                options
+    )
+    {
+        return tune_with(candidates, plant, scenarios, options, [&](const auto& fn) {
+            fn(std::size_t(0), candidates.size());
+        });
+    }
+
+    TuningReport tune(
+        const std::vector<TuningCandidate>& candidates,
+        const PlantModel&                   plant,
+        const std::vector<TuningScenario>&  scenarios,
+        const TuningOptions&                options,
+        ThreadPool&                         pool
+    )
+    {
+        return tune_with(candidates, plant, scenarios, options, [&](const auto& fn) {
+            pool.parallel_for(candidates.size(), options.grain == 0 ? 1 : options.grain, fn);
+        });
+    }
+
+    std::vector<std::size_t> pareto_front(const std::vector<TuningScore>& scores)
+    {
+        std::vector<std::size_t> order(scores.size());
+        for (std::size_t i = 0; i < order.size(); ++i) order[i] = i;
+
+        // Lexicographic order: anything that dominates a candidate sorts
+        // before it, so comparing against the front built so far suffices.
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            const TuningScore& x = scores[a];
+            const TuningScore& y = scores[b];
+            if (x.settling_steps  != y.settling_steps)  return x.settling_steps  < y.settling_steps;
+            if (x.saturation_duty != y.saturation_duty) return x.saturation_duty < y.saturation_duty;
+            return x.noise_gain < y.noise_gain;
+        });
+
+        const auto dominates = [](const TuningScore& a, const TuningScore& b) {
+            return a.settling_steps  <= b.settling_steps
+                && a.saturation_duty <= b.saturation_duty
+                && a.noise_gain      <= b.noise_gain
+                && (a.settling_steps  < b.settling_steps
+                 || a.saturation_duty < b.saturation_duty
+                 || a.noise_gain      < b.noise_gain);
+        };
+
+        std::vector<std::size_t> front;
+        for (std::size_t i : order)
+        {
+            bool dominated = false;
+            for (std::size_t f : front)
+            {
+                if (dominates(scores[f], scores[i]))
+                {
+                    dominated = true;
+                    break;
+                }
+            }
+            if (!dominated) front.push_back(i);
+        }
+        return front;
+    }
+
+} // namespace ect::sdk
@@ -0,0 +1,74 @@
+#include "ect_vector_controller.hpp"
+#include "ect_linear_kernel.hpp"
+
+#include <stdexcept>
+
+namespace ect::sdk
+{
+    VectorController::VectorController(
+        const VectorFOperator&    f,
+        const VectorEOperator&    e,
+        const VectorFInvOperator& finv,
+        const VectorGOperator&    g
+    )
+    : f_(f)
+    , e_(e)
+    , finv_(finv)
+    , g_(g)
+    , n_(f.dimension())
+    {
+        if (e.dimension() != n_ || finv.dimension() != n_ || g.dimension() != n_)
+        {
+            throw std::invalid_argument("VectorController: operator dimensions differ");
+        }
+
+        const auto* le = dynamic_cast<const LinearVectorEOperator*>(&e);
+        const auto* lg = dynamic_cast<const LinearVectorGOperator*>(&g);
+
+        const bool linear =
+            le != nullptr && lg != nullptr
+            && dynamic_cast<const LinearVectorFOperator*>(&f)       != nullptr
+            && dynamic_cast<const LinearVectorFInvOperator*>(&finv) != nullptr;
+
+        if (linear)
+        {
+            e_gain_ = le->gains();
+            g_gain_ = lg->gains();
+            u_min_  = lg->u_min();
+            u_max_  = lg->u_max();
+        }
+    }
+
+    std::size_t VectorController::dimension() const
+    {
+        return n_;
+    }
+
+    void VectorController::update(const double* delta, double* u) const
+    {
+        if (e_gain_ != nullptr)
+        {
+            detail::linear_pipeline_soa(delta, u, n_, e_gain_, g_gain_, u_min_, u_max_);
+            return;
+        }
+
+        // Stages run in place on the output buffer, so no scratch storage
+        // is needed.
+        f_.apply(delta, u);
+        e_.apply(u, u);
+        finv_.apply(u, u);
+        g_.apply(u, u);
+    }
+
+    namespace detail
+    {
+        void require_vector_dimension(std::size_t expected, std::size_t actual)
+        {
+            if (expected != actual)
+            {
+                throw std::invalid_argument("FixedVectorController: operator dimension does not match N");
+            }
+        }
+    }
+
+} // namespace ect::sdk
@@ -0,0 +1,138 @@
+#include "ect_vector_operators.hpp"
+#include "ect_linear_kernel.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+namespace ect::sdk
+{
+    // -------------------------------------------------------------------------
+    // LinearVectorFOperator
+    // -------------------------------------------------------------------------
+
+    LinearVectorFOperator::LinearVectorFOperator(std::size_t dimension)
+        : n_(dimension)
+    {
+    }
+
+    std::size_t LinearVectorFOperator::dimension() const
+    {
+        return n_;
+    }
+
+    void LinearVectorFOperator::apply(const double* delta, double* out) const
+    {
+        if (out == delta) return;
+
+        for (std::size_t i = 0; i < n_; ++i)
+        {
+            out[i] = delta[i]; // kF = 1.0
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // LinearVectorEOperator
+    // -------------------------------------------------------------------------
+
+    LinearVectorEOperator::LinearVectorEOperator(std::vector<double> gains)
+        : k_(std::move(gains))
+    {
+    }
+
+    std::size_t LinearVectorEOperator::dimension() const
+    {
+        return k_.size();
+    }
+
+    void LinearVectorEOperator::apply(const double* x, double* out) const
+    {
+        const std::size_t n = k_.size();
+        const double*     k = k_.data();
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out[i] = k[i] * x[i]; // alpha_i * x_i
+        }
+    }
+
+    const double* LinearVectorEOperator::gains() const
+    {
+        return k_.data();
+    }
+
+    // -------------------------------------------------------------------------
+    // LinearVectorFInvOperator
+    // -------------------------------------------------------------------------
+
+    LinearVectorFInvOperator::LinearVectorFInvOperator(std::size_t dimension)
+        : n_(dimension)
+    {
+    }
+
+    std::size_t LinearVectorFInvOperator::dimension() const
+    {
+        return n_;
+    }
+
+    void LinearVectorFInvOperator::apply(const double* x, double* out) const
+    {
+        if (out == x) return;
+
+        for (std::size_t i = 0; i < n_; ++i)
+        {
+            out[i] = x[i]; // kF = 1.0 → x / kF
+        }
+    }
+
+    // -------------------------------------------------------------------------
+    // LinearVectorGOperator
+    // -------------------------------------------------------------------------
+
+    LinearVectorGOperator::LinearVectorGOperator(
+        std::vector<double> gains,
+        std::vector<double> u_min,
+        std::vector<double> u_max
+    )
+    : k_(std::move(gains))
+    , u_min_(std::move(u_min))
+    , u_max_(std::move(u_max))
+    {
+        if (u_min_.size() != k_.size() || u_max_.size() != k_.size())
+        {
+            throw std::invalid_argument("LinearVectorGOperator: gain and bound arrays differ in length");
+        }
+
+        for (std::size_t i = 0; i < k_.size(); ++i)
+        {
+            if (!(u_min_[i] <= u_max_[i]))
+            {
+                throw std::invalid_argument("LinearVectorGOperator: u_min > u_max");
+            }
+        }
+    }
+
+    std::size_t LinearVectorGOperator::dimension() const
+    {
+        return k_.size();
+    }
+
+    void LinearVectorGOperator::apply(const double* delta, double* out) const
+    {
+        detail::linear_clamp_soa(delta, out, k_.size(), k_.data(), u_min_.data(), u_max_.data());
+    }
+
+    const double* LinearVectorGOperator::gains() const
+    {
+        return k_.data();
+    }
+
+    const double* LinearVectorGOperator::u_min() const
+    {
+        return u_min_.data();
+    }
+
+    const double* LinearVectorGOperator::u_max() const
+    {
+        return u_max_.data();
+    }
+}
@@ -0,0 +1,204 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_bank_image.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static std::string temp_path(const char* name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+// Message of the exception thrown by fn, or "" if none.
+template <typename Fn>
+static std::string error_of(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception& ex)
+    {
+        return ex.what();
+    }
+    return "";
+}
+
+static BankConfig parse(const std::string& text)
+{
+    std::istringstream in(text);
+    return parse_bank_config(in);
+}
+
+int main()
+{
+    const std::string image   = temp_path("ect_bank_image_test.ectb");
+    const std::string linear  = temp_path("ect_bank_image_test_linear.ectb");
+    const std::string garbage = temp_path("ect_bank_image_test_garbage.ectb");
+
+    // ---- Parsing ----
+    const BankConfig config = parse(
+        "# mixed fleet\n"
+        "group count=1000 e=linear:0.8 g=linear:1.2,-1,1\n"
+        "\n"
+        "group count=517 f=tanh:2 e=saturating:0.7,0.9 finv=atanh:2 g=smooth:1,-1,1   # actuators\n"
+        "group\n"
+        "group count=3001 f=sigmoid:0.5 e=power:0.6,1.5,0.8 finv=sigmoid:0.5 g=linear:1,-2,2\n");
+
+    require_true(config.groups.size() == 4 && config.size() == 4519, "group and controller counts");
+    {
+        const BankGroup& g0 = config.groups[0];
+        require_true(g0.e == EKind::Linear && g0.e_params[0] == 0.8 && g0.g_gain == 1.2, "linear group parsed");
+
+        const BankGroup& g1 = config.groups[1];
+        require_true(g1.f == FKind::Tanh && g1.f_scale == 2.0 && g1.e == EKind::Saturating
+                     && g1.finv == FInvKind::Atanh && g1.g == GKind::SmoothSaturation, "nonlinear group parsed");
+
+        const BankGroup& g2 = config.groups[2];
+        require_true(g2.count == 1 && g2.e_params[0] == 0.8 && g2.g_min == -1.0, "defaults");
+    }
+
+    // ---- Errors name the line and reject contract violations ----
+    {
+        const std::string unknown = error_of([] { parse("group count=1\ngroup f=cosh:1\n"); });
+        require_true(unknown.find("line 2") != std::string::npos && unknown.find("cosh") != std::string::npos,
+                     "unknown operator reported with line");
+
+        require_true(error_of([] { parse("group e=saturating:1.5,1\n"); }).find("line 1") != std::string::npos,
+                     "E contract checked");
+        require_true(!error_of([] { parse("group g=smooth:1,0.5,1\n"); }).empty(), "smooth G bounds checked");
+        require_true(!error_of([] { parse("group g=linear:1,1,-1\n"); }).empty(), "linear G bounds checked");
+        require_true(!error_of([] { parse("group e=linear:0.8,2\n"); }).empty(), "parameter count checked");
+        require_true(!error_of([] { parse("group count=0\n"); }).empty(), "empty group rejected");
+        require_true(!error_of([] { parse("group count=x\n"); }).empty(), "bad count rejected");
+        require_true(!error_of([] { parse("group f=tanh:1x\n"); }).empty(), "bad number rejected");
+        require_true(!error_of([] { parse("bank\n"); }).empty(), "unknown directive rejected");
+    }
+
+    // ---- Image round trip matches per-controller evaluation ----
+    {
+        write_bank_image(config, image);
+        const BankImage bank(image);
+
+        require_true(bank.size() == config.size() && bank.groups() == 4, "image sizes");
+        require_true(bank.group_begin(3) == 1518 && bank.group(1).count == 517, "group table");
+        const BankGroup stored = bank.group(3);
+        require_true(std::memcmp(stored.e_params, config.groups[3].e_params, sizeof(stored.e_params)) == 0,
+                     "parameters stored bit for bit");
+
+        const std::size_t n = bank.size();
+        std::vector<double> deltas(n), out(n), out_pool(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            deltas[i] = 1.5 * std::sin(0.11 * static_cast<double>(i));
+        }
+
+        bank.evaluate(deltas.data(), out.data());
+
+        std::vector<InlineController> reference;
+        for (const BankGroup& group : config.groups)
+        {
+            reference.insert(reference.end(), static_cast<std::size_t>(group.count), make_controller(group));
+        }
+
+        bool same = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double u = reference[i].update(deltas[i]);
+            same = same && std::memcmp(&u, &out[i], sizeof(double)) == 0;
+        }
+        require_true(same, "image evaluation matches per-controller update");
+
+        const double u = bank.controller(1000).update(deltas[1000]);
+        require_true(std::memcmp(&u, &out[1000], sizeof(double)) == 0, "controller() decodes the group");
+
+        ThreadPoolOptions pool_options;
+        pool_options.threads = 4;
+        ThreadPool pool(pool_options);
+        bank.evaluate(deltas.data(), out_pool.data(), pool, 100);
+        require_true(std::memcmp(out.data(), out_pool.data(), n * sizeof(double)) == 0, "pooled evaluation identical");
+    }
+
+    // ---- One group per controller reproduces a ControllerBank ----
+    {
+        const std::size_t n = 2048;
+        ControllerBank ref(n);
+        BankConfig     cfg;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double bound = 0.5 + 0.01 * static_cast<double>(i % 50);
+            const double gain  = 1.0 + 0.001 * static_cast<double>(i);
+            ref.set(i, 0.8, gain, -bound, bound);
+
+            BankGroup g;
+            g.e_params[0] = 0.8;
+            g.g_gain      = gain;
+            g.g_min       = -bound;
+            g.g_max       = bound;
+            cfg.groups.push_back(g);
+        }
+        write_bank_image(cfg, linear);
+        const BankImage bank(linear);
+
+        std::vector<double> deltas(n), out(n), expect(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            deltas[i] = 2.0 * std::cos(0.37 * static_cast<double>(i));
+        }
+        ref.evaluate(deltas.data(), expect.data());
+        bank.evaluate(deltas.data(), out.data());
+        require_true(std::memcmp(out.data(), expect.data(), n * sizeof(double)) == 0, "matches ControllerBank");
+    }
+
+    // ---- Malformed images are rejected ----
+    {
+        {
+            std::ofstream f(garbage, std::ios::binary);
+            f << "not a bank image, but long enough to hold a header......................";
+        }
+        require_true(!error_of([&] { BankImage b(garbage); }).empty(), "bad magic rejected");
+
+        // Corrupt one parameter of a valid image.
+        std::filesystem::copy_file(image, garbage, std::filesystem::copy_options::overwrite_existing);
+        {
+            std::fstream f(garbage, std::ios::binary | std::ios::in | std::ios::out);
+            const double bad_scale = -1.0;
+            f.seekp(64 + 88 * 1 + 24);   // group 1, f_scale
+            f.write(reinterpret_cast<const char*>(&bad_scale), sizeof(bad_scale));
+        }
+        require_true(error_of([&] { BankImage b(garbage); }).find("group 1") != std::string::npos,
+                     "invalid parameters rejected on load");
+
+        require_true(!error_of([] { BankImage b(temp_path("ect_bank_image_test_missing.ectb")); }).empty(),
+                     "missing file rejected");
+    }
+
+    std::filesystem::remove(image);
+    std::filesystem::remove(linear);
+    std::filesystem::remove(garbage);
+
+    std::cout << "[PASS] bank_image_test: configuration parsing, image round trip and validation" << std::endl;
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_cascade.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static bool same_bits(double a, double b)
+{
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+template <typename Fn>
+static bool throws(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    enum Input { POSITION_ERROR = 0, VELOCITY = 1, FEEDFORWARD = 2, INPUTS = 3 };
+
+    const InlineController outer_c(inline_ops::LinearF{}, inline_ops::LinearE(0.8),
+                                   inline_ops::LinearFInv{}, inline_ops::LinearG(2.0, -3.0, 3.0));
+    const InlineController inner_c(inline_ops::TanhF(2.0), inline_ops::SaturatingE(0.7, 1.5),
+                                   inline_ops::AtanhFInv(2.0), inline_ops::LinearG(1.5, -1.0, 1.0));
+    const InlineController trim_c(inline_ops::LinearF{}, inline_ops::PowerE(0.6, 1.5, 0.8),
+                                  inline_ops::LinearFInv{}, inline_ops::SmoothSaturationG(1.0, -0.5, 0.5));
+
+    // Nodes are added out of evaluation order to exercise the scheduler:
+    // trim depends on inner, inner on outer.
+    CascadeBuilder builder(INPUTS);
+    const std::size_t trim  = builder.add_node(trim_c, 0.125);
+    const std::size_t inner = builder.add_node(inner_c);
+    const std::size_t outer = builder.add_node(outer_c);
+
+    builder.connect_input(POSITION_ERROR, outer);
+    builder.connect(outer, inner);
+    builder.connect_input(VELOCITY, inner, -1.0);
+    builder.connect(inner, trim, 0.5);
+    builder.connect_input(FEEDFORWARD, trim, 0.25);
+
+    const Cascade cascade = builder.compile();
+
+    // ---- Schedule ----
+    require_true(cascade.nodes() == 3 && cascade.inputs() == INPUTS, "cascade sizes");
+    require_true(cascade.order() == std::vector<std::size_t>{ outer, inner, trim }, "topological order");
+
+    // Hand-chained reference: the glue code the cascade replaces.
+    const auto reference = [&](double e, double v, double ff, double* out) {
+        out[outer] = outer_c.update(e);
+        out[inner] = inner_c.update(out[outer] - v);
+        out[trim]  = trim_c.update(0.5 * out[inner] + 0.25 * ff + 0.125);
+    };
+
+    // ---- Single tick matches the chained controllers ----
+    {
+        bool same = true;
+        for (int i = -40; i <= 40; ++i)
+        {
+            const double in[INPUTS] = { 0.1 * i, 0.03 * i * i - 1.0, std::sin(0.2 * i) };
+            double       out[3], ref[3];
+            cascade.evaluate(in, out);
+            reference(in[0], in[1], in[2], ref);
+            for (std::size_t k = 0; k < 3; ++k) same = same && same_bits(out[k], ref[k]);
+        }
+        require_true(same, "evaluate matches hand-chained update");
+    }
+
+    // ---- Batched instances, serial, pooled and profiled ----
+    {
+        const std::size_t n = 3 * Cascade::BLOCK + 77;
+        std::vector<double> in(INPUTS * n), out(3 * n), out_pool(3 * n), out_prof(3 * n);
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            in[POSITION_ERROR * n + k] = 2.0 * std::sin(0.013 * static_cast<double>(k));
+            in[VELOCITY * n + k]       = std::cos(0.029 * static_cast<double>(k));
+            in[FEEDFORWARD * n + k]    = 0.001 * static_cast<double>(k) - 0.3;
+        }
+
+        cascade.evaluate_batch(in.data(), out.data(), n);
+
+        bool same = true;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            double ref[3];
+            reference(in[POSITION_ERROR * n + k], in[VELOCITY * n + k], in[FEEDFORWARD * n + k], ref);
+            for (std::size_t node = 0; node < 3; ++node) same = same && same_bits(out[node * n + k], ref[node]);
+        }
+        require_true(same, "batch matches per-instance reference");
+
+        ThreadPoolOptions pool_options;
+        pool_options.threads = 4;
+        ThreadPool pool(pool_options);
+        cascade.evaluate_batch(in.data(), out_pool.data(), n, pool, 1);
+        require_true(std::memcmp(out.data(), out_pool.data(), out.size() * sizeof(double)) == 0, "pooled batch identical");
+
+        CascadeProfile profile(cascade.nodes());
+        cascade.evaluate_batch(in.data(), out_prof.data(), n, profile);
+        require_true(std::memcmp(out.data(), out_prof.data(), out.size() * sizeof(double)) == 0, "profiled batch identical");
+
+        const std::size_t blocks = (n + Cascade::BLOCK - 1) / Cascade::BLOCK;
+        for (std::size_t node = 0; node < 3; ++node)
+        {
+            require_true(profile.summary(node).count == blocks, "one latency sample per node and block");
+        }
+
+        double in1[INPUTS] = { 0.5, 0.1, 0.0 };
+        double out1[3];
+        cascade.evaluate(in1, out1, profile);
+        require_true(profile.node(trim).count() == blocks + 1, "profiled single tick recorded");
+
+        profile.reset();
+        require_true(profile.summary(inner).count == 0, "profile reset");
+
+        CascadeProfile wrong(2);
+        require_true(throws([&] { cascade.evaluate(in1, out1, wrong); }), "profile size checked");
+    }
+
+    // ---- Graph errors ----
+    {
+        CascadeBuilder b(1);
+        const std::size_t a = b.add_node(InlineController());
+        const std::size_t c = b.add_node(InlineController());
+        require_true(throws([&] { b.connect_input(1, a); }), "unknown input rejected");
+        require_true(throws([&] { b.connect(a, 5); }), "unknown node rejected");
+        require_true(throws([&] { b.connect(a, a); }), "self-loop rejected");
+
+        b.connect(a, c);
+        b.connect(c, a);
+        require_true(throws([&] { b.compile(); }), "cycle rejected");
+    }
+
+    // ---- Unconnected node sees its bias only ----
+    {
+        CascadeBuilder b(0);
+        b.add_node(InlineController(), 0.25);
+        b.add_node(InlineController());
+        const Cascade c = b.compile();
+
+        double out[2];
+        c.evaluate(nullptr, out);
+        require_true(out[0] == 0.25 && out[1] == 0.0, "bias-only nodes");
+
+        std::vector<double> batch(2 * 5);
+        c.evaluate_batch(nullptr, batch.data(), 5);
+        require_true(batch[4] == 0.25 && batch[9] == 0.0, "bias-only nodes, batch");
+    }
+
+    std::cout << "[PASS] cascade_test: scheduling, fused batch evaluation and node latency" << std::endl;
+    return 0;
+}
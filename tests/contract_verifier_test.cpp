@@ -0,0 +1,214 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+#include "ect_sdk.hpp"
+#include "ect_contract_verifier.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+// ---- Deliberately broken operators ----------------------------------------
+
+// Drops by 1 at x = 1.5.
+class KinkedF final : public FOperator
+{
+public:
+    double apply(double x) const override { return x < 1.5 ? x : x - 1.0; }
+};
+
+// apply_batch disagrees with apply() by one ulp for x > 10.
+class InconsistentBatchF final : public FOperator
+{
+public:
+    double apply(double x) const override { return x; }
+
+    void apply_batch(const double* in, double* out, std::size_t n) const override
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            out[i] = in[i] > 10.0 ? std::nextafter(in[i], 0.0) : in[i];
+        }
+    }
+};
+
+class ExpansiveE final : public EOperator
+{
+public:
+    double apply(double x) const override { return 1.25 * x; }
+};
+
+// Non-expansive and sign preserving, but falls back at |x| = 1: only the
+// composite sees it.
+class BacksideE final : public EOperator
+{
+public:
+    double apply(double x) const override { return std::fabs(x) < 1.0 ? 0.5 * x : 0.25 * x; }
+};
+
+class SignFlipE final : public EOperator
+{
+public:
+    double apply(double x) const override { return -0.5 * x; }
+};
+
+static VerifierOptions small_options()
+{
+    VerifierOptions o;
+    o.grid_points       = 20001;
+    o.points_per_decade = 8;
+    o.random_samples    = 50000;
+    o.grain             = 1000;
+    return o;
+}
+
+static bool same_double(double a, double b)
+{
+    return (std::isnan(a) && std::isnan(b)) || std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+static bool same_report(const VerificationReport& a, const VerificationReport& b)
+{
+    if (a.samples != b.samples)
+    {
+        return false;
+    }
+    for (std::size_t c = 0; c < CHECK_COUNT; ++c)
+    {
+        const CheckResult& x = a.checks[c];
+        const CheckResult& y = b.checks[c];
+        if (x.evaluated != y.evaluated || x.violations != y.violations
+            || x.has_counterexample != y.has_counterexample
+            || !same_double(x.counterexample.input, y.counterexample.input)
+            || !same_double(x.counterexample.partner, y.counterexample.partner))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+int main()
+{
+    LinearFOperator    f;
+    LinearEOperator    e(0.8);
+    LinearFInvOperator finv;
+    LinearGOperator    g(1.0, -1.0, 1.0);
+
+    // ---- Admissible linear set passes every check ----
+    const VerificationReport ok = verify_contracts(f, e, finv, g, small_options());
+    require_true(ok.passed(), "linear operators satisfy all contracts");
+    require_true(ok.g_lower == -1.0 && ok.g_upper == 1.0, "G bounds taken from AffineForm");
+    for (std::size_t c = 0; c < CHECK_COUNT; ++c)
+    {
+        require_true(ok.checks[c].evaluated > 0, "every check is exercised");
+    }
+
+    // ---- Report is independent of thread count and chunking ----
+    {
+        KinkedF kinked;
+        VerifierOptions o = small_options();
+        const VerificationReport serial = verify_contracts(kinked, e, finv, g, o);
+
+        for (std::size_t threads : { std::size_t(1), std::size_t(3) })
+        {
+            ThreadPoolOptions po;
+            po.threads = threads;
+            ThreadPool pool(po);
+
+            VerifierOptions o2 = o;
+            o2.grain = 777;
+            require_true(same_report(serial, verify_contracts(kinked, e, finv, g, o2, pool)),
+                         "report independent of threads and grain");
+        }
+
+        // ---- Minimal counterexample: adjacent doubles at the kink ----
+        const CheckResult& mono = serial[Check::FMonotonic];
+        require_true(mono.violations > 0, "kinked F is reported non-monotonic");
+        require_true(mono.counterexample.partner == 1.5, "counterexample shrunk to the kink");
+        require_true(mono.counterexample.input == std::nextafter(1.5, 0.0), "counterexample pair is adjacent");
+        require_true(serial[Check::FInvConsistency].violations > 0, "F^-1 o F ordering broken by kink");
+        require_true(serial[Check::ENonExpansive].violations == 0, "unrelated checks unaffected");
+    }
+
+    // ---- Each invariant is detected ----
+    {
+        ExpansiveE expansive;
+        const VerificationReport r = verify_contracts(f, expansive, finv, g, small_options());
+        const Counterexample& ce = r[Check::ENonExpansive].counterexample;
+        require_true(r[Check::ENonExpansive].violations > 0, "expansive E detected");
+        require_true(std::fabs(ce.output) > std::fabs(ce.input), "counterexample really expands");
+        require_true(r[Check::EStrictContraction].violations > 0, "expansive E is not contracting near 0");
+    }
+    {
+        BacksideE backside;
+        const VerificationReport r = verify_contracts(f, backside, finv, g, small_options());
+        const CheckResult& mono = r[Check::CompositeMonotonic];
+        require_true(mono.violations > 0, "non-monotone composite detected");
+        const Counterexample& ce = mono.counterexample;
+        require_true(ce.input == -1.0 && ce.partner == std::nextafter(-1.0, 0.0) && ce.output > ce.partner_output,
+                     "composite counterexample shrunk to adjacent doubles");
+        require_true(r[Check::FMonotonic].violations == 0 && r[Check::FInvMonotonic].violations == 0
+                         && r[Check::GMonotonic].violations == 0 && r[Check::ENonExpansive].violations == 0,
+                     "every stage passes on its own");
+
+        VerifierOptions raw = small_options();
+        raw.propagate = false;
+        require_true(verify_contracts(f, backside, finv, g, raw)[Check::CompositeMonotonic].violations > 0,
+                     "composite checked without propagation");
+    }
+    {
+        SignFlipE flip;
+        const VerificationReport r = verify_contracts(f, flip, finv, g, small_options());
+        require_true(r[Check::ESignPreserving].violations > 0, "sign-flipping E detected");
+        require_true(r[Check::GSignPreserving].violations == 0, "G sees flipped input but keeps its sign");
+    }
+    {
+        InconsistentBatchF bad;
+        const VerificationReport r = verify_contracts(bad, e, finv, g, small_options());
+        const CheckResult& det = r[Check::FDeterministic];
+        require_true(det.violations > 0, "apply/apply_batch mismatch detected");
+        require_true(det.counterexample.input > 10.0 && det.counterexample.input <= 10.2,
+                     "smallest mismatching input reported");
+    }
+    {
+        VerifierOptions o = small_options();
+        o.g_lower = -0.5;
+        o.g_upper =  0.5;
+        const VerificationReport r = verify_contracts(f, e, finv, g, o);
+        require_true(r[Check::GBounded].violations > 0, "output outside declared bounds detected");
+        require_true(std::fabs(r[Check::GBounded].counterexample.output) > 0.5, "bounded counterexample");
+    }
+
+    // ---- Validation ----
+    {
+        VerifierOptions o = small_options();
+        o.g_lower = 1.0;
+        o.g_upper = -1.0;
+
+        bool threw = false;
+        try
+        {
+            verify_contracts(f, e, finv, g, o);
+        }
+        catch (const std::invalid_argument&)
+        {
+            threw = true;
+        }
+        require_true(threw, "inverted G bounds rejected");
+    }
+
+    std::cout << "[PASS] contract_verifier_test: invariants, minimal counterexamples, determinism" << std::endl;
+    return 0;
+}
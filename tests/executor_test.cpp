@@ -0,0 +1,154 @@
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_executor.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+template <typename Fn>
+static bool throws(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    // ---- Registration and rate-monotonic grouping ----
+    {
+        RateExecutor ex;
+        require_true(throws([&] { ex.add_task("bad", 0.0, [](std::uint64_t) {}); }), "zero rate rejected");
+        require_true(throws([&] { ex.add_task("bad", -5.0, [](std::uint64_t) {}); }), "negative rate rejected");
+        require_true(throws([&] { ex.start(); }), "start without tasks rejected");
+
+        ex.add_task("slow", 50.0,  [](std::uint64_t) {});
+        ex.add_task("fast", 1000.0, [](std::uint64_t) {});
+        ex.add_task("mid",  250.0,  [](std::uint64_t) {});
+        ex.add_task("fast2", 1000.0, [](std::uint64_t) {});
+
+        require_true(ex.tasks() == 4 && ex.rate_groups() == 3, "tasks grouped by rate");
+        require_true(ex.group_stats(0).rate_hz == 1000.0 && ex.group_stats(0).tasks == 2, "fastest group first");
+        require_true(ex.group_stats(1).period_ns == 4'000'000, "250 Hz period");
+        require_true(ex.group_stats(2).period_ns == 20'000'000, "50 Hz period");
+        require_true(!ex.running(), "not running before start");
+    }
+
+    // ---- Rates, ordering within a group, controllers and banks ----
+    {
+        ExecutorOptions options;
+        options.realtime    = true;    // granted or not, the executor must run
+        options.pin_threads = true;
+        RateExecutor ex(options);
+
+        std::atomic<std::uint64_t> fast_runs{0};
+        std::atomic<std::uint64_t> slow_runs{0};
+        std::atomic<bool>          in_order{true};
+        std::atomic<std::uint64_t> first_cycle{~std::uint64_t(0)};
+
+        ex.add_task("fast", 1000.0, [&](std::uint64_t cycle) {
+            if (cycle == 0) first_cycle = fast_runs.load();
+            fast_runs.fetch_add(1);
+        });
+        ex.add_task("fast-after", 1000.0, [&](std::uint64_t) {
+            // Runs after "fast" in the same cycle on the same thread.
+            if (fast_runs.load() == 0) in_order = false;
+        });
+        ex.add_task("slow", 50.0, [&](std::uint64_t) { slow_runs.fetch_add(1); });
+
+        LinearFOperator    f;
+        LinearEOperator    e(0.8);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.0, -1.0, 1.0);
+        Controller         ctrl(f, e, finv, g);
+
+        std::atomic<double> u{0.0};
+        const std::size_t   id = ex.add_controller("ctrl", 250.0, ctrl,
+            [] { return 0.5; }, [&](double v) { u = v; });
+
+        ControllerBank      bank(16);
+        std::vector<double> deltas(16, 2.0), out(16, 0.0);
+        ex.add_bank("bank", 250.0, bank, deltas.data(), out.data());
+
+        ex.start();
+        require_true(ex.running(), "running after start");
+        require_true(throws([&] { ex.add_task("late", 10.0, [](std::uint64_t) {}); }), "no registration after start");
+        require_true(throws([&] { ex.start(); }), "double start rejected");
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(300));
+        ex.stop();
+        ex.stop();
+        require_true(!ex.running(), "stopped");
+
+        const ExecutorStatus status = ex.status();
+        std::cout << "executor status: realtime=" << status.realtime << " pinned=" << status.pinned << std::endl;
+
+        const RateGroupStats fast = ex.group_stats(0);
+        const RateGroupStats mid  = ex.group_stats(1);
+        const RateGroupStats slow = ex.group_stats(2);
+
+        // Loose bounds: the box may be loaded, but the counts must follow
+        // the declared rates.
+        require_true(fast.cycles >= 100 && fast.cycles <= 320, "1 kHz group cycle count");
+        require_true(mid.cycles >= 25 && mid.cycles <= 80, "250 Hz group cycle count");
+        require_true(slow.cycles >= 5 && slow.cycles <= 16, "50 Hz group cycle count");
+        require_true(fast.cycles > slow.cycles * 10, "rate ratio");
+        require_true(fast.jitter.count == fast.cycles && fast.execution.count == fast.cycles, "one sample per cycle");
+
+        require_true(fast_runs.load() == fast.cycles, "task runs match cycles");
+        require_true(first_cycle.load() == 0, "cycle numbers start at 0");
+        require_true(in_order.load(), "tasks of a group run in registration order");
+        require_true(slow_runs.load() == slow.cycles, "slow task runs");
+
+        const TaskStats ts = ex.task_stats(id);
+        require_true(ts.name == "ctrl" && ts.rate_hz == 250.0 && ts.runs == mid.cycles, "controller task stats");
+        require_true(u.load() == ctrl.update(0.5), "controller output actuated");
+        require_true(out[0] == 1.0, "bank evaluated");
+    }
+
+    // ---- Deadline misses skip releases instead of bunching ----
+    {
+        RateExecutor ex;
+        std::atomic<std::uint64_t> runs{0};
+        ex.add_task("overrun", 200.0, [&](std::uint64_t) {
+            runs.fetch_add(1);
+            std::this_thread::sleep_for(std::chrono::milliseconds(12));   // period is 5 ms
+        });
+
+        ex.start();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        ex.stop();
+
+        const RateGroupStats s = ex.group_stats(0);
+        require_true(s.cycles > 0 && s.deadline_misses == s.cycles, "every cycle misses its deadline");
+        require_true(s.skipped >= 2 * s.deadline_misses, "late releases are skipped");
+        require_true(s.execution.min_ns >= 12'000'000, "execution time includes the overrun");
+        require_true(s.cycles <= 200 / 12 + 2, "no back-to-back catch-up");
+    }
+
+    std::cout << "[PASS] executor_test: rate groups, deadlines and jitter statistics" << std::endl;
+    return 0;
+}
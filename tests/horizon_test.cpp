@@ -0,0 +1,175 @@
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_horizon.hpp"
+#include "ect_nonlinear_operators.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+template <typename Fn>
+static bool throws(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+struct Case
+{
+    double alpha;
+    double g_gain;
+    double u_min;
+    double u_max;
+    double plant_gain;
+    double delta0;
+};
+
+// Steps the controller against x += plant_gain * u, the loop the predictor
+// replaces, and compares every horizon up to `steps`.
+static void check_case(const Case& c, std::size_t steps)
+{
+    LinearFOperator    f;
+    LinearEOperator    e(c.alpha);
+    LinearFInvOperator finv;
+    LinearGOperator    g(c.g_gain, c.u_min, c.u_max);
+    Controller         ctrl(f, e, finv, g);
+
+    const HorizonPredictor predictor(f, e, finv, g, c.plant_gain);
+
+    std::vector<double>      delta(steps + 1), sum(steps + 1);
+    std::vector<std::size_t> saturated(steps + 1);
+    std::size_t              saturation_end = 0;
+
+    delta[0] = c.delta0;
+    for (std::size_t k = 0; k < steps; ++k)
+    {
+        const GEvaluation ev = ctrl.evaluate(delta[k]);
+        const bool        sat = ev.state != ClampState::Free;
+
+        delta[k + 1]     = delta[k] - c.plant_gain * ev.u;
+        sum[k + 1]       = sum[k] + ev.u;
+        saturated[k + 1] = saturated[k] + (sat ? 1 : 0);
+        if (sat) saturation_end = k + 1;
+    }
+
+    const double scale = std::fmax(1.0, std::fabs(c.delta0));
+    for (std::size_t n = 0; n <= steps; ++n)
+    {
+        const HorizonPrediction p = predictor.predict(c.delta0, n);
+        require_true(std::fabs(p.delta - delta[n]) <= 1e-12 * scale, "Delta_N matches iteration");
+        require_true(std::fabs(p.cumulative_u - sum[n]) <= 1e-12 * scale / c.plant_gain, "cumulative output matches iteration");
+        require_true(p.saturated_steps == saturated[n], "saturated step count matches iteration");
+        require_true(p.saturation_end == saturation_end, "saturation end matches iteration");
+    }
+}
+
+int main()
+{
+    // ---- Against step-by-step iteration ----
+    const Case cases[] = {
+        { 0.8, 1.0, -1.0, 1.0, 1.0,   10.3 },   // one saturated run, r = 0.2
+        { 0.8, 1.0, -1.0, 1.0, 1.0,   -7.7 },
+        { 0.8, 1.0, -1.0, 1.0, 1.0,    0.4 },   // never saturates
+        { 0.9, 1.8, -0.3, 1.0, 1.0,    7.1 },   // r = -0.62, asymmetric bounds
+        { 0.9, 1.8, -0.3, 1.0, 1.0,   -5.3 },
+        { 0.9, 1.8, -0.3, 1.0, 1.0,   0.61 },   // overshoot into the tight bound
+        { 0.5, 2.0, -2.0, 2.0, 0.5,  123.4 },   // plant gain != 1
+        { 0.95, 1.9, -0.05, 0.5, 1.0, 3.3 },    // r = -0.805: high, low, geometric
+    };
+    for (const Case& c : cases)
+    {
+        check_case(c, 400);
+    }
+
+    // ---- Parameters and derived ratio ----
+    {
+        LinearFOperator    f;
+        LinearEOperator    e(0.9);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.8, -0.3, 1.0);
+        const HorizonPredictor p(f, e, finv, g);
+
+        require_true(p.gain() == 1.8 * 0.9 && p.u_min() == -0.3 && p.u_max() == 1.0, "parameters from affine forms");
+        require_true(std::fabs(p.ratio() - (1.0 - 1.62)) < 1e-15, "contraction ratio");
+    }
+
+    // ---- Horizons far beyond what iteration could cover ----
+    {
+        const HorizonPredictor p(0.8, -1.0, 1.0);
+        // 0.8 * Delta > 1 until Delta = 1e6 - j <= 1.25, i.e. j = 999999.
+        const HorizonPrediction far = p.predict(1.0e6, std::size_t(1) << 50);
+        require_true(far.saturation_end == 999'999 && far.saturated_steps == far.saturation_end, "long saturated run");
+        require_true(std::fabs(far.delta) < 1e-300 && std::fabs(far.cumulative_u - 1.0e6) < 1e-6, "converged tail");
+
+        const HorizonPrediction early = p.predict(1.0e6, 10);
+        require_true(early.saturated_steps == 10 && early.saturation_end == far.saturation_end, "saturation end independent of the horizon");
+        require_true(early.delta == 1.0e6 - 10.0 && early.cumulative_u == 10.0, "saturated prefix");
+    }
+
+    // ---- Runs too long to count ----
+    {
+        const HorizonPredictor p(0.8, -1.0, 1.0);
+        for (double d0 : { 1.0e20, 1.0e300, double(INFINITY), -double(INFINITY) })
+        {
+            const HorizonPrediction q = p.predict(d0, 10);
+            require_true(q.saturated_steps == 10 && q.saturation_end == HorizonPrediction::NEVER, "endless run reported as NEVER");
+            require_true(q.cumulative_u == (d0 > 0.0 ? 10.0 : -10.0), "endless run saturates every step");
+            require_true(q.delta == d0 - (d0 > 0.0 ? 10.0 : -10.0), "endless run moves Delta by the bound");
+        }
+
+        const HorizonPrediction far = p.predict(1.0e300, std::size_t(1) << 62);
+        require_true(far.saturated_steps == (std::size_t(1) << 62) && far.saturation_end == HorizonPrediction::NEVER, "huge horizon inside an endless run");
+
+        // Just below the cap the run is still counted exactly.
+        const HorizonPrediction counted = p.predict(1.0e15, 10);
+        require_true(counted.saturation_end != HorizonPrediction::NEVER && counted.saturation_end > 999'999'999'999'990, "long but countable run");
+    }
+
+    // ---- A zero bound freezes the loop ----
+    {
+        const HorizonPredictor p(0.8, 0.0, 1.0);
+        const HorizonPrediction stuck = p.predict(-3.0, 50);
+        require_true(stuck.delta == -3.0 && stuck.cumulative_u == 0.0, "u = 0 holds Delta");
+        require_true(stuck.saturated_steps == 50 && stuck.saturation_end == HorizonPrediction::NEVER, "never leaves saturation");
+
+        const HorizonPrediction fine = p.predict(3.0, 50);
+        require_true(fine.saturation_end > 0 && fine.saturation_end != HorizonPrediction::NEVER, "upper side still recovers");
+    }
+
+    // ---- Validation ----
+    {
+        require_true(throws([] { HorizonPredictor(0.0, -1.0, 1.0); }), "zero gain rejected");
+        require_true(throws([] { HorizonPredictor(2.0, -1.0, 1.0); }), "loop gain 2 rejected");
+        require_true(throws([] { HorizonPredictor(0.8, 0.1, 1.0); }), "u_min > 0 rejected");
+        require_true(throws([] { HorizonPredictor(0.8, -1.0, 1.0, NAN); }), "NaN plant gain rejected");
+        require_true(!throws([] { HorizonPredictor(0.8, -INFINITY, INFINITY); }), "unbounded output accepted");
+
+        TanhFOperator      tanh_f(2.0);
+        LinearEOperator    e(0.8);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.0, -1.0, 1.0);
+        require_true(throws([&] { HorizonPredictor(tanh_f, e, finv, g); }), "nonlinear pipeline rejected");
+    }
+
+    std::cout << "[PASS] horizon_test: closed-form N-step prediction matches iteration" << std::endl;
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_hot_parameters.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+// Every field is derived from one counter, so a block mixing two publishes
+// is detectable.
+struct Block4
+{
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    std::uint64_t c = 0;
+    std::uint64_t d = 0;
+
+    static Block4 of(std::uint64_t v) { return Block4{ v, v * 3, v * 5, ~v }; }
+    bool consistent() const { return b == a * 3 && c == a * 5 && d == ~a; }
+};
+
+int main()
+{
+    // ---- Matches the Linear* Controller bit for bit, before and after retune ----
+    {
+        LinearParameters p;
+        p.alpha = 0.8;
+        p.gain  = 1.3;
+        p.u_min = -1.0;
+        p.u_max = 2.0;
+
+        HotLinearController hot(p);
+        HotLinearController::Handle h = hot.attach();
+
+        std::vector<double> deltas;
+        for (int i = -60; i <= 60; ++i) deltas.push_back(0.05 * i);
+        std::vector<double> out(deltas.size());
+
+        for (int round = 0; round < 2; ++round)
+        {
+            LinearFOperator    f;
+            LinearEOperator    e(p.alpha);
+            LinearFInvOperator finv;
+            LinearGOperator    g(p.gain, p.u_min, p.u_max);
+            Controller         ref(f, e, finv, g);
+
+            h.update_batch(deltas.data(), out.data(), deltas.size());
+
+            bool same = true;
+            for (std::size_t i = 0; i < deltas.size(); ++i)
+            {
+                const double a = h.update(deltas[i]);
+                const double b = ref.update(deltas[i]);
+                same = same && std::memcmp(&a, &b, sizeof(double)) == 0
+                            && std::memcmp(&out[i], &b, sizeof(double)) == 0;
+            }
+            require_true(same, "hot controller matches Controller");
+
+            p.alpha = 0.5;
+            p.gain  = 2.0;
+            p.u_max = 0.75;
+            require_true(hot.retune(p) == static_cast<std::uint64_t>(round) + 2, "retune bumps the version");
+        }
+
+        require_true(h.version() == 3 && hot.version() == 3, "handle sees the latest version");
+        require_true(hot.parameters().u_max == 0.75, "parameters() returns the current block");
+
+        LinearParameters bad = p;
+        bad.u_min = 1.0;
+        bad.u_max = -1.0;
+        bool threw = false;
+        try { hot.retune(bad); } catch (const std::invalid_argument&) { threw = true; }
+        require_true(threw && hot.version() == 3, "invalid retune rejected and not published");
+    }
+
+    // ---- Reader slots are bounded and recycled ----
+    {
+        HotParameters<Block4> cell(Block4::of(1), 2);
+        {
+            auto r1 = cell.reader();
+            auto r2 = cell.reader();
+            bool threw = false;
+            try { auto r3 = cell.reader(); } catch (const std::length_error&) { threw = true; }
+            require_true(threw, "reader slots are bounded");
+        }
+        auto r = cell.reader();
+        require_true((*r.pin()).a == 1, "slot reused after release");
+    }
+
+    // ---- Pinned blocks survive publishes; unpinned ones are reclaimed ----
+    {
+        HotParameters<Block4> cell(Block4::of(1), 4);
+        auto r = cell.reader();
+        {
+            const auto snap = r.pin();
+            for (std::uint64_t v = 2; v <= 10; ++v) cell.publish(Block4::of(v));
+            require_true(snap->a == 1 && snap.version() == 1, "pinned block unchanged");
+            require_true(cell.reclaim() > 0, "blocks retired while pinned are kept");
+        }
+        require_true(cell.reclaim() == 0, "released blocks are reclaimed");
+        require_true(r.pin()->a == 10, "next pin sees the newest block");
+    }
+
+    // ---- Concurrent readers never see torn blocks or go backwards ----
+    {
+        HotParameters<Block4> cell(Block4::of(1), 8);
+
+        const std::size_t    readers = 3;
+        const std::uint64_t  last    = 20000;
+        std::atomic<bool>    torn{false};
+        std::atomic<bool>    backwards{false};
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < readers; ++t)
+        {
+            threads.emplace_back([&] {
+                auto          r    = cell.reader();
+                std::uint64_t seen = 0;
+                for (;;)
+                {
+                    const auto snap = r.pin();
+                    if (!snap->consistent() || snap.version() != snap->a) torn = true;
+                    if (snap->a < seen) backwards = true;
+                    seen = snap->a;
+                    if (seen == last) break;
+                }
+            });
+        }
+
+        for (std::uint64_t v = 2; v <= last; ++v)
+        {
+            cell.publish(Block4::of(v));
+        }
+        for (std::thread& t : threads) t.join();
+
+        require_true(!torn, "no torn reads");
+        require_true(!backwards, "versions never go backwards");
+        require_true(cell.reclaim() == 0, "everything reclaimed once readers are gone");
+    }
+
+    std::cout << "[PASS] hot_parameters_test: snapshots, retune and reclamation" << std::endl;
+    return 0;
+}
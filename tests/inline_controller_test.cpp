@@ -0,0 +1,224 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_inline_controller.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static bool same_bits(double a, double b)
+{
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+static std::vector<double> sweep()
+{
+    std::vector<double> d;
+    for (int i = -120; i <= 120; ++i) d.push_back(0.025 * i);
+    d.push_back(-0.0);
+    d.push_back(std::numeric_limits<double>::quiet_NaN());
+    return d;
+}
+
+// update() and update_batch() of the inline controller against the
+// reference Controller, bit for bit, including the SIMD tails.
+static bool matches(const InlineController& inl, const Controller& ref)
+{
+    const std::vector<double> d = sweep();
+    bool same = true;
+    for (std::size_t n = 0; n <= d.size(); n += 13)
+    {
+        std::vector<double> out(n);
+        inl.update_batch(d.data(), out.data(), n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double r = ref.update(d[i]);
+            same = same && same_bits(inl.update(d[i]), r) && same_bits(out[i], r);
+        }
+    }
+    return same;
+}
+
+// Trivially copyable custom stage: dead zone around zero.
+struct DeadZoneE
+{
+    double width;
+    double gain;
+
+    double apply(double x) const
+    {
+        if (std::fabs(x) <= width) return 0.0;
+        return gain * (x > 0.0 ? x - width : x + width);
+    }
+};
+
+class DeadZoneEOperator final : public EOperator
+{
+public:
+    explicit DeadZoneEOperator(DeadZoneE op) : op_(op) {}
+    double apply(double x) const override { return op_.apply(x); }
+
+private:
+    DeadZoneE op_;
+};
+
+int main()
+{
+    // ---- Default controller is the unit linear pipeline ----
+    {
+        LinearFOperator    f;
+        LinearEOperator    e(1.0);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.0, -1.0, 1.0);
+        require_true(matches(InlineController(), Controller(f, e, finv, g)), "default controller");
+    }
+
+    // ---- Linear pipeline ----
+    {
+        LinearFOperator    f;
+        LinearEOperator    e(0.8);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.7, -1.5, 2.0);
+
+        const InlineController inl(inline_ops::LinearF{}, inline_ops::LinearE(0.8),
+                                   inline_ops::LinearFInv{}, inline_ops::LinearG(1.7, -1.5, 2.0));
+        require_true(matches(inl, Controller(f, e, finv, g)), "linear pipeline");
+    }
+
+    // ---- Every nonlinear family, mixed with linear stages ----
+    {
+        TanhFOperator     f(2.0);
+        AtanhFInvOperator finv(2.0);
+        SaturatingEOperator e(0.7, 0.9);
+        LinearGOperator   g(1.2, -1.0, 1.0);
+
+        const InlineController inl(inline_ops::TanhF(2.0), inline_ops::SaturatingE(0.7, 0.9),
+                                   inline_ops::AtanhFInv(2.0), inline_ops::LinearG(1.2, -1.0, 1.0));
+        require_true(matches(inl, Controller(f, e, finv, g)), "tanh / saturating E / linear G");
+    }
+    {
+        AsinhFOperator            f(1.5);
+        PowerEOperator            e(0.6, 1.5, 0.8);
+        SinhFInvOperator          finv(1.5);
+        SmoothSaturationGOperator g(1.1, -2.0, 1.5);
+
+        const InlineController inl(inline_ops::AsinhF(1.5), inline_ops::PowerE(0.6, 1.5, 0.8),
+                                   inline_ops::SinhFInv(1.5), inline_ops::SmoothSaturationG(1.1, -2.0, 1.5));
+        require_true(matches(inl, Controller(f, e, finv, g)), "asinh / power E / smooth G");
+    }
+    {
+        SigmoidFOperator    f(0.5);
+        LinearEOperator     e(0.9);
+        SigmoidFInvOperator finv(0.5);
+        LinearGOperator     g(1.0, -3.0, 3.0);
+
+        const InlineController inl(inline_ops::SigmoidF(0.5), inline_ops::LinearE(0.9),
+                                   inline_ops::SigmoidFInv(0.5), inline_ops::LinearG(1.0, -3.0, 3.0));
+        require_true(matches(inl, Controller(f, e, finv, g)), "sigmoid pair");
+    }
+
+    // ---- Custom stage in the inline slot ----
+    {
+        const DeadZoneE dz{ 0.1, 0.75 };
+
+        LinearFOperator    f;
+        DeadZoneEOperator  e(dz);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.0, -1.0, 1.0);
+
+        const InlineController inl(inline_ops::LinearF{}, InlineOperator(dz),
+                                   inline_ops::LinearFInv{}, inline_ops::LinearG(1.0, -1.0, 1.0));
+        require_true(matches(inl, Controller(f, e, finv, g)), "custom inline E");
+    }
+
+    // ---- Descriptions reject what the operator classes reject ----
+    {
+        bool threw = false;
+        try { inline_ops::TanhF bad(0.0); (void)bad; } catch (const std::invalid_argument&) { threw = true; }
+        require_true(threw, "TanhF scale validated");
+
+        threw = false;
+        try { inline_ops::SaturatingE bad(1.0, 1.0); (void)bad; } catch (const std::invalid_argument&) { threw = true; }
+        require_true(threw, "SaturatingE alpha validated");
+
+        threw = false;
+        try { inline_ops::SmoothSaturationG bad(1.0, 0.5, 1.0); (void)bad; } catch (const std::invalid_argument&) { threw = true; }
+        require_true(threw, "SmoothSaturationG bounds validated");
+    }
+
+    // ---- Heterogeneous fleet: contiguous, copyable, thread-independent ----
+    {
+        const std::size_t n = 5003;
+        std::vector<InlineController> fleet;
+        fleet.reserve(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double k = 1.0 + 0.001 * static_cast<double>(i % 97);
+            switch (i % 4)
+            {
+                case 0:
+                    fleet.emplace_back(inline_ops::LinearF{}, inline_ops::LinearE(0.8),
+                                       inline_ops::LinearFInv{}, inline_ops::LinearG(k, -1.0, 1.0));
+                    break;
+                case 1:
+                    fleet.emplace_back(inline_ops::TanhF(2.0), inline_ops::SaturatingE(0.5, 1.0),
+                                       inline_ops::AtanhFInv(2.0), inline_ops::LinearG(k, -0.5, 0.5));
+                    break;
+                case 2:
+                    fleet.emplace_back(inline_ops::LinearF{}, inline_ops::PowerE(0.7, 2.0, 1.0),
+                                       inline_ops::LinearFInv{}, inline_ops::SmoothSaturationG(k, -1.0, 1.0));
+                    break;
+                default:
+                    fleet.emplace_back(inline_ops::LinearF{}, InlineOperator(DeadZoneE{ 0.05, k }),
+                                       inline_ops::LinearFInv{}, inline_ops::LinearG(1.0, -2.0, 2.0));
+                    break;
+            }
+        }
+
+        std::vector<double> deltas(n), out(n), out_pool(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            deltas[i] = 1.5 * std::sin(0.37 * static_cast<double>(i));
+        }
+
+        update_fleet(fleet.data(), deltas.data(), out.data(), n);
+
+        bool same = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            same = same && same_bits(out[i], fleet[i].update(deltas[i]));
+        }
+        require_true(same, "fleet matches per-controller update");
+
+        ThreadPoolOptions pool_options;
+        pool_options.threads = 4;
+        ThreadPool pool(pool_options);
+        update_fleet(fleet.data(), deltas.data(), out_pool.data(), n, pool, 256);
+        require_true(std::memcmp(out.data(), out_pool.data(), n * sizeof(double)) == 0, "pooled fleet identical");
+
+        // Byte copies are full controllers, custom slot included.
+        std::vector<InlineController> copy(n);
+        std::memcpy(static_cast<void*>(copy.data()), fleet.data(), n * sizeof(InlineController));
+        update_fleet(copy.data(), deltas.data(), out_pool.data(), n);
+        require_true(std::memcmp(out.data(), out_pool.data(), n * sizeof(double)) == 0, "memcpy'd fleet identical");
+    }
+
+    std::cout << "[PASS] inline_controller_test: inline operators, batch and fleet evaluation" << std::endl;
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_instrumentation.hpp"
+
+using namespace ect::sdk;
+using instrumentation::Histogram;
+using instrumentation::Stage;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+int main()
+{
+    // ---- Bucketing: every value lies inside its bucket, width <= v/32 ----
+    for (std::uint64_t v = 0; v < (std::uint64_t(1) << 41); v = v < 4096 ? v + 1 : v + v / 7 + 1)
+    {
+        const std::size_t   b  = Histogram::bucket_of(v);
+        const std::uint64_t lo = Histogram::bucket_lower(b);
+        const std::uint64_t hi = Histogram::bucket_upper(b);
+
+        require_true(b < Histogram::BUCKETS, "bucket index in range");
+        require_true(lo <= v && v <= hi, "value inside its bucket");
+        require_true(hi - lo <= v / Histogram::SUB_BUCKETS, "bucket relative width <= 1/32");
+        if (b + 1 < Histogram::BUCKETS)
+        {
+            require_true(Histogram::bucket_lower(b + 1) == hi + 1, "buckets are contiguous");
+        }
+    }
+    require_true(Histogram::bucket_of(~std::uint64_t(0)) == Histogram::BUCKETS - 1, "overflow bucket");
+
+    // ---- Quantiles ----
+    {
+        auto h = std::make_unique<Histogram>();
+        require_true(h->quantile(0.5) == 0 && h->count() == 0 && h->min() == 0, "empty histogram");
+
+        for (std::uint64_t v = 1; v <= 10000; ++v)
+        {
+            h->record(v);
+        }
+
+        require_true(h->count() == 10000, "count");
+        require_true(h->min() == 1 && h->max() == 10000, "min / max exact");
+        require_true(h->mean() == 5000.5, "mean exact");
+
+        const std::uint64_t p50  = h->quantile(0.50);
+        const std::uint64_t p99  = h->quantile(0.99);
+        const std::uint64_t p999 = h->quantile(0.999);
+
+        require_true(p50 >= 5000 && p50 <= 5000 + 5000 / 32, "p50 within bucket resolution");
+        require_true(p99 >= 9900 && p99 <= 9900 + 9900 / 32, "p99 within bucket resolution");
+        require_true(p999 >= 9990 && p999 <= 10000, "p999 within bucket resolution, clamped to max");
+        require_true(h->quantile(1.0) == 10000, "p100 == max");
+
+        h->reset();
+        require_true(h->count() == 0 && h->quantile(0.99) == 0, "reset clears");
+    }
+
+    // ---- Controller integration ----
+    LinearFOperator    f;
+    LinearEOperator    e(0.8);
+    LinearFInvOperator finv;
+    LinearGOperator    g(1.0, -1.0, 1.0);
+    Controller         ctrl(f, e, finv, g);
+
+    instrumentation::reset();
+
+    const std::size_t threads    = 3;
+    const std::size_t per_thread = 2000;
+    std::vector<std::thread> workers;
+
+    for (std::size_t t = 0; t < threads; ++t)
+    {
+        workers.emplace_back([&ctrl, t]() {
+            for (std::size_t i = 0; i < per_thread; ++i)
+            {
+                const double d = static_cast<double>(i) * 0.001 - 1.0 + static_cast<double>(t);
+                double u = ctrl.update(d);
+                double r = d * 0.8;
+                r = r < -1.0 ? -1.0 : (r > 1.0 ? 1.0 : r);
+                require_true(u == r, "instrumented update result unchanged");
+            }
+        });
+    }
+    for (auto& w : workers)
+    {
+        w.join();
+    }
+
+    const instrumentation::Snapshot snap = instrumentation::snapshot();
+
+    if (instrumentation::enabled)
+    {
+        require_true(snap.threads >= threads, "every recording thread registered");
+        for (std::size_t s = 0; s < instrumentation::STAGE_COUNT; ++s)
+        {
+            const instrumentation::Summary& st = snap.stages[s];
+            require_true(st.count == threads * per_thread, "one sample per update per stage");
+            require_true(st.min_ns <= st.p50_ns && st.p50_ns <= st.p99_ns
+                      && st.p99_ns <= st.p999_ns && st.p999_ns <= st.max_ns, "quantiles ordered");
+        }
+        require_true(snap[Stage::Update].max_ns >= snap[Stage::F].min_ns, "update covers stages");
+    }
+    else
+    {
+        for (std::size_t s = 0; s < instrumentation::STAGE_COUNT; ++s)
+        {
+            require_true(snap.stages[s].count == 0, "disabled build records nothing");
+        }
+    }
+
+    std::cout << "[PASS] instrumentation_test: histogram and per-stage recording ("
+              << (instrumentation::enabled ? "enabled" : "disabled") << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,305 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_cpu.hpp"
+#include "ect_fast_math.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_vector_controller.hpp"
+#include "ect_vector_operators.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const std::string& msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+template <typename Fn>
+static bool throws(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+template <typename T>
+static bool same_bits(const std::vector<T>& a, const std::vector<T>& b)
+{
+    return a.size() == b.size() && std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0;
+}
+
+static double from_bits(std::uint64_t b)
+{
+    double x = 0.0;
+    std::memcpy(&x, &b, sizeof(x));
+    return x;
+}
+
+// Odd length so every lane width leaves a scalar tail.
+static const std::size_t N = 100'003;
+
+// Mix of the operating range, wide magnitudes, raw bit patterns and the
+// IEEE-754 special values.
+static std::vector<double> random_inputs(std::mt19937_64& rng)
+{
+    const double special[] = {
+        0.0, -0.0, 1.0, -1.0, 0.5, -0.5,
+        std::numeric_limits<double>::infinity(),
+        -std::numeric_limits<double>::infinity(),
+        std::numeric_limits<double>::quiet_NaN(),
+        std::numeric_limits<double>::denorm_min(),
+        -std::numeric_limits<double>::denorm_min(),
+        std::numeric_limits<double>::min(),
+        std::numeric_limits<double>::max(),
+        -std::numeric_limits<double>::max(),
+        std::nextafter(1.0, 0.0), std::nextafter(-1.0, 0.0),
+        708.0, 709.8, -745.0, 22.0, 268435456.0,
+    };
+    const std::size_t n_special = sizeof(special) / sizeof(special[0]);
+
+    std::uniform_real_distribution<double> near(-4.0, 4.0);
+    std::uniform_real_distribution<double> exponent(-80.0, 80.0);
+    std::uniform_int_distribution<int>     kind(0, 9);
+
+    std::vector<double> x(N);
+    for (double& v : x)
+    {
+        const int k = kind(rng);
+        if (k < 5)       v = near(rng);
+        else if (k < 7)  v = (rng() & 1 ? -1.0 : 1.0) * std::exp2(exponent(rng));
+        else if (k < 9)  v = from_bits(rng());
+        else             v = special[rng() % n_special];
+    }
+    return x;
+}
+
+struct Columns
+{
+    std::vector<double> alpha;
+    std::vector<double> gain;
+    std::vector<double> u_min;
+    std::vector<double> u_max;
+};
+
+static Columns random_columns(std::mt19937_64& rng)
+{
+    std::uniform_real_distribution<double> g(-3.0, 3.0);
+    std::uniform_real_distribution<double> b(0.0, 5.0);
+
+    Columns c;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const double lo = -b(rng);
+        const double hi = i % 97 == 0 ? lo : b(rng);   // some degenerate bounds
+        c.alpha.push_back(i % 89 == 0 ? 0.0 : g(rng));
+        c.gain.push_back(i % 83 == 0 ? -0.0 : g(rng));
+        c.u_min.push_back(i % 101 == 0 ? -std::numeric_limits<double>::infinity() : lo);
+        c.u_max.push_back(hi);
+    }
+    return c;
+}
+
+struct Path
+{
+    std::string                                   name;
+    std::function<std::vector<double>()>          run;
+};
+
+struct StatePath
+{
+    std::string                                   name;
+    std::function<std::vector<std::int8_t>()>     run;
+};
+
+int main()
+{
+    std::mt19937_64 rng(0xEC75D15Aull);
+
+    const std::vector<double> x    = random_inputs(rng);
+    const Columns             cols = random_columns(rng);
+
+    // Inputs where the inverse maps are defined almost everywhere.
+    std::vector<double> unit(N);
+    {
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        for (std::size_t i = 0; i < N; ++i) unit[i] = i % 11 == 0 ? x[i] : u(rng);
+    }
+
+    LinearFOperator    f;
+    LinearEOperator    e(0.8);
+    LinearFInvOperator finv;
+    LinearGOperator    g(1.3, -2.0, 1.5);
+    Controller         ctrl(f, e, finv, g);
+
+    const ControllerBank bank(cols.alpha, cols.gain, cols.u_min, cols.u_max);
+
+    const LinearVectorFOperator    vf(N);
+    const LinearVectorEOperator    ve(cols.alpha);
+    const LinearVectorFInvOperator vfinv(N);
+    const LinearVectorGOperator    vg(cols.gain, cols.u_min, cols.u_max);
+    const VectorController         vctrl(vf, ve, vfinv, vg);
+
+    const TanhFOperator             tanh_f(2.5);
+    const AtanhFInvOperator         atanh_finv(1.5);
+    const AsinhFOperator            asinh_f(0.7);
+    const SinhFInvOperator          sinh_finv(1.2);
+    const SigmoidFOperator          sigmoid_f(3.0);
+    const SigmoidFInvOperator       sigmoid_finv(0.9);
+    const SaturatingEOperator       sat_e(0.8, 2.0);
+    const PowerEOperator            power_e(0.6, 1.7, 3.0);
+    const SmoothSaturationGOperator smooth_g(1.4, -1.0, 2.0);
+
+    const auto batch = [](const auto& op, const std::vector<double>& in) {
+        std::vector<double> out(in.size());
+        op.apply_batch(in.data(), out.data(), in.size());
+        return out;
+    };
+    const auto fast = [](void (*fn)(const double*, double*, std::size_t), const std::vector<double>& in) {
+        std::vector<double> out(in.size());
+        fn(in.data(), out.data(), in.size());
+        return out;
+    };
+
+    const std::vector<Path> paths = {
+        { "Controller::update_batch",  [&] { std::vector<double> u(N); ctrl.update_batch(x.data(), u.data(), N); return u; } },
+        { "LinearGOperator u/raw",     [&] {
+              std::vector<double> u(N), raw(N); std::vector<std::int8_t> s(N);
+              g.evaluate_batch(x.data(), u.data(), raw.data(), s.data(), N);
+              u.insert(u.end(), raw.begin(), raw.end());
+              return u; } },
+        { "ControllerBank::evaluate",  [&] { std::vector<double> u(N); bank.evaluate(x.data(), u.data()); return u; } },
+        { "ControllerBank u (state)",  [&] { std::vector<double> u(N); std::vector<std::int8_t> s(N); bank.evaluate(x.data(), u.data(), s.data()); return u; } },
+        { "VectorController::update",  [&] { std::vector<double> u(N); vctrl.update(x.data(), u.data()); return u; } },
+        { "LinearVectorGOperator",     [&] { std::vector<double> u(N); vg.apply(x.data(), u.data()); return u; } },
+        { "TanhFOperator",             [&] { return batch(tanh_f, x); } },
+        { "AtanhFInvOperator",         [&] { return batch(atanh_finv, unit); } },
+        { "AsinhFOperator",            [&] { return batch(asinh_f, x); } },
+        { "SinhFInvOperator",          [&] { return batch(sinh_finv, x); } },
+        { "SigmoidFOperator",          [&] { return batch(sigmoid_f, x); } },
+        { "SigmoidFInvOperator",       [&] { return batch(sigmoid_finv, unit); } },
+        { "SaturatingEOperator",       [&] { return batch(sat_e, x); } },
+        { "PowerEOperator",            [&] { return batch(power_e, x); } },
+        { "SmoothSaturationGOperator", [&] { return batch(smooth_g, x); } },
+        { "fast_math::exp",            [&] { return fast(fast_math::exp, x); } },
+        { "fast_math::expm1",          [&] { return fast(fast_math::expm1, x); } },
+        { "fast_math::log",            [&] { return fast(fast_math::log, x); } },
+        { "fast_math::log1p",          [&] { return fast(fast_math::log1p, x); } },
+        { "fast_math::tanh",           [&] { return fast(fast_math::tanh, x); } },
+        { "fast_math::atanh",          [&] { return fast(fast_math::atanh, unit); } },
+        { "fast_math::asinh",          [&] { return fast(fast_math::asinh, x); } },
+        { "fast_math::sinh",           [&] { return fast(fast_math::sinh, x); } },
+    };
+
+    const std::vector<StatePath> state_paths = {
+        { "LinearGOperator state", [&] {
+              std::vector<double> u(N); std::vector<std::int8_t> s(N);
+              g.evaluate_batch(x.data(), u.data(), nullptr, s.data(), N);
+              return s; } },
+        { "ControllerBank state",  [&] {
+              std::vector<double> u(N); std::vector<std::int8_t> s(N);
+              bank.evaluate(x.data(), u.data(), s.data());
+              return s; } },
+    };
+
+    // ---- Scalar variant: the reference, itself equal to per-element apply() ----
+    require_true(cpu::supported(cpu::Isa::Scalar), "scalar variant always available");
+    cpu::force(cpu::Isa::Scalar);
+    require_true(cpu::active() == cpu::Isa::Scalar, "forced scalar");
+
+    std::vector<std::vector<double>>      reference;
+    std::vector<std::vector<std::int8_t>> state_reference;
+    for (const Path& p : paths) reference.push_back(p.run());
+    for (const StatePath& p : state_paths) state_reference.push_back(p.run());
+
+    {
+        bool same = true;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            const double u = ctrl.update(x[i]);
+            same = same && std::memcmp(&u, &reference[0][i], sizeof(u)) == 0;
+
+            const double t = tanh_f.apply(x[i]);
+            same = same && std::memcmp(&t, &reference[6][i], sizeof(t)) == 0;
+
+            const double s = smooth_g.apply(x[i]);
+            same = same && std::memcmp(&s, &reference[14][i], sizeof(s)) == 0;
+
+            const double l = fast_math::log1p(x[i]);
+            same = same && std::memcmp(&l, &reference[18][i], sizeof(l)) == 0;
+        }
+        require_true(same, "scalar batch variant matches per-element evaluation");
+    }
+
+    // NaN results are canonical, whatever operand order produced them.
+    {
+        const double nan  = std::numeric_limits<double>::quiet_NaN();
+        const double ninf = -std::numeric_limits<double>::infinity();
+        const double l    = fast_math::log1p(ninf);
+        const double s    = sigmoid_finv.apply(nan);
+        require_true(std::memcmp(&l, &nan, sizeof(l)) == 0 && std::memcmp(&s, &nan, sizeof(s)) == 0,
+                     "NaN results carry the default quiet NaN");
+    }
+
+    // ---- Every other variant against the scalar one ----
+    std::string verified = "scalar";
+    for (cpu::Isa isa : { cpu::Isa::Sse2, cpu::Isa::Avx2, cpu::Isa::Avx512 })
+    {
+        if (!cpu::supported(isa))
+        {
+            std::cout << "isa_dispatch: " << cpu::isa_name(isa) << " not available here, skipped" << std::endl;
+            require_true(throws([&] { cpu::force(isa); }), "forcing an unavailable variant throws");
+            continue;
+        }
+
+        cpu::force(isa);
+        require_true(cpu::active() == isa, std::string("forced ") + cpu::isa_name(isa));
+
+        for (std::size_t k = 0; k < paths.size(); ++k)
+        {
+            require_true(same_bits(paths[k].run(), reference[k]),
+                         paths[k].name + ": " + cpu::isa_name(isa) + " differs from scalar");
+        }
+        for (std::size_t k = 0; k < state_paths.size(); ++k)
+        {
+            require_true(same_bits(state_paths[k].run(), state_reference[k]),
+                         state_paths[k].name + ": " + cpu::isa_name(isa) + " differs from scalar");
+        }
+        verified += std::string(", ") + cpu::isa_name(isa);
+    }
+
+    // ---- Selection ----
+    {
+        require_true(cpu::supported(cpu::detected()), "detected variant is supported");
+        require_true(throws([] { cpu::force(static_cast<cpu::Isa>(42)); }), "unknown variant rejected");
+
+        cpu::reset();
+        if (std::getenv("ECT_SDK_ISA") == nullptr)
+        {
+            require_true(cpu::active() == cpu::detected(), "reset returns to the detected variant");
+        }
+    }
+
+    std::cout << "[PASS] isa_dispatch_test: " << paths.size() + state_paths.size() << " batch paths x "
+              << N << " inputs bit-identical across " << verified << std::endl;
+    return 0;
+}
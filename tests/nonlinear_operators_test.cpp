@@ -0,0 +1,263 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_fast_math.hpp"
+#include "ect_nonlinear_operators.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static bool same_bits(double a, double b)
+{
+    std::uint64_t ba = 0;
+    std::uint64_t bb = 0;
+    std::memcpy(&ba, &a, sizeof(a));
+    std::memcpy(&bb, &b, sizeof(b));
+    return ba == bb;
+}
+
+// Error of `got` against a long double reference, in ulp of the reference.
+static double ulp_error(double got, long double ref)
+{
+    const double r = static_cast<double>(ref);
+    if (std::isinf(r)) return got == r ? 0.0 : 1e9;
+
+    const double a   = std::fabs(r);
+    const double ulp = a == 0.0 ? std::numeric_limits<double>::denorm_min()
+                                : std::nextafter(a, std::numeric_limits<double>::infinity()) - a;
+    return static_cast<double>(std::fabs(static_cast<long double>(got) - ref) / ulp);
+}
+
+// Deterministic log-spaced grid over [lo, hi] (lo > 0), both signs.
+static std::vector<double> log_grid(double lo, double hi, int n, bool both_signs)
+{
+    std::vector<double> v;
+    const double a = std::log(lo);
+    const double b = std::log(hi);
+    for (int i = 0; i < n; ++i)
+    {
+        const double x = std::exp(a + (b - a) * (static_cast<double>(i) + 0.37) / n);
+        v.push_back(x);
+        if (both_signs) v.push_back(-x);
+    }
+    return v;
+}
+
+static std::vector<double> linear_grid(double lo, double hi, int n)
+{
+    std::vector<double> v;
+    for (int i = 0; i <= n; ++i)
+    {
+        v.push_back(lo + (hi - lo) * static_cast<double>(i) / n);
+    }
+    return v;
+}
+
+template <typename Fast, typename Ref>
+static void check_error(const char* name, Fast fast, Ref ref, const std::vector<double>& xs, double bound)
+{
+    double worst = 0.0;
+    for (double x : xs)
+    {
+        const double e = ulp_error(fast(x), ref(static_cast<long double>(x)));
+        if (e > worst) worst = e;
+    }
+    if (worst > bound)
+    {
+        std::cerr << "[FAIL] " << name << ": " << worst << " ulp exceeds documented " << bound << std::endl;
+        std::exit(1);
+    }
+}
+
+template <typename Op>
+static void check_batch(const Op& op, const std::vector<double>& xs, const char* msg)
+{
+    std::vector<double> out(xs.size());
+    op.apply_batch(xs.data(), out.data(), xs.size());
+    for (std::size_t i = 0; i < xs.size(); ++i)
+    {
+        require_true(same_bits(out[i], op.apply(xs[i])), msg);
+    }
+}
+
+// Monotone along the grid and between each grid point and the next
+// double, where rounding errors of the kernels would show first.
+template <typename Op>
+static void check_monotone_and_sign(const Op& op, const std::vector<double>& sorted, const char* msg)
+{
+    double prev = op.apply(sorted[0]);
+    for (std::size_t i = 1; i < sorted.size(); ++i)
+    {
+        const double x = sorted[i];
+        const double y = op.apply(x);
+        require_true(y >= prev, msg);
+        require_true(op.apply(std::nextafter(x, std::numeric_limits<double>::infinity())) >= y, msg);
+        if (x > 0.0) require_true(y >= 0.0, msg);
+        if (x < 0.0) require_true(y <= 0.0, msg);
+        prev = y;
+    }
+    require_true(op.apply(0.0) == 0.0, msg);
+}
+
+int main()
+{
+    // ---- fast_math error bounds (ect_fast_math.hpp) -------------------------
+    const std::vector<double> wide   = log_grid(1e-300, 1e300, 20000, true);
+    const std::vector<double> unit   = linear_grid(-3.0, 3.0, 20000);
+    const std::vector<double> open1  = linear_grid(-0.999999, 0.999999, 20000);
+    const std::vector<double> expdom = linear_grid(-708.0, 709.78, 20000);
+
+    check_error("exp",   [](double x) { return fast_math::exp(x); },   [](long double x) { return std::exp(x); },   expdom, 2.0);
+    check_error("exp",   [](double x) { return fast_math::exp(x); },   [](long double x) { return std::exp(x); },   unit,   2.0);
+    check_error("expm1", [](double x) { return fast_math::expm1(x); }, [](long double x) { return std::expm1(x); }, unit,   2.0);
+    check_error("log",   [](double x) { return fast_math::log(std::fabs(x)); },
+                         [](long double x) { return std::log(std::fabs(x)); }, wide, 3.0);
+    check_error("log1p", [](double x) { return fast_math::log1p(x); }, [](long double x) { return std::log1p(x); }, open1,  3.0);
+    check_error("tanh",  [](double x) { return fast_math::tanh(x); },  [](long double x) { return std::tanh(x); },  unit,   4.0);
+    check_error("tanh",  [](double x) { return fast_math::tanh(x); },  [](long double x) { return std::tanh(x); },  log_grid(1e-300, 30.0, 20000, true), 4.0);
+    check_error("atanh", [](double x) { return fast_math::atanh(x); }, [](long double x) { return std::atanh(x); }, open1,  4.0);
+    check_error("asinh", [](double x) { return fast_math::asinh(x); }, [](long double x) { return std::asinh(x); }, wide,   4.0);
+    check_error("asinh", [](double x) { return fast_math::asinh(x); }, [](long double x) { return std::asinh(x); }, unit,   4.0);
+    check_error("sinh",  [](double x) { return fast_math::sinh(x); },  [](long double x) { return std::sinh(x); },  log_grid(1e-300, 710.0, 20000, true), 4.0);
+
+    // Monotone between adjacent doubles, sampled densely where the
+    // reductions switch (powers of two, sqrt(2), the asinh branches).
+    {
+        struct Kernel
+        {
+            const char* msg;
+            double (*fn)(double);
+            std::vector<double> xs;
+        };
+        const std::vector<Kernel> kernels = {
+            { "fast_math::log not monotone",   fast_math::log,   log_grid(1e-310, 1e308, 100000, false) },
+            { "fast_math::log1p not monotone", fast_math::log1p, linear_grid(-0.999999, 8.0, 100000) },
+            { "fast_math::log1p not monotone", fast_math::log1p, log_grid(1e-300, 1e300, 100000, false) },
+            { "fast_math::atanh not monotone", fast_math::atanh, linear_grid(-0.999999, 0.999999, 100000) },
+            { "fast_math::asinh not monotone", fast_math::asinh, linear_grid(-6.0, 6.0, 100000) },
+            { "fast_math::asinh not monotone", fast_math::asinh, log_grid(1e-300, 1e300, 100000, false) },
+            { "fast_math::asinh not monotone", fast_math::asinh, log_grid(std::ldexp(1.0, 499), std::ldexp(1.0, 501), 1000, false) },
+        };
+        for (const Kernel& k : kernels)
+        {
+            for (double x : k.xs)
+            {
+                const double next = std::nextafter(x, std::numeric_limits<double>::infinity());
+                require_true(k.fn(next) >= k.fn(x), k.msg);
+            }
+        }
+        const double two500 = std::ldexp(1.0, 500);
+        require_true(fast_math::asinh(std::nextafter(two500, 0.0)) <= fast_math::asinh(two500), "fast_math::asinh jumps at 2^500");
+    }
+
+    // Batch forms are bit-identical to the scalar forms.
+    {
+        std::vector<double> out(unit.size());
+        fast_math::tanh(unit.data(), out.data(), unit.size());
+        for (std::size_t i = 0; i < unit.size(); ++i)
+        {
+            require_true(same_bits(out[i], fast_math::tanh(unit[i])), "fast_math::tanh batch differs from scalar");
+        }
+        fast_math::asinh(wide.data(), out.data(), unit.size());
+        for (std::size_t i = 0; i < unit.size(); ++i)
+        {
+            require_true(same_bits(out[i], fast_math::asinh(wide[i])), "fast_math::asinh batch differs from scalar");
+        }
+    }
+
+    // ---- Operator contracts (Operator Formalization §3–§6) ------------------
+    std::vector<double> sorted = log_grid(1e-12, 1e6, 4000, false);
+    {
+        std::vector<double> neg;
+        for (auto it = sorted.rbegin(); it != sorted.rend(); ++it) neg.push_back(-*it);
+        neg.push_back(0.0);
+        neg.insert(neg.end(), sorted.begin(), sorted.end());
+        sorted = neg;
+    }
+
+    TanhFOperator             tanh_f(2.0);
+    AtanhFInvOperator         atanh_finv(2.0);
+    AsinhFOperator            asinh_f(0.5);
+    SinhFInvOperator          sinh_finv(0.5);
+    SigmoidFOperator          sigmoid_f(3.0);
+    SigmoidFInvOperator       sigmoid_finv(3.0);
+    SaturatingEOperator       sat_e(0.8, 4.0);
+    PowerEOperator            pow_e(0.8, 1.5, 2.0);
+    SmoothSaturationGOperator smooth_g(1.0, -1.5, 2.0);
+
+    check_monotone_and_sign(tanh_f,    sorted, "TanhFOperator not monotone / sign preserving");
+    check_monotone_and_sign(asinh_f,   sorted, "AsinhFOperator not monotone / sign preserving");
+    check_monotone_and_sign(sigmoid_f, sorted, "SigmoidFOperator not monotone / sign preserving");
+    check_monotone_and_sign(sat_e,     sorted, "SaturatingEOperator not monotone / sign preserving");
+    check_monotone_and_sign(pow_e,     sorted, "PowerEOperator not monotone / sign preserving");
+    check_monotone_and_sign(smooth_g,  sorted, "SmoothSaturationGOperator not monotone / sign preserving");
+
+    const std::vector<double> embedded = linear_grid(-0.999, 0.999, 4000);
+    check_monotone_and_sign(atanh_finv,   embedded, "AtanhFInvOperator not monotone / sign preserving");
+    check_monotone_and_sign(sigmoid_finv, embedded, "SigmoidFInvOperator not monotone / sign preserving");
+    check_monotone_and_sign(sinh_finv,    linear_grid(-20.0, 20.0, 4000), "SinhFInvOperator not monotone / sign preserving");
+
+    for (double x : sorted)
+    {
+        require_true(std::fabs(sat_e.apply(x)) <= std::fabs(x), "SaturatingEOperator is expansive");
+        require_true(std::fabs(pow_e.apply(x)) <= std::fabs(x), "PowerEOperator is expansive");
+
+        const double u = smooth_g.apply(x * 1e6);
+        require_true(u >= -1.5 && u <= 2.0, "SmoothSaturationGOperator out of bounds");
+    }
+
+    // F⁻¹(F(x)) ≈ x inside the operating range (§5.3).
+    for (double x : linear_grid(-10.0, 10.0, 2000))
+    {
+        const double tol = 1e-9 * (1.0 + std::fabs(x));
+        require_true(std::fabs(atanh_finv.apply(tanh_f.apply(x)) - x) <= tol, "atanh∘tanh inconsistent");
+        require_true(std::fabs(sinh_finv.apply(asinh_f.apply(x)) - x) <= tol, "sinh∘asinh inconsistent");
+        require_true(std::fabs(sigmoid_finv.apply(sigmoid_f.apply(x)) - x) <= tol, "sigmoid inverse inconsistent");
+    }
+
+    // apply_batch() is bit-identical to apply().
+    check_batch(tanh_f,       sorted,   "TanhFOperator batch differs from apply()");
+    check_batch(atanh_finv,   embedded, "AtanhFInvOperator batch differs from apply()");
+    check_batch(asinh_f,      sorted,   "AsinhFOperator batch differs from apply()");
+    check_batch(sinh_finv,    embedded, "SinhFInvOperator batch differs from apply()");
+    check_batch(sigmoid_f,    sorted,   "SigmoidFOperator batch differs from apply()");
+    check_batch(sigmoid_finv, embedded, "SigmoidFInvOperator batch differs from apply()");
+    check_batch(sat_e,        sorted,   "SaturatingEOperator batch differs from apply()");
+    check_batch(pow_e,        sorted,   "PowerEOperator batch differs from apply()");
+    check_batch(smooth_g,     sorted,   "SmoothSaturationGOperator batch differs from apply()");
+
+    // ---- Full nonlinear pipeline --------------------------------------------
+    Controller c(tanh_f, sat_e, atanh_finv, smooth_g);
+
+    struct Pipeline
+    {
+        const Controller& c;
+        double apply(double d) const { return c.update(d); }
+    };
+    check_monotone_and_sign(Pipeline{ c }, sorted, "Nonlinear pipeline not monotone / sign preserving");
+
+    std::vector<double> batch(sorted.size());
+    c.update_batch(sorted.data(), batch.data(), sorted.size());
+    for (std::size_t i = 0; i < sorted.size(); ++i)
+    {
+        require_true(same_bits(batch[i], c.update(sorted[i])), "Nonlinear update_batch differs from update()");
+        require_true(batch[i] >= -1.5 && batch[i] <= 2.0, "Nonlinear pipeline output out of bounds");
+    }
+
+    std::cout << "[PASS] nonlinear_operators_test: error bounds, contracts and batch/scalar identity verified." << std::endl;
+    return 0;
+}
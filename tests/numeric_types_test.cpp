@@ -0,0 +1,132 @@
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_basic_controller.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+// Declared tolerances versus the double reference.
+//   float : relative 1e-6 (input, gain and two products each round once)
+//   Q15_16: absolute 2^-16 * (2 + |delta|) (input/gain quantization + rounding)
+static double float_tolerance(double u_ref)
+{
+    return 1e-6 * std::fabs(u_ref) + std::numeric_limits<float>::min();
+}
+
+static double q15_16_tolerance(double delta)
+{
+    return std::ldexp(1.0, -16) * (2.0 + std::fabs(delta));
+}
+
+template <typename T>
+struct LinearSet
+{
+    BasicLinearFOperator<T>    f;
+    BasicLinearEOperator<T>    e;
+    BasicLinearFInvOperator<T> finv;
+    BasicLinearGOperator<T>    g;
+
+    LinearSet(double alpha, double gain, double u_min, double u_max)
+        : e(T(alpha)), g(T(gain), T(u_min), T(u_max))
+    {
+    }
+};
+
+int main()
+{
+    const double ALPHA = 0.8;
+    const double UMIN  = -50.0;
+    const double UMAX  =  50.0;
+
+    LinearFOperator    f;
+    LinearEOperator    e(ALPHA);
+    LinearFInvOperator finv;
+    LinearGOperator    g(1.0, UMIN, UMAX);
+    Controller reference(f, e, finv, g);
+
+    LinearSet<double> d(ALPHA, 1.0, UMIN, UMAX);
+    LinearSet<float>  s(ALPHA, 1.0, UMIN, UMAX);
+    LinearSet<Q15_16> q(ALPHA, 1.0, UMIN, UMAX);
+
+    ControllerF64    c64(d.f, d.e, d.finv, d.g);
+    ControllerF32    c32(s.f, s.e, s.finv, s.g);
+    ControllerQ15_16 cq(q.f, q.e, q.finv, q.g);
+
+    std::vector<double> inputs;
+    for (int k = -2000; k <= 2000; ++k)
+    {
+        inputs.push_back(0.05 * k + 0.0001 * (k % 7));
+    }
+
+    std::vector<float>  in32;
+    std::vector<Q15_16> inq;
+    for (double x : inputs)
+    {
+        in32.push_back(static_cast<float>(x));
+        inq.push_back(Q15_16(x));
+    }
+
+    std::vector<float>  out32(inputs.size());
+    std::vector<Q15_16> outq(inputs.size());
+    c32.update_batch(in32.data(), out32.data(), in32.size());
+    cq.update_batch(inq.data(), outq.data(), inq.size());
+
+    Q15_16 prev_q = Q15_16::lowest();
+
+    for (std::size_t i = 0; i < inputs.size(); ++i)
+    {
+        const double x   = inputs[i];
+        const double ref = reference.update(x);
+
+        require_true(c64.update(x) == ref, "BasicController<double> differs from Controller");
+
+        const double u32 = static_cast<double>(c32.update(static_cast<float>(x)));
+        require_true(std::fabs(u32 - ref) <= float_tolerance(ref), "float pipeline outside declared tolerance");
+        require_true(static_cast<double>(out32[i]) == u32, "float update_batch differs from update");
+
+        const Q15_16 uq = cq.update(Q15_16(x));
+        require_true(std::fabs(static_cast<double>(uq) - ref) <= q15_16_tolerance(x), "Q15.16 pipeline outside declared tolerance");
+        require_true(outq[i] == uq, "Q15.16 update_batch differs from update");
+
+        // Invariants survive quantization.
+        require_true(uq >= prev_q, "Q15.16 pipeline not monotone");
+        if (x > 0.0) require_true(uq >= Q15_16(0.0), "Q15.16 pipeline sign violated (positive)");
+        if (x < 0.0) require_true(uq <= Q15_16(0.0), "Q15.16 pipeline sign violated (negative)");
+        require_true(uq >= Q15_16(UMIN) && uq <= Q15_16(UMAX), "Q15.16 pipeline out of bounds");
+        prev_q = uq;
+    }
+
+    // Fixed-point arithmetic saturates instead of wrapping.
+    require_true(Q15_16::max() + Q15_16(1.0) == Q15_16::max(), "Q15.16 addition wrapped");
+    require_true(Q15_16::lowest() - Q15_16(1.0) == Q15_16::lowest(), "Q15.16 subtraction wrapped");
+    require_true(Q15_16(300.0) * Q15_16(300.0) == Q15_16::max(), "Q15.16 multiplication wrapped");
+    require_true(Q15_16(1e12) == Q15_16::max() && Q15_16(-1e12) == Q15_16::lowest(), "Q15.16 conversion not saturating");
+    require_true(-Q15_16::lowest() == Q15_16::max(), "Q15.16 negation wrapped");
+
+    // Conversion rounds to nearest, ties toward +inf, like multiplication.
+    const double res = std::ldexp(1.0, -16);
+    require_true(Q15_16(std::ldexp(0.49999999999999994, -16)).raw() == 0, "Q15.16 conversion rounded just below half up");
+    require_true(Q15_16(2.5 * res).raw() == 3 && Q15_16(-2.5 * res).raw() == -2, "Q15.16 conversion tie rule");
+    require_true(Q15_16(-2.5000001 * res).raw() == -3 && Q15_16(-0.5 * res).raw() == 0, "Q15.16 negative conversion");
+    require_true((Q15_16::from_raw(5) * Q15_16(0.5)).raw() == 3 && (Q15_16::from_raw(-5) * Q15_16(0.5)).raw() == -2,
+                 "Q15.16 multiplication tie rule matches conversion");
+    require_true(Q15_16(0.5) * Q15_16(-0.5) == Q15_16(-0.25), "Q15.16 multiplication incorrect");
+    require_true(cq.update(Q15_16(1e9)) == Q15_16(UMAX), "Q15.16 pipeline did not saturate at UMAX");
+    require_true(cq.update(Q15_16(-1e9)) == Q15_16(UMIN), "Q15.16 pipeline did not saturate at UMIN");
+
+    std::cout << "[PASS] numeric_types_test: float and Q15.16 pipelines within declared tolerances of double." << std::endl;
+    return 0;
+}
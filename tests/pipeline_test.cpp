@@ -0,0 +1,275 @@
+#include <atomic>
+#include <cmath>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_pipeline.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static bool same_bits(double a, double b)
+{
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+template <typename Fn>
+static bool throws(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+static PipelineSample sample(std::uint64_t k)
+{
+    const double x = static_cast<double>(k);
+    return PipelineSample{ k, 1.5 * std::sin(0.001 * x), 0.25 * std::cos(0.003 * x) };
+}
+
+// Pops until `want` outputs arrived or ~2 s passed.
+static std::vector<PipelineOutput> collect(ControlPipeline& p, std::size_t want)
+{
+    std::vector<PipelineOutput> got;
+    PipelineOutput              buf[64];
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (got.size() < want && std::chrono::steady_clock::now() < deadline)
+    {
+        const std::size_t n = p.pop(buf, 64);
+        got.insert(got.end(), buf, buf + n);
+        if (n == 0) std::this_thread::yield();
+    }
+    return got;
+}
+
+int main()
+{
+    // ---- SpscRing ----
+    {
+        SpscRing<int> ring(5);
+        require_true(ring.capacity() == 8, "capacity rounded up to a power of two");
+
+        int in[10], out[10];
+        for (int i = 0; i < 10; ++i) in[i] = i;
+
+        require_true(ring.push(in, 10) == 8 && ring.size() == 8, "push stops when full");
+        require_true(!ring.try_push(99), "full ring rejects");
+        require_true(ring.pop(out, 3) == 3 && out[2] == 2, "pop in order");
+        require_true(ring.push(in + 8, 2) == 2, "wrap-around push");
+        require_true(ring.pop(out, 10) == 7 && out[0] == 3 && out[6] == 9, "wrap-around pop");
+        require_true(!ring.try_pop(out[0]) && ring.size() == 0, "empty ring");
+
+        // Two threads: every value arrives exactly once, in order.
+        SpscRing<std::uint64_t> shared(64);
+        const std::uint64_t     total = 1'000'000;
+
+        std::thread producer([&] {
+            for (std::uint64_t v = 0; v < total;)
+            {
+                if (shared.try_push(v)) ++v;
+                else std::this_thread::yield();
+            }
+        });
+
+        bool          ordered = true;
+        std::uint64_t next    = 0;
+        std::uint64_t buf[16];
+        while (next < total)
+        {
+            const std::size_t n = shared.pop(buf, 16);
+            for (std::size_t i = 0; i < n; ++i) ordered = ordered && buf[i] == next++;
+            if (n == 0) std::this_thread::yield();
+        }
+        producer.join();
+        require_true(ordered, "cross-thread FIFO order");
+    }
+
+    TanhFOperator       f(2.0);
+    SaturatingEOperator e(0.7, 1.5);
+    AtanhFInvOperator   finv(2.0);
+    LinearGOperator     g(1.5, -1.0, 1.0);
+    Controller          ctrl(f, e, finv, g);
+
+    require_true(throws([&] {
+        PipelineOptions bad;
+        bad.batch = 0;
+        ControlPipeline p(ctrl, bad);
+    }), "batch == 0 rejected");
+
+    // ---- Bursty producer thread, outputs bit-identical and in order ----
+    {
+        PipelineOptions options;
+        options.input_capacity  = 1024;
+        options.output_capacity = 1024;
+        options.batch           = 128;
+        ControlPipeline pipeline(ctrl, options);
+
+        const std::size_t total = 200'000;
+        std::thread producer([&] {
+            std::vector<PipelineSample> burst;
+            for (std::size_t k = 0; k < total;)
+            {
+                burst.clear();
+                const std::size_t size = 1 + (k * 7919) % 500;   // 1..500
+                for (std::size_t i = 0; i < size && k < total; ++i) burst.push_back(sample(k++));
+                pipeline.push(burst.data(), burst.size());
+            }
+        });
+
+        // A third thread never sees more outputs than accepted samples.
+        std::atomic<bool> done{false};
+        bool              ordered = true;
+        std::thread monitor([&] {
+            while (!done.load())
+            {
+                const PipelineStats live = pipeline.stats();
+                ordered = ordered && live.processed <= live.accepted;
+            }
+        });
+
+        const std::vector<PipelineOutput> got = collect(pipeline, total);
+        producer.join();
+        done.store(true);
+        monitor.join();
+        pipeline.stop();
+        require_true(ordered, "stats() never shows processed > accepted");
+
+        bool same = got.size() == total;
+        for (std::size_t k = 0; same && k < total; ++k)
+        {
+            const PipelineSample s = sample(k);
+            same = got[k].tag == k
+                && same_bits(got[k].delta, s.setpoint - s.estimate)
+                && same_bits(got[k].u, ctrl.update(s.setpoint - s.estimate));
+        }
+        require_true(same, "outputs match Controller::update in input order");
+
+        const PipelineStats stats = pipeline.stats();
+        require_true(stats.accepted == total && stats.processed == total, "every sample processed");
+        require_true(stats.dropped == 0 && stats.discarded == 0, "nothing lost under Block");
+        require_true(stats.batches >= total / options.batch && stats.evaluation.count == stats.batches, "batch accounting");
+        std::cout << "pipeline: " << stats.batches << " batches, mean "
+                  << static_cast<double>(total) / static_cast<double>(stats.batches) << " samples" << std::endl;
+    }
+
+    // ---- Backpressure::Drop when the actuator side stops draining ----
+    {
+        PipelineOptions options;
+        options.input_capacity  = 8;
+        options.output_capacity = 8;
+        options.batch           = 4;
+        options.backpressure    = Backpressure::Drop;
+        ControlPipeline pipeline(ctrl, options);
+
+        std::size_t accepted = 0;
+        for (std::uint64_t k = 0; k < 1000; ++k)
+        {
+            if (pipeline.push(sample(k))) ++accepted;
+            if (k % 50 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        // At most: a full output queue, one stalled batch, a full input queue.
+        require_true(accepted >= 8 && accepted <= 8 + 4 + 8, "bounded in-flight samples");
+
+        const std::vector<PipelineOutput> got = collect(pipeline, accepted);
+        require_true(got.size() == accepted, "accepted samples still delivered");
+
+        bool increasing = true;
+        for (std::size_t i = 1; i < got.size(); ++i) increasing = increasing && got[i].tag > got[i - 1].tag;
+        require_true(increasing, "drops keep the survivors in order");
+
+        pipeline.stop();
+        const PipelineStats stats = pipeline.stats();
+        require_true(stats.accepted == accepted && stats.dropped == 1000 - accepted, "drop accounting");
+        require_true(!pipeline.push(sample(0)), "push after stop fails");
+    }
+
+    // ---- Backpressure::Block through a slow actuator ----
+    {
+        PipelineOptions options;
+        options.input_capacity  = 16;
+        options.output_capacity = 16;
+        options.batch           = 8;
+        ControlPipeline pipeline(ctrl, options);
+
+        const std::size_t total = 5000;
+        std::thread producer([&] {
+            for (std::uint64_t k = 0; k < total; ++k) pipeline.push(sample(k));
+        });
+
+        std::vector<PipelineOutput> got;
+        PipelineOutput              out;
+        while (got.size() < total)
+        {
+            if (pipeline.pop(out)) got.push_back(out);
+            if (got.size() % 1000 == 0) std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        producer.join();
+
+        bool ordered = true;
+        for (std::size_t k = 0; k < total; ++k) ordered = ordered && got[k].tag == k;
+        require_true(ordered, "blocking producer loses nothing");
+        require_true(pipeline.stats().dropped == 0, "no drops under Block");
+    }
+
+    // ---- flush_us collects a partial batch ----
+    {
+        PipelineOptions options;
+        options.batch    = 64;
+        options.flush_us = 200'000;
+        ControlPipeline pipeline(ctrl, options);
+
+        pipeline.push(sample(0));
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        const PipelineSample two[2] = { sample(1), sample(2) };
+        pipeline.push(two, 2);
+
+        const std::vector<PipelineOutput> got = collect(pipeline, 3);
+        require_true(got.size() == 3 && got[2].tag == 2, "partial batch flushed");
+        require_true(pipeline.stats().batches == 1, "late samples joined the waiting batch");
+    }
+
+    // ---- stop() with queued input ----
+    {
+        PipelineOptions options;
+        options.output_capacity = 4;
+        options.batch           = 4;
+        ControlPipeline pipeline(ctrl, options);
+
+        for (std::uint64_t k = 0; k < 100; ++k) pipeline.push(sample(k));
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        pipeline.stop();
+        pipeline.stop();
+
+        const PipelineStats stats = pipeline.stats();
+        require_true(stats.processed == 4, "only the output queue's worth published");
+        require_true(stats.processed + stats.discarded == stats.accepted, "stop() accounts for the rest");
+        require_true(collect(pipeline, 4).size() == 4, "published outputs remain poppable");
+    }
+
+    std::cout << "[PASS] pipeline_test: SPSC queues, batching and backpressure" << std::endl;
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "ect_sdk.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static bool same_bits(double a, double b)
+{
+    std::uint64_t ba = 0;
+    std::uint64_t bb = 0;
+    std::memcpy(&ba, &a, sizeof(a));
+    std::memcpy(&bb, &b, sizeof(b));
+    return ba == bb;
+}
+
+// Affine embedding with a scale and offset, reporting its form.
+class ShiftedFOperator final : public FOperator
+{
+public:
+    double apply(double delta) const override { return 2.0 * delta + 0.125; }
+
+    bool affine_form(AffineForm& form) const override
+    {
+        form        = AffineForm{};
+        form.scale  = 2.0;
+        form.offset = 0.125;
+        return true;
+    }
+};
+
+// Same arithmetic, but without introspection.
+class OpaqueFOperator final : public FOperator
+{
+public:
+    double apply(double delta) const override { return 2.0 * delta + 0.125; }
+};
+
+// Clamping E stage: an intermediate clamp must keep the plan generic.
+class ClampedEOperator final : public EOperator
+{
+public:
+    double apply(double x) const override { return x < -1.0 ? -1.0 : (x > 1.0 ? 1.0 : x); }
+
+    bool affine_form(AffineForm& form) const override
+    {
+        form       = AffineForm{};
+        form.lower = -1.0;
+        form.upper =  1.0;
+        return true;
+    }
+};
+
+static std::vector<double> make_inputs()
+{
+    std::vector<double> v = { 0.0, -0.0, 1e-320, -1e-320,
+                              std::numeric_limits<double>::infinity(),
+                              -std::numeric_limits<double>::infinity(),
+                              std::numeric_limits<double>::quiet_NaN() };
+    for (int k = 0; k < 2001; ++k)
+    {
+        v.push_back(-5.0 + 10.0 * static_cast<double>(k) / 2000.0 + 1e-7 * k);
+    }
+    return v;
+}
+
+static void require_exact(const Controller& c, const ExecutionPlan& p, const std::vector<double>& in, const char* msg)
+{
+    std::vector<double> batch(in.size());
+    p.evaluate_batch(in.data(), batch.data(), in.size());
+
+    for (std::size_t i = 0; i < in.size(); ++i)
+    {
+        const double ref = c.update(in[i]);
+        require_true(same_bits(p.evaluate(in[i]), ref), msg);
+        require_true(same_bits(batch[i], ref), msg);
+    }
+}
+
+int main()
+{
+    const std::vector<double> inputs = make_inputs();
+
+    LinearFOperator    f;
+    LinearEOperator    e(0.8);
+    LinearFInvOperator finv;
+    LinearGOperator    g(1.3, -2.0, 2.0);
+
+    // Default linear pipeline: F and F⁻¹ fold away, two multiplies remain.
+    Controller linear(f, e, finv, g);
+    const ExecutionPlan exact = linear.plan();
+    require_true(exact.kind() == ExecutionPlan::Kind::Affine, "Linear pipeline not fused");
+    require_true(exact.exact(), "Default plan must be exact");
+    require_true(exact.steps() == 2, "Identity stages were not folded");
+    require_exact(linear, exact, inputs, "Exact fused plan differs from update()");
+
+    // Reassociated plan: one multiply, close but not necessarily bit-exact.
+    PlanOptions fast;
+    fast.allow_reassociation = true;
+    const ExecutionPlan folded = linear.plan(fast);
+    require_true(folded.steps() == 1, "Gains were not pre-multiplied");
+    require_true(!folded.exact(), "Reassociated plan must not claim exactness");
+    for (double d : inputs)
+    {
+        const double ref = linear.update(d);
+        const double got = folded.evaluate(d);
+        if (std::isnan(ref))
+        {
+            require_true(std::isnan(got), "Reassociated plan lost NaN");
+            continue;
+        }
+        require_true(std::fabs(got - ref) <= 4.0 * std::numeric_limits<double>::epsilon() * std::fabs(ref),
+                     "Reassociated plan exceeds 4 ulp");
+    }
+
+    // Custom affine operator with offset participates in fusion.
+    ShiftedFOperator shifted;
+    Controller with_offset(shifted, e, finv, g);
+    const ExecutionPlan offset_plan = with_offset.plan();
+    require_true(offset_plan.kind() == ExecutionPlan::Kind::Affine, "Introspected custom operator not fused");
+    require_exact(with_offset, offset_plan, inputs, "Fused plan with offset differs from update()");
+
+    // Opaque operators fall back to the generic chain.
+    OpaqueFOperator opaque;
+    Controller generic(opaque, e, finv, g);
+    require_true(generic.plan().kind() == ExecutionPlan::Kind::Generic, "Opaque operator was fused");
+    require_exact(generic, generic.plan(), inputs, "Generic plan differs from update()");
+
+    ClampedEOperator clamped;
+    Controller mid_clamp(f, clamped, finv, g);
+    require_true(mid_clamp.plan().kind() == ExecutionPlan::Kind::Generic, "Intermediate clamp was fused");
+    require_exact(mid_clamp, mid_clamp.plan(), inputs, "Generic plan (clamp) differs from update()");
+
+    std::cout << "[PASS] plan_test: fused plans bit-identical to update(); reassociated plan within 4 ulp." << std::endl;
+    return 0;
+}
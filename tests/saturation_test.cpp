@@ -0,0 +1,254 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_saturation.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static bool same_bits(double a, double b)
+{
+    return std::memcmp(&a, &b, sizeof(double)) == 0;
+}
+
+// Opaque G that only reports an affine form; exercises the default evaluate().
+class AffineOnlyG final : public GOperator
+{
+public:
+    double apply(double x) const override
+    {
+        const double y = 2.0 * x + 0.5;
+        if (y < -1.0) return -1.0;
+        if (y >  1.0) return  1.0;
+        return y;
+    }
+
+    bool affine_form(AffineForm& form) const override
+    {
+        form        = AffineForm{};
+        form.scale  = 2.0;
+        form.offset = 0.5;
+        form.lower  = -1.0;
+        form.upper  = 1.0;
+        return true;
+    }
+};
+
+int main()
+{
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+
+    // ---- LinearGOperator::evaluate: u, raw and state ----
+    {
+        LinearGOperator g(2.0, -1.0, 1.0);
+
+        const GEvaluation lo = g.evaluate(-3.0);
+        require_true(lo.u == -1.0 && lo.raw == -6.0 && lo.state == ClampState::SatMin, "clamped at u_min");
+
+        const GEvaluation hi = g.evaluate(0.75);
+        require_true(hi.u == 1.0 && hi.raw == 1.5 && hi.state == ClampState::SatMax, "clamped at u_max");
+
+        const GEvaluation free = g.evaluate(0.25);
+        require_true(free.u == 0.5 && free.raw == 0.5 && free.state == ClampState::Free, "free");
+
+        const GEvaluation edge = g.evaluate(0.5);
+        require_true(edge.u == 1.0 && edge.state == ClampState::Free, "exactly on the bound is not clamped");
+
+        const GEvaluation n = g.evaluate(nan);
+        require_true(std::isnan(n.u) && n.state == ClampState::Free, "NaN passes unclamped");
+    }
+
+    // ---- Batch kernel matches the scalar path for every lane and tail ----
+    {
+        LinearGOperator g(1.7, -2.0, 3.0);
+
+        std::vector<double> in;
+        for (int i = -40; i <= 40; ++i) in.push_back(0.1 * i);
+        in.push_back(nan);
+        in.push_back(-0.0);
+        in.push_back(std::numeric_limits<double>::infinity());
+
+        for (std::size_t n = 0; n <= in.size(); n += 7)
+        {
+            std::vector<double>      u(n), raw(n);
+            std::vector<std::int8_t> state(n);
+            g.evaluate_batch(in.data(), u.data(), raw.data(), state.data(), n);
+
+            bool same = true;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const GEvaluation r = g.evaluate(in[i]);
+                same = same && same_bits(u[i], r.u) && same_bits(raw[i], r.raw)
+                            && state[i] == static_cast<std::int8_t>(r.state)
+                            && same_bits(u[i], g.apply(in[i]));
+            }
+            require_true(same, "evaluate_batch matches evaluate");
+        }
+
+        // raw is optional and in/u may alias.
+        std::vector<double>      buf = in;
+        std::vector<std::int8_t> state(in.size());
+        g.evaluate_batch(buf.data(), buf.data(), nullptr, state.data(), buf.size());
+        bool same = true;
+        for (std::size_t i = 0; i < in.size(); ++i)
+        {
+            same = same && same_bits(buf[i], g.apply(in[i]));
+        }
+        require_true(same, "in-place evaluate_batch without raw");
+    }
+
+    // ---- Default evaluate() uses affine_form; opaque G reports Free ----
+    {
+        AffineOnlyG g;
+        const GEvaluation r = g.evaluate(1.0);
+        require_true(r.u == 1.0 && r.raw == 2.5 && r.state == ClampState::SatMax, "default evaluate via affine form");
+
+        SmoothSaturationGOperator smooth(1.0, -1.0, 2.0);
+        const GEvaluation s = smooth.evaluate(0.5);
+        require_true(s.raw == 0.5 && s.state == ClampState::Free && s.u == smooth.apply(0.5), "smooth G, free");
+        require_true(smooth.evaluate(1e6).state == ClampState::SatMax, "smooth G reaching the bound");
+    }
+
+    // ---- Controller::evaluate / evaluate_batch agree with update() ----
+    {
+        LinearFOperator    f;
+        LinearEOperator    e(0.8);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.0, -1.0, 1.0);
+        Controller         ctrl(f, e, finv, g);
+
+        std::vector<double> deltas;
+        for (int i = -50; i <= 50; ++i) deltas.push_back(0.05 * i);
+
+        std::vector<double>      u(deltas.size()), raw(deltas.size());
+        std::vector<std::int8_t> state(deltas.size());
+        ctrl.evaluate_batch(deltas.data(), u.data(), raw.data(), state.data(), deltas.size());
+
+        bool same = true;
+        for (std::size_t i = 0; i < deltas.size(); ++i)
+        {
+            const GEvaluation r = ctrl.evaluate(deltas[i]);
+            same = same && same_bits(r.u, ctrl.update(deltas[i])) && same_bits(u[i], r.u)
+                        && same_bits(raw[i], r.raw) && state[i] == static_cast<std::int8_t>(r.state)
+                        && r.raw == 0.8 * deltas[i];
+        }
+        require_true(same, "controller evaluate matches update");
+
+        const SaturationStats s = saturation_stats(state.data(), state.size());
+        require_true(s.samples == deltas.size(), "stats sample count");
+        require_true(s.sat_min == 25 && s.sat_max == 25, "stats counts");   // |0.8 * d| > 1 for |i| > 25
+        require_true(s.runs == 2 && s.longest_run == 25, "stats runs");
+        require_true(s.duty_cycle() == 50.0 / 101.0, "stats duty cycle");
+    }
+
+    // ---- saturation_stats on hand-written series ----
+    {
+        const std::int8_t series[] = { 0, 1, 1, -1, -1, -1, 0, 0, 1, 0, -1 };
+        const SaturationStats s = saturation_stats(series, sizeof(series));
+        require_true(s.sat_min == 4 && s.sat_max == 3, "series counts");
+        require_true(s.runs == 4, "side switch starts a new run");
+        require_true(s.longest_run == 3, "longest run");
+
+        require_true(saturation_stats(series, 0).duty_cycle() == 0.0, "empty series");
+    }
+
+    // ---- Bank state and fleet tracker ----
+    {
+        const std::size_t n = 1037;
+        ControllerBank bank(n);
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double bound = 0.5 + 0.01 * static_cast<double>(i % 50);
+            bank.set(i, 0.8, 1.0 + 0.001 * static_cast<double>(i), -bound, bound);
+        }
+
+        ThreadPoolOptions pool_options;
+        pool_options.threads = 4;
+        ThreadPool pool(pool_options);
+
+        SaturationTracker serial(n);
+        SaturationTracker pooled(n);
+
+        std::vector<double>      deltas(n), out(n), out_ref(n);
+        std::vector<std::int8_t> state(n), state_pool(n);
+
+        std::vector<std::uint64_t> longest(n, 0), run(n, 0), runs(n, 0);
+        std::vector<std::int8_t>   prev(n, 0);
+
+        const std::size_t ticks = 60;
+        for (std::size_t k = 0; k < ticks; ++k)
+        {
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                deltas[i] = 2.0 * std::sin(0.1 * static_cast<double>(k) + 0.37 * static_cast<double>(i));
+            }
+
+            bank.evaluate(deltas.data(), out.data(), state.data());
+            bank.evaluate(deltas.data(), out_ref.data());
+            require_true(std::memcmp(out.data(), out_ref.data(), n * sizeof(double)) == 0, "bank outputs unchanged");
+
+            bank.evaluate(deltas.data(), out.data(), state_pool.data(), pool, 64);
+            require_true(std::memcmp(state.data(), state_pool.data(), n) == 0, "bank state thread-independent");
+
+            bool same = true;
+            for (std::size_t i = 0; i < n; ++i)
+            {
+                const double raw = bank.gain()[i] * (bank.alpha()[i] * deltas[i]);
+                const ClampState expect = raw < bank.u_min()[i] ? ClampState::SatMin
+                                        : (raw > bank.u_max()[i] ? ClampState::SatMax : ClampState::Free);
+                same = same && state[i] == static_cast<std::int8_t>(expect);
+
+                const std::int8_t v = state[i];
+                run[i]     = v == 0 ? 0 : (v == prev[i] ? run[i] + 1 : 1);
+                runs[i]   += (v != 0 && v != prev[i]) ? 1 : 0;
+                longest[i] = std::max(longest[i], run[i]);
+                prev[i]    = v;
+            }
+            require_true(same, "bank state matches the clamp branch");
+
+            serial.record(state.data());
+            pooled.record(state.data(), pool, 64);
+        }
+
+        require_true(serial.ticks() == ticks, "tracker tick count");
+
+        bool same = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const SaturationStats a = serial.entity(i);
+            const SaturationStats b = pooled.entity(i);
+            same = same && a.runs == runs[i] && a.longest_run == longest[i]
+                        && a.sat_min == b.sat_min && a.sat_max == b.sat_max
+                        && a.runs == b.runs && a.longest_run == b.longest_run;
+        }
+        require_true(same, "tracker runs match reference and are thread-independent");
+
+        const SaturationStats total = serial.total();
+        require_true(total.samples == ticks * n, "tracker total samples");
+        require_true(total.saturated() > 0 && total.duty_cycle() < 1.0, "tracker sees saturation");
+
+        serial.reset();
+        require_true(serial.ticks() == 0 && serial.total().saturated() == 0, "tracker reset");
+    }
+
+    std::cout << "[PASS] saturation_test: clamp classification and saturation analytics" << std::endl;
+    return 0;
+}
@@ -0,0 +1,237 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "ect_controller_bank.hpp"
+#include "ect_shared_bank.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+template <typename Fn>
+static bool throws(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+static const std::size_t   LANES = 1027;
+static const std::uint64_t TICKS = 2000;
+
+static ControllerBank make_bank()
+{
+    std::vector<double> alpha(LANES), gain(LANES), u_min(LANES), u_max(LANES);
+    for (std::size_t i = 0; i < LANES; ++i)
+    {
+        alpha[i] = 0.5 + 0.4 * static_cast<double>(i % 5) / 4.0;
+        gain[i]  = 1.0 + 0.1 * static_cast<double>(i % 3);
+        u_min[i] = -1.0 - static_cast<double>(i % 4);
+        u_max[i] = 1.0 + static_cast<double>(i % 7);
+    }
+    return ControllerBank(std::move(alpha), std::move(gain), std::move(u_min), std::move(u_max));
+}
+
+// Deviation of lane i at tick t; any reader can recompute it.
+static double deviation(std::uint64_t t, std::size_t i)
+{
+    return static_cast<double>((t * 7919 + i * 104729) % 20011) * 0.001 - 10.0;
+}
+
+static void fill(double* d, std::uint64_t t)
+{
+    for (std::size_t i = 0; i < LANES; ++i) d[i] = deviation(t, i);
+}
+
+static bool matches(const ControllerBank& bank, const double* u, std::uint64_t t)
+{
+    std::vector<double> d(LANES), expected(LANES);
+    fill(d.data(), t);
+    bank.evaluate(d.data(), expected.data());
+    return std::memcmp(u, expected.data(), LANES * sizeof(double)) == 0;
+}
+
+// Runs `fn` in a child process; its return value is the exit status.
+template <typename Fn>
+static pid_t spawn(Fn fn)
+{
+    const pid_t pid = ::fork();
+    if (pid == 0)
+    {
+        int status = 1;
+        try
+        {
+            status = fn();
+        }
+        catch (const std::exception& e)
+        {
+            std::cerr << "child: " << e.what() << std::endl;
+        }
+        std::_Exit(status);
+    }
+    return pid;
+}
+
+static bool exited_cleanly(pid_t pid)
+{
+    int status = 0;
+    return ::waitpid(pid, &status, 0) == pid && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+int main()
+{
+    const std::string name = "/ect_shared_bank_test_" + std::to_string(::getpid());
+    SharedBank::remove(name);
+
+    const ControllerBank bank = make_bank();
+
+    // ---- One process: publish, step, read ----
+    {
+        SharedBank region(name, LANES);
+        require_true(region.size() == LANES && region.latest(SharedChannel::Deviation) == 0, "fresh region");
+        require_true(region.read_begin(SharedChannel::Output).data == nullptr, "nothing published yet");
+        require_true(region.step(bank) == 0, "no deviations, no step");
+
+        double* d = region.write_begin(SharedChannel::Deviation);
+        require_true(d == region.write_begin(SharedChannel::Deviation), "write_begin idempotent until publish");
+        fill(d, 1);
+        region.publish(SharedChannel::Deviation, 1);
+
+        SharedBank peer(name);   // attach in the same process
+        require_true(peer.size() == LANES && peer.latest(SharedChannel::Deviation) == 1, "attached view");
+        require_true(peer.step(bank) == 1 && peer.step(bank) == 0, "one step per new tick");
+
+        const SharedFrame out = region.read_begin(SharedChannel::Output);
+        require_true(out.tick == 1 && matches(bank, out.data, 1), "output evaluated in place");
+        require_true(region.read_valid(SharedChannel::Output, out), "undisturbed read is valid");
+
+        // A writer that laps the reader twice invalidates the frame.
+        const SharedFrame stale = region.read_begin(SharedChannel::Deviation);
+        for (std::uint64_t t = 2; t <= 3; ++t)
+        {
+            fill(region.write_begin(SharedChannel::Deviation), t);
+            region.publish(SharedChannel::Deviation, t);
+        }
+        require_true(!region.read_valid(SharedChannel::Deviation, stale), "overwritten frame detected");
+
+        // One publish leaves the previous buffer alone.
+        const SharedFrame kept = region.read_begin(SharedChannel::Deviation);
+        fill(region.write_begin(SharedChannel::Deviation), 4);
+        require_true(region.read_valid(SharedChannel::Deviation, kept), "double buffer protects the last frame");
+        region.publish(SharedChannel::Deviation, 4);
+
+        require_true(throws([&] { region.publish(SharedChannel::Deviation, 5); }), "publish without write_begin");
+        region.write_begin(SharedChannel::Deviation);
+        require_true(throws([&] { region.publish(SharedChannel::Deviation, 4); }), "non-increasing tick");
+        require_true(region.wait(SharedChannel::Deviation, 4, std::chrono::milliseconds(5)) == 0, "wait times out");
+
+        require_true(throws([&] { SharedBank again(name, LANES); }), "create refuses an existing region");
+        require_true(throws([&] { region.step(ControllerBank(3)); }), "bank size mismatch");
+    }
+    require_true(SharedBank::remove(name) && !SharedBank::remove(name), "remove unlinks once");
+
+    // ---- Writer crashes between write_begin() and publish(), then re-attaches ----
+    {
+        SharedBank owner(name, LANES);
+        {
+            SharedBank crashed(name);
+            fill(crashed.write_begin(SharedChannel::Deviation), 99);   // never published
+        }
+
+        SharedBank writer(name);
+        for (std::uint64_t t = 1; t <= 4; ++t)
+        {
+            fill(writer.write_begin(SharedChannel::Deviation), t);
+            writer.publish(SharedChannel::Deviation, t);
+
+            const SharedFrame f = owner.read_begin(SharedChannel::Deviation);
+            require_true(f.tick == t && owner.read_valid(SharedChannel::Deviation, f), "readable after a writer crash");
+            require_true(owner.step(bank) == t, "controller keeps up after a writer crash");
+        }
+    }
+    SharedBank::remove(name);
+
+    // ---- Estimator, controller and actuator as separate processes ----
+    {
+        SharedBank region(name, LANES);
+
+        const pid_t estimator = spawn([&] {
+            SharedBank shm(name);
+            // Paced by the controller so every tick is evaluated.
+            for (std::uint64_t t = 1; t <= TICKS; ++t)
+            {
+                fill(shm.write_begin(SharedChannel::Deviation), t);
+                shm.publish(SharedChannel::Deviation, t);
+                if (shm.wait(SharedChannel::Output, t - 1, std::chrono::seconds(10)) < t) return 2;
+            }
+            return 0;
+        });
+
+        const pid_t controller = spawn([&] {
+            SharedBank shm(name);
+            std::uint64_t done = 0;
+            while (done < TICKS)
+            {
+                if (shm.wait(SharedChannel::Deviation, done, std::chrono::seconds(10)) == 0) return 3;
+                const std::uint64_t t = shm.step(bank);
+                if (t != 0) done = t;
+            }
+            return 0;
+        });
+
+        // Actuator: every output frame seen must be exactly the bank's
+        // answer to that tick's deviations.
+        std::uint64_t seen = 0, frames = 0;
+        bool          consistent = true;
+        while (seen < TICKS)
+        {
+            if (region.wait(SharedChannel::Output, seen, std::chrono::seconds(10)) == 0) break;
+
+            const SharedFrame out = region.read_begin(SharedChannel::Output);
+            const bool        ok  = matches(bank, out.data, out.tick);
+            if (!region.read_valid(SharedChannel::Output, out)) continue;
+
+            consistent = consistent && ok && out.tick > seen;
+            seen       = out.tick;
+            ++frames;
+        }
+
+        require_true(exited_cleanly(estimator) && exited_cleanly(controller), "producer and controller processes");
+        require_true(seen == TICKS && consistent, "every observed output matches its tick");
+        std::cout << "shared_bank: " << frames << " of " << TICKS << " ticks observed across processes" << std::endl;
+    }
+    SharedBank::remove(name);
+
+    // ---- Validation ----
+    {
+        require_true(throws([] { SharedBank("no_slash", 4); }), "name without slash");
+        require_true(throws([] { SharedBank("/a/b", 4); }), "name with inner slash");
+        require_true(throws([&] { SharedBank(name, 0); }), "zero size");
+        require_true(throws([&] { SharedBank attached(name); }), "attach to a missing region");
+    }
+
+    std::cout << "[PASS] shared_bank_test: zero-copy deviation/output exchange between processes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,205 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_controller_bank.hpp"
+#include "ect_simulation.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static bool same_metrics(const ScenarioMetrics& a, const ScenarioMetrics& b)
+{
+    return a.settled == b.settled
+        && a.settling_step == b.settling_step
+        && std::memcmp(&a.overshoot, &b.overshoot, sizeof(double)) == 0
+        && std::memcmp(&a.saturation_fraction, &b.saturation_fraction, sizeof(double)) == 0
+        && std::memcmp(&a.final_position, &b.final_position, sizeof(double)) == 0
+        && std::memcmp(&a.final_error, &b.final_error, sizeof(double)) == 0
+        && std::memcmp(&a.max_abs_error, &b.max_abs_error, sizeof(double)) == 0;
+}
+
+int main()
+{
+    // ---- Integrator matches the hand-rolled example loop ----
+    {
+        const std::size_t steps = 200;
+        const TargetProfile target = TargetProfile::ramp_sine(0.0, 0.02, 1.0, 0.15);
+
+        ControllerBank bank(1);
+        bank.set(0, 0.8, 1.0, -1.0, 1.0);
+
+        SimulationOptions options;
+        options.steps = steps;
+
+        const SimulationResult r = simulate(bank, IntegratorPlant(), { target }, { 0.0 }, options);
+
+        LinearFOperator    f;
+        LinearEOperator    e(0.8);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.0, -1.0, 1.0);
+        Controller         ctrl(f, e, finv, g);
+
+        double      pos = 0.0;
+        std::size_t sat = 0;
+        for (std::size_t k = 0; k < steps; ++k)
+        {
+            const GEvaluation r = ctrl.evaluate(target.at(k) - pos);
+            sat += r.state != ClampState::Free ? 1 : 0;
+            pos += r.u;
+        }
+
+        require_true(r.scenarios[0].final_position == pos, "integrator trajectory matches hand-rolled loop");
+        require_true(r.scenarios[0].saturation_fraction == static_cast<double>(sat) / steps,
+                     "saturation fraction matches hand-rolled loop");
+    }
+
+    // ---- An output exactly on a bound is not saturated (ClampState rule) ----
+    {
+        ControllerBank bank(1);
+        bank.set(0, 0.5, 1.0, -1.0, 1.0);
+
+        SimulationOptions options;
+        options.steps = 10;
+
+        // A plant with zero gain holds delta at 2, so raw = u = u_max.
+        const SimulationResult r = simulate(bank, IntegratorPlant(0.0), { TargetProfile::constant(2.0) }, { 0.0 }, options);
+        require_true(r.scenarios[0].final_position == 0.0, "frozen plant");
+        require_true(r.scenarios[0].saturation_fraction == 0.0, "u == u_max with raw == u_max is not saturated");
+    }
+
+    // ---- Constant target: settling, no overshoot for a pure integrator ----
+    {
+        ControllerBank bank(2);
+        bank.set(0, 0.8, 1.0, -10.0, 10.0);
+        bank.set(1, 0.8, 1.0, -1.0, 1.0);   // saturates for the first steps
+
+        const SimulationResult r = simulate(
+            bank, IntegratorPlant(0.4),
+            { TargetProfile::constant(10.0), TargetProfile::constant(10.0) },
+            { 0.0, 0.0 });
+
+        for (const ScenarioMetrics& m : r.scenarios)
+        {
+            require_true(m.settled, "integrator settles");
+            require_true(m.overshoot == 0.0, "first-order approach does not overshoot");
+            require_true(std::fabs(m.final_error) <= 0.2, "final error inside the band");
+        }
+        require_true(r.scenarios[0].saturation_fraction == 0.0, "wide bounds never saturate");
+        require_true(r.scenarios[1].saturation_fraction > 0.0, "tight bounds saturate");
+        require_true(r.scenarios[1].settling_step > r.scenarios[0].settling_step, "saturation slows settling");
+        require_true(r.summary.settled == 2 && r.summary.scenarios == 2, "summary counts");
+    }
+
+    // ---- Underdamped plants overshoot, overdamped ones do not ----
+    {
+        ControllerBank bank(1);
+        bank.set(0, 1.0, 4.0, -100.0, 100.0);
+
+        SimulationOptions options;
+        options.steps = 4000;
+
+        const SimulationResult under = simulate(
+            bank, MassSpringDamperPlant(1.0, 0.0, 0.5, 0.01),
+            { TargetProfile::constant(1.0) }, { 0.0 }, options);
+        const SimulationResult over = simulate(
+            bank, SecondOrderLagPlant(1.0, 2.0, 3.0, 0.01),
+            { TargetProfile::constant(1.0) }, { 0.0 }, options);
+
+        require_true(under.scenarios[0].overshoot > 0.05, "underdamped plant overshoots");
+        require_true(under.scenarios[0].settled, "underdamped plant settles");
+        require_true(over.scenarios[0].overshoot == 0.0, "overdamped plant does not overshoot");
+
+        const SimulationResult lag = simulate(
+            bank, FirstOrderLagPlant(1.0, 0.5, 0.01),
+            { TargetProfile::constant(1.0) }, { 0.0 }, options);
+        // Proportional control of a lag leaves an offset of 1 / (1 + K).
+        require_true(std::fabs(lag.scenarios[0].final_error - 0.2) < 1e-9, "first-order lag steady-state offset");
+
+        const SimulationResult drone = simulate(
+            bank, DroneVerticalPlant(1.0, 2.0, 0.01),
+            { TargetProfile::constant(10.0) }, { 0.0 }, options);
+        require_true(drone.scenarios[0].settled, "drone with hover feed-forward settles");
+    }
+
+    // ---- Batch run: bit-identical for any thread count ----
+    {
+        const std::size_t N = 3001;
+
+        ControllerBank             bank(N);
+        std::vector<TargetProfile> targets(N);
+        std::vector<double>        initial(N);
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            const double s = static_cast<double>(i % 13);
+            bank.set(i, 0.2 + 0.05 * s, 0.5 + 0.1 * static_cast<double>(i % 7), -1.0 - s, 1.0 + s);
+            targets[i] = (i % 2) ? TargetProfile::ramp_sine(s, 0.01, 1.0, 0.1 + 0.01 * s)
+                                 : TargetProfile::constant(5.0 - s);
+            initial[i] = -s;
+        }
+
+        SimulationOptions options;
+        options.steps = 300;
+        options.grain = 97;
+
+        const DroneVerticalPlant plant(1.5, 1.0, 0.05);
+        const SimulationResult   serial = simulate(bank, plant, targets, initial, options);
+
+        for (std::size_t threads : { std::size_t(1), std::size_t(2), std::size_t(4) })
+        {
+            ThreadPoolOptions po;
+            po.threads = threads;
+            ThreadPool pool(po);
+
+            const SimulationResult par = simulate(bank, plant, targets, initial, options, pool);
+            for (std::size_t i = 0; i < N; ++i)
+            {
+                require_true(same_metrics(serial.scenarios[i], par.scenarios[i]),
+                             "parallel simulation must be bit-identical to serial");
+            }
+            require_true(par.summary.settled == serial.summary.settled, "summary independent of threads");
+        }
+    }
+
+    // ---- Validation ----
+    {
+        bool threw = false;
+        try
+        {
+            simulate(ControllerBank(2), IntegratorPlant(), { TargetProfile::constant(1.0) }, { 0.0, 0.0 });
+        }
+        catch (const std::invalid_argument&)
+        {
+            threw = true;
+        }
+        require_true(threw, "mismatched scenario columns rejected");
+
+        threw = false;
+        try
+        {
+            FirstOrderLagPlant bad(1.0, 0.1, 0.2);
+        }
+        catch (const std::invalid_argument&)
+        {
+            threw = true;
+        }
+        require_true(threw, "dt > tau rejected");
+    }
+
+    std::cout << "[PASS] simulation_test: plants, metrics and parallel determinism" << std::endl;
+    return 0;
+}
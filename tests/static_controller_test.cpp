@@ -0,0 +1,64 @@
+#include <cstdlib>
+#include <iostream>
+
+#include "ect_sdk.hpp"
+#include "ect_static_controller.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+// Evaluated entirely at compile time.
+constexpr StaticLinearController kStatic = make_static_linear_controller(0.8, 1.0, -1.0, 1.0);
+constexpr auto kTable = make_response_table<9>(kStatic, -4.0, 4.0);
+
+static_assert(kStatic.update(0.0) == 0.0, "u(0) must be 0 for linear operators");
+static_assert(kStatic.update(0.5) == 0.8 * 0.5, "unsaturated output must be alpha * delta");
+static_assert(kTable[0] == -1.0 && kTable[8] == 1.0, "table ends must saturate");
+static_assert(kTable[4] == 0.0, "table centre must be 0");
+
+int main()
+{
+    LinearFOperator    f;
+    LinearEOperator    e(0.8);
+    LinearFInvOperator finv;
+    LinearGOperator    g(1.0, -1.0, 1.0);
+
+    Controller dynamic(f, e, finv, g);
+
+    const double inputs[] = { -1e12, -3.0, -1.25, -1.0, -0.3, -1e-12, 0.0,
+                              1e-12, 0.3, 1.0, 1.25, 3.0, 1e12 };
+
+    // Static and polymorphic pipelines must agree exactly.
+    for (double d : inputs)
+    {
+        require_true(kStatic.update(d) == dynamic.update(d),
+                     "StaticController output differs from Controller");
+    }
+
+    for (std::size_t i = 0; i < kTable.size(); ++i)
+    {
+        const double d = -4.0 + 1.0 * static_cast<double>(i);
+        require_true(kTable[i] == dynamic.update(d),
+                     "Compile-time response table differs from Controller");
+    }
+
+    // Existing Linear operators are also accepted as concrete types.
+    StaticController<LinearFOperator, LinearEOperator, LinearFInvOperator, LinearGOperator>
+        concrete(f, e, finv, g);
+    for (double d : inputs)
+    {
+        require_true(concrete.update(d) == dynamic.update(d),
+                     "StaticController over Linear* operators differs from Controller");
+    }
+
+    std::cout << "[PASS] static_controller_test: StaticController matches Controller, constexpr table verified." << std::endl;
+    return 0;
+}
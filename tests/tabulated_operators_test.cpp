@@ -0,0 +1,146 @@
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_tabulated_operators.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+// Deliberately non-monotone operator: the report must flag it.
+class WavyEOperator final : public EOperator
+{
+public:
+    double apply(double x) const override { return 0.2 * x + 0.1 * std::sin(4.0 * x); }
+};
+
+int main()
+{
+    SaturatingEOperator source(0.8, 2.0);
+
+    // Uniform linear table
+    TableSpec spec;
+    spec.lo     = -10.0;
+    spec.hi     =  10.0;
+    spec.points = 2001; // 0 is a breakpoint
+
+    TableReport linear_report;
+    TabulatedEOperator linear(source, spec, &linear_report);
+    require_true(linear_report.points == 2001, "Uniform table size mismatch");
+    require_true(linear_report.max_abs_error < 1e-4, "Linear table error too large");
+    require_true(linear_report.monotone, "Linear table lost monotonicity");
+    require_true(linear_report.sign_preserving, "Linear table lost sign preservation");
+
+    // Uniform monotone-cubic table: same points, much smaller error.
+    spec.interpolation = Interpolation::Cubic;
+    TableReport cubic_report;
+    TabulatedEOperator cubic(source, spec, &cubic_report);
+    require_true(cubic_report.max_abs_error < 1e-7, "Cubic table error too large");
+    require_true(cubic_report.max_abs_error < linear_report.max_abs_error, "Cubic table not more accurate than linear");
+    require_true(cubic_report.monotone && cubic_report.sign_preserving, "Cubic table lost invariants");
+
+    // Adaptive table: refines only where the curvature is.
+    TableSpec adaptive_spec;
+    adaptive_spec.lo        = -10.0;
+    adaptive_spec.hi        =  10.0;
+    adaptive_spec.points    = 17;
+    adaptive_spec.adaptive  = true;
+    adaptive_spec.tolerance = 1e-6;
+
+    TableReport adaptive_report;
+    TabulatedEOperator adaptive(source, adaptive_spec, &adaptive_report);
+    require_true(adaptive_report.points < linear_report.points, "Adaptive table not smaller than uniform");
+    require_true(adaptive_report.max_abs_error < 1e-5, "Adaptive table error too large");
+    require_true(adaptive_report.monotone && adaptive_report.sign_preserving, "Adaptive table lost invariants");
+
+    // Values agree with the report and the source everywhere in the domain.
+    for (int k = -999; k <= 999; ++k)
+    {
+        const double x = 0.01 * k + 0.00123;
+        require_true(std::fabs(cubic.apply(x) - source.apply(x)) <= cubic_report.max_abs_error * 2.0 + 1e-15,
+                     "Cubic table deviates beyond reported error");
+        require_true(std::fabs(adaptive.apply(x)) <= std::fabs(x), "Tabulated E is expansive");
+    }
+    require_true(adaptive.apply(0.0) == 0.0, "Tabulated E(0) != 0");
+    require_true(adaptive.apply(1e9) == adaptive.apply(10.0), "Inputs above the domain are not clamped");
+
+    // apply_batch() is bit-identical to apply(), also outside the domain.
+    {
+        std::vector<double> xs;
+        for (int k = -1200; k <= 1200; ++k) xs.push_back(0.01 * k + 0.00123);
+        xs.push_back(std::nan(""));
+
+        for (const TabulatedEOperator* op : { &linear, &cubic, &adaptive })
+        {
+            std::vector<double> out(xs.size());
+            op->apply_batch(xs.data(), out.data(), xs.size());
+            for (std::size_t i = 0; i < xs.size(); ++i)
+            {
+                const double y = op->apply(xs[i]);
+                require_true(std::memcmp(&y, &out[i], sizeof(y)) == 0, "Tabulated apply_batch differs from apply()");
+            }
+
+            // In place, with a length that leaves a partial last block.
+            std::vector<double> io(xs.begin(), xs.begin() + 301);
+            op->apply_batch(io.data(), io.data(), io.size());
+            for (std::size_t i = 0; i < io.size(); ++i)
+            {
+                const double y = op->apply(xs[i]);
+                require_true(std::memcmp(&y, &io[i], sizeof(y)) == 0, "In-place apply_batch differs from apply()");
+            }
+        }
+    }
+
+    // Drop-in use inside a Controller.
+    LinearFOperator    f;
+    LinearFInvOperator finv;
+    LinearGOperator    g(1.0, -1.0, 1.0);
+    Controller reference(f, source, finv, g);
+    Controller tabulated(f, adaptive, finv, g);
+
+    double prev = tabulated.update(-10.0);
+    for (int k = -999; k <= 1000; ++k)
+    {
+        const double d = 0.01 * k;
+        const double u = tabulated.update(d);
+        require_true(u >= prev, "Tabulated pipeline not monotone");
+        require_true(std::fabs(u - reference.update(d)) < 1e-5, "Tabulated pipeline deviates from source");
+        prev = u;
+    }
+
+    // The report exposes broken invariants.
+    TableSpec coarse;
+    coarse.lo     = -1.0;
+    coarse.hi     =  2.0;
+    coarse.points = 5; // segment (-0.25, 0.5) straddles the origin
+
+    TableReport coarse_report;
+    TabulatedEOperator straddle(source, coarse, &coarse_report);
+    require_true(!coarse_report.sign_preserving, "Sign loss across the origin not reported");
+
+    WavyEOperator wavy;
+    TableSpec wavy_spec;
+    wavy_spec.lo = -3.0;
+    wavy_spec.hi =  3.0;
+    TableReport wavy_report;
+    TabulatedEOperator wavy_table(wavy, wavy_spec, &wavy_report);
+    require_true(!wavy_report.monotone, "Non-monotone source not reported");
+
+    std::cout << "[PASS] tabulated_operators_test: linear err=" << linear_report.max_abs_error
+              << ", cubic err=" << cubic_report.max_abs_error
+              << ", adaptive " << adaptive_report.points << " pts err=" << adaptive_report.max_abs_error
+              << "." << std::endl;
+    return 0;
+}
@@ -0,0 +1,215 @@
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_telemetry.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static std::string temp_path(const char* name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+int main()
+{
+    // ---- Ring: FIFO order, bounded capacity ----
+    {
+        TelemetryRing ring(3);
+        require_true(ring.capacity() == 4, "capacity rounds up to a power of two");
+
+        TelemetryRecord r;
+        for (std::uint64_t k = 0; k < 4; ++k)
+        {
+            r.step = k;
+            require_true(ring.try_push(r), "push into a non-full ring");
+        }
+        require_true(!ring.try_push(r), "push into a full ring fails");
+
+        for (std::uint64_t k = 0; k < 4; ++k)
+        {
+            require_true(ring.try_pop(r) && r.step == k, "pop in FIFO order");
+        }
+        require_true(!ring.try_pop(r), "pop from an empty ring fails");
+
+        // Wrap around several times.
+        for (std::uint64_t k = 0; k < 100; ++k)
+        {
+            r.step = k;
+            require_true(ring.try_push(r), "push after wrap");
+            require_true(ring.try_pop(r) && r.step == k, "pop after wrap");
+        }
+    }
+
+    // ---- Binary sink: a control loop logs every step, nothing is lost ----
+    const std::string binary = temp_path("ect_telemetry_test.bin");
+    {
+        LinearFOperator    f;
+        LinearEOperator    e(0.8);
+        LinearFInvOperator finv;
+        LinearGOperator    g(1.0, -1.0, 1.0);
+        Controller         ctrl(f, e, finv, g);
+
+        TelemetrySink sink(binary);
+
+        const std::size_t producers = 4;
+        const std::size_t steps     = 5000;
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < producers; ++t)
+        {
+            threads.emplace_back([&, t] {
+                double x = 10.0 * static_cast<double>(t + 1);
+                for (std::size_t k = 0; k < steps; ++k)
+                {
+                    TelemetryRecord r;
+                    r.step       = k;
+                    r.channel    = static_cast<std::uint32_t>(t);
+                    r.delta      = -x;
+                    r.u          = ctrl.update(r.delta);
+                    r.saturation = r.u <= -1.0 ? -1 : (r.u >= 1.0 ? 1 : 0);
+                    x += r.u;
+
+                    // Spin instead of dropping so the check below is exact.
+                    while (!sink.push(r))
+                    {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (std::thread& t : threads) t.join();
+
+        sink.close();
+        sink.close();   // idempotent
+        require_true(sink.written() == producers * steps, "every accepted record is written");
+
+        const std::uint64_t retry_drops = sink.dropped();
+        require_true(!sink.push(TelemetryRecord{}), "push after close is rejected");
+        require_true(sink.dropped() == retry_drops + 1, "rejected push is counted as a drop");
+
+        const std::vector<TelemetryRecord> records = read_telemetry(binary);
+        require_true(records.size() == producers * steps, "file holds every record");
+
+        std::vector<std::uint64_t> next(producers, 0);
+        bool in_order = true;
+        bool sat_seen = false;
+        for (const TelemetryRecord& r : records)
+        {
+            in_order = in_order && r.channel < producers && r.step == next[r.channel]++;
+            sat_seen = sat_seen || r.saturation == -1;
+        }
+        require_true(in_order, "per-producer order preserved");
+        require_true(sat_seen, "saturation state recorded");
+    }
+
+    // ---- CSV sink ----
+    const std::string csv = temp_path("ect_telemetry_test.csv");
+    {
+        TelemetryOptions options;
+        options.format = TelemetryFormat::Csv;
+        options.batch  = 7;
+
+        TelemetrySink sink(csv, options);
+        for (std::uint64_t k = 0; k < 100; ++k)
+        {
+            TelemetryRecord r;
+            r.step  = k;
+            r.delta = 0.1 * static_cast<double>(k);
+            r.u     = -r.delta;
+            require_true(sink.push(r), "push into an idle sink");
+        }
+        sink.close();
+
+        std::ifstream in(csv);
+        std::string   line;
+        std::getline(in, line);
+        require_true(line == "step,channel,delta,u,saturation", "CSV header");
+
+        std::size_t rows = 0;
+        std::string last;
+        while (std::getline(in, line))
+        {
+            ++rows;
+            last = line;
+        }
+        require_true(rows == 100, "CSV row count");
+        require_true(last == "99,0,9.9000000000000004,-9.9000000000000004,0", "CSV row round-trips doubles");
+    }
+
+    // ---- Drops are counted, never block ----
+    const std::string tiny = temp_path("ect_telemetry_test_tiny.bin");
+    {
+        TelemetryOptions options;
+        options.capacity         = 2;
+        options.poll_interval_us = 200000;
+
+        TelemetrySink sink(tiny, options);
+        std::size_t accepted = 0;
+        for (std::size_t k = 0; k < 10000; ++k)
+        {
+            accepted += sink.push(TelemetryRecord{}) ? 1 : 0;
+        }
+        sink.close();
+
+        require_true(sink.dropped() > 0, "overflow drops records");
+        require_true(accepted + sink.dropped() == 10000, "accepted + dropped == pushed");
+        require_true(sink.written() == accepted, "accepted records are written");
+    }
+
+    // ---- Pushes racing close() are written or counted, never lost ----
+    const std::string racing = temp_path("ect_telemetry_test_race.bin");
+    for (int round = 0; round < 20; ++round)
+    {
+        TelemetrySink sink(racing);
+
+        const std::size_t          producers = 3;
+        std::atomic<std::uint64_t> accepted{0};
+        std::atomic<std::uint64_t> attempts{0};
+        std::atomic<bool>          started{false};
+
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < producers; ++t)
+        {
+            threads.emplace_back([&] {
+                for (std::size_t k = 0; k < 2000; ++k)
+                {
+                    attempts.fetch_add(1);
+                    if (sink.push(TelemetryRecord{})) accepted.fetch_add(1);
+                    started.store(true);
+                    if (k % 64 == 0) std::this_thread::yield();
+                }
+            });
+        }
+        while (!started.load()) std::this_thread::yield();
+        sink.close();
+        for (std::thread& t : threads) t.join();
+
+        require_true(sink.written() == accepted.load(), "accepted records racing close() are written");
+        require_true(accepted.load() + sink.dropped() == attempts.load(), "racing pushes are written or dropped");
+    }
+
+    std::filesystem::remove(binary);
+    std::filesystem::remove(csv);
+    std::filesystem::remove(tiny);
+    std::filesystem::remove(racing);
+
+    std::cout << "[PASS] telemetry_test: ring, binary/CSV sinks and drop accounting" << std::endl;
+    return 0;
+}
@@ -0,0 +1,193 @@
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_thread_pool.hpp"
+#include "ect_trace.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+static std::string temp_path(const char* name)
+{
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+template <typename Fn>
+static bool throws(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    const std::string recorded = temp_path("ect_trace_test_recorded.ect");
+    const std::string replayed = temp_path("ect_trace_test_replayed.ect");
+    const std::string pooled   = temp_path("ect_trace_test_pooled.ect");
+    const std::string garbage  = temp_path("ect_trace_test_garbage.ect");
+
+    const std::size_t n = 10007;   // not a multiple of the chunk size
+
+    // ---- Round trip: append() rows, read them back through the mapping ----
+    {
+        TraceWriter w(recorded, n + 13,
+                      trace_column_bit(TraceColumn::Timestamp)
+                    | trace_column_bit(TraceColumn::Deviation)
+                    | trace_column_bit(TraceColumn::Target));
+        require_true(w.output() == nullptr && w.saturation() == nullptr, "absent columns are null");
+
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            TraceSample s;
+            s.timestamp = static_cast<std::int64_t>(i) * 1000000;
+            s.target    = 3.0 * std::sin(0.01 * static_cast<double>(i));
+            s.deviation = s.target - 0.5 * std::cos(0.013 * static_cast<double>(i));
+            w.append(s);
+        }
+        require_true(w.size() == n, "append advances size");
+        w.close();
+        require_true(throws([&] { w.close(); }), "double close throws");
+    }
+
+    {
+        const TraceReader r(recorded);
+        require_true(r.samples() == n, "sample count survives round trip");
+        require_true(r.has(TraceColumn::Deviation) && !r.has(TraceColumn::Output), "column mask survives round trip");
+        require_true(r.output() == nullptr, "absent column reads as null");
+
+        require_true(reinterpret_cast<std::uintptr_t>(r.deviation()) % 64 == 0, "columns are 64-byte aligned");
+        require_true(reinterpret_cast<std::uintptr_t>(r.target()) % 64 == 0, "columns are 64-byte aligned");
+
+        bool same = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const double t = 3.0 * std::sin(0.01 * static_cast<double>(i));
+            const double d = t - 0.5 * std::cos(0.013 * static_cast<double>(i));
+            same = same && r.timestamp()[i] == static_cast<std::int64_t>(i) * 1000000
+                        && r.target()[i] == t && r.deviation()[i] == d;
+        }
+        require_true(same, "values survive round trip");
+    }
+
+    // ---- Replay matches Controller::update() and flags saturation ----
+    LinearFOperator    f;
+    LinearEOperator    e(0.8);
+    LinearFInvOperator finv;
+    LinearGOperator    g(1.5, -2.0, 2.0);
+    Controller         ctrl(f, e, finv, g);
+
+    ReplayOptions options;
+    options.chunk = 1024;
+
+    {
+        const TraceReader in(recorded);
+        TraceWriter       out(replayed, in.samples());
+
+        const ReplaySummary s = replay(ctrl, in, out, options);
+        require_true(out.size() == n && s.samples == n, "replay covers the whole trace");
+        out.close();
+
+        const TraceReader r(replayed);
+        std::size_t lower = 0;
+        std::size_t upper = 0;
+        bool        same  = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const GEvaluation ev = ctrl.evaluate(in.deviation()[i]);
+            const double      u  = ctrl.update(in.deviation()[i]);
+            same = same && std::memcmp(&u, &r.output()[i], sizeof(double)) == 0;
+
+            const std::int8_t flag = static_cast<std::int8_t>(ev.state);
+            same = same && r.saturation()[i] == flag;
+            lower += flag < 0 ? 1 : 0;
+            upper += flag > 0 ? 1 : 0;
+
+            same = same && r.timestamp()[i] == in.timestamp()[i] && r.target()[i] == in.target()[i]
+                        && r.deviation()[i] == in.deviation()[i];
+        }
+        require_true(same, "replayed outputs, flags and carried columns match");
+        require_true(lower > 0 && upper > 0, "trace exercises both bounds");
+        require_true(s.saturated_lower == lower && s.saturated_upper == upper, "summary saturation counts");
+        require_true(s.max_abs_output == 2.0, "summary max |u|");
+    }
+
+    // ---- Pool replay is bit-identical, also for a nonlinear pipeline ----
+    {
+        SaturatingEOperator e_sat(0.8, 2.0);
+        Controller          nonlinear(f, e_sat, finv, g);
+
+        const TraceReader in(recorded);
+
+        TraceWriter serial_out(replayed, n, trace_column_bit(TraceColumn::Output));
+        const ReplaySummary a = replay(nonlinear, in, serial_out, options);
+        serial_out.close();
+
+        ThreadPoolOptions pool_options;
+        pool_options.threads = 4;
+        ThreadPool pool(pool_options);
+
+        TraceWriter pooled_out(pooled, n, trace_column_bit(TraceColumn::Output));
+        const ReplaySummary b = replay(nonlinear, in, pooled_out, options, pool);
+        pooled_out.close();
+
+        const TraceReader ra(replayed);
+        const TraceReader rb(pooled);
+        require_true(std::memcmp(ra.output(), rb.output(), n * sizeof(double)) == 0, "pool replay bit-identical");
+        require_true(a.saturated_lower == b.saturated_lower && a.saturated_upper == b.saturated_upper
+                  && a.max_abs_output == b.max_abs_output, "pool replay summary identical");
+    }
+
+    // ---- Errors ----
+    {
+        const TraceReader in(recorded);
+
+        TraceWriter small(pooled, n - 1, trace_column_bit(TraceColumn::Output));
+        require_true(throws([&] { replay(ctrl, in, small); }), "replay rejects a short output trace");
+
+        TraceWriter no_output(replayed, n, trace_column_bit(TraceColumn::Saturation));
+        require_true(throws([&] { replay(ctrl, in, no_output); }), "replay rejects a trace without output column");
+
+        TraceWriter full(garbage, 1, trace_column_bit(TraceColumn::Deviation));
+        full.append(TraceSample{});
+        require_true(throws([&] { full.append(TraceSample{}); }), "append past capacity throws");
+    }
+
+    {
+        std::ofstream(garbage, std::ios::binary) << "definitely not a trace file, but long enough to hold a header......";
+        require_true(throws([&] { TraceReader r(garbage); }), "bad magic rejected");
+        require_true(throws([&] { TraceReader r(temp_path("ect_trace_test_missing.ect")); }), "missing file rejected");
+    }
+
+    std::filesystem::remove(recorded);
+    std::filesystem::remove(replayed);
+    std::filesystem::remove(pooled);
+    std::filesystem::remove(garbage);
+
+    std::cout << "[PASS] trace_test: round trip, replay and parallel determinism" << std::endl;
+    return 0;
+}
@@ -0,0 +1,255 @@
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_simulation.hpp"
+#include "ect_thread_pool.hpp"
+#include "ect_trace.hpp"
+#include "ect_tuner.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+template <typename Fn>
+static bool throws(Fn fn)
+{
+    try
+    {
+        fn();
+    }
+    catch (const std::exception&)
+    {
+        return true;
+    }
+    return false;
+}
+
+static bool same_score(const TuningScore& a, const TuningScore& b)
+{
+    return a.settling_steps == b.settling_steps
+        && a.saturation_duty == b.saturation_duty
+        && a.noise_gain == b.noise_gain
+        && a.unsettled == b.unsettled;
+}
+
+static bool dominates(const TuningScore& a, const TuningScore& b)
+{
+    return a.settling_steps <= b.settling_steps && a.saturation_duty <= b.saturation_duty && a.noise_gain <= b.noise_gain
+        && (a.settling_steps < b.settling_steps || a.saturation_duty < b.saturation_duty || a.noise_gain < b.noise_gain);
+}
+
+// One candidate through per-scenario Controller loops: the code the tuner
+// replaces.
+static TuningScore reference(
+    const TuningCandidate&             c,
+    const std::vector<TuningScenario>& scenarios,
+    const TuningOptions&               options
+)
+{
+    LinearFOperator    f;
+    LinearEOperator    e(c.alpha);
+    LinearFInvOperator finv;
+    LinearGOperator    g(c.gain, c.u_min, c.u_max);
+    Controller         ctrl(f, e, finv, g);
+
+    const std::size_t steps = scenarios.front().target.size();
+
+    double noise_rms = 0.0;
+    for (std::size_t k = 0; k < steps; ++k) noise_rms += options.noise[k] * options.noise[k];
+    noise_rms = std::sqrt(noise_rms / static_cast<double>(steps));
+
+    TuningScore score;
+    for (const TuningScenario& s : scenarios)
+    {
+        double      x = s.initial_position, x_noisy = s.initial_position;
+        double      band = 0.0, energy = 0.0;
+        std::size_t last_outside = 0, saturated = 0;
+
+        for (std::size_t k = 0; k < steps; ++k)
+        {
+            const double d = s.target[k] - x;
+            if (k == 0) band = std::fmax(options.settling_fraction * std::fabs(d), options.settling_floor);
+            if (std::fabs(d) > band) last_outside = k + 1;
+
+            const GEvaluation clean = ctrl.evaluate(d);
+            const double      noisy = ctrl.update((s.target[k] - x_noisy) + options.noise[k]);
+
+            saturated += clean.state != ClampState::Free ? 1 : 0;
+            energy    += (noisy - clean.u) * (noisy - clean.u);
+            x         += clean.u;
+            x_noisy   += noisy;
+        }
+
+        score.settling_steps  += static_cast<double>(last_outside);
+        score.saturation_duty += static_cast<double>(saturated) / static_cast<double>(steps);
+        score.noise_gain      += std::sqrt(energy / static_cast<double>(steps)) / noise_rms;
+        score.unsettled       += last_outside >= steps ? 1 : 0;
+    }
+
+    const double n = static_cast<double>(scenarios.size());
+    score.settling_steps  /= n;
+    score.saturation_duty /= n;
+    score.noise_gain      /= n;
+    return score;
+}
+
+int main()
+{
+    const std::size_t steps = 150;
+
+    std::vector<TuningScenario> scenarios;
+    scenarios.push_back(tuning_scenario(TargetProfile::constant(10.0), 0.0, steps));
+    scenarios.push_back(tuning_scenario(TargetProfile::constant(-3.0), 1.0, steps));
+    scenarios.push_back(tuning_scenario(TargetProfile::ramp_sine(0.0, 0.02, 0.5, 0.05), 0.0, steps));
+
+    const std::vector<TuningCandidate> candidates = tuning_grid(
+        { 0.2, 0.35, 0.5, 0.65, 0.8, 0.9, 0.95, 1.0 },
+        { 0.5, 0.75, 1.0, 1.25, 1.5, 1.75, 1.9, 2.0 },
+        { 0.5, 1.0, 2.0, 4.0 });
+    require_true(candidates.size() == 256 && candidates[1].u_min == -1.0 && candidates[1].u_max == 1.0, "grid layout");
+
+    TuningOptions options;
+    options.noise = deterministic_noise(steps);
+    options.grain = 16;
+
+    const IntegratorPlant plant(1.0);
+    const TuningReport    report = tune(candidates, plant, scenarios, options);
+    require_true(report.scores.size() == candidates.size(), "one score per candidate");
+
+    // ---- Lanes match per-candidate Controller loops ----
+    {
+        bool same = true;
+        for (std::size_t i = 0; i < candidates.size(); i += 7)
+        {
+            same = same && same_score(report.scores[i], reference(candidates[i], scenarios, options));
+        }
+        require_true(same, "scores match per-candidate controller loops");
+    }
+
+    // ---- Pool and thread count do not change anything ----
+    {
+        ThreadPoolOptions pool_options;
+        pool_options.threads = 4;
+        ThreadPool pool(pool_options);
+
+        const TuningReport pooled = tune(candidates, plant, scenarios, options, pool);
+        bool same = pooled.pareto == report.pareto;
+        for (std::size_t i = 0; i < candidates.size(); ++i) same = same && same_score(pooled.scores[i], report.scores[i]);
+        require_true(same, "pooled report identical");
+    }
+
+    // ---- Pareto front ----
+    {
+        const std::vector<TuningScore>& s = report.scores;
+        require_true(!report.pareto.empty() && report.pareto.size() < candidates.size(), "non-trivial front");
+
+        std::vector<bool> on_front(s.size(), false);
+        for (std::size_t i : report.pareto) on_front[i] = true;
+
+        bool sound = true;
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            bool dominated = false;
+            for (std::size_t j = 0; j < s.size(); ++j) dominated = dominated || dominates(s[j], s[i]);
+            sound = sound && dominated != on_front[i];
+        }
+        require_true(sound, "front is exactly the non-dominated set");
+
+        for (std::size_t k = 1; k < report.pareto.size(); ++k)
+        {
+            sound = sound && s[report.pareto[k - 1]].settling_steps <= s[report.pareto[k]].settling_steps;
+        }
+        require_true(sound, "front ordered by settling");
+
+        // Loop gain 2 (alpha * gain = 1 with r = -1) never settles and is
+        // never worth picking.
+        const TuningScore& oscillating = s[7 * 32 + 7 * 4 + 3];   // alpha 1.0, gain 2.0, bound 4
+        require_true(oscillating.unsettled > 0 && !on_front[7 * 32 + 7 * 4 + 3], "oscillating candidate rejected");
+
+        const TuningScore& best = s[report.pareto.front()];
+        std::cout << "tuner: " << report.pareto.size() << " Pareto-optimal of " << candidates.size()
+                  << "; fastest settles in " << best.settling_steps << " steps" << std::endl;
+    }
+
+    // ---- Recorded trace replayed as a scenario ----
+    {
+        const std::filesystem::path dir  = std::filesystem::temp_directory_path();
+        const std::string           path = (dir / "ect_tuner_test.trace").string();
+
+        const TuningCandidate recorded{ 0.6, 1.0, -2.0, 2.0 };
+        {
+            LinearFOperator    f;
+            LinearEOperator    e(recorded.alpha);
+            LinearFInvOperator finv;
+            LinearGOperator    g(recorded.gain, recorded.u_min, recorded.u_max);
+            Controller         ctrl(f, e, finv, g);
+
+            TraceWriter w(path, steps, trace_column_bit(TraceColumn::Deviation) | trace_column_bit(TraceColumn::Output));
+            double x = 0.0;
+            for (std::size_t k = 0; k < steps; ++k)
+            {
+                TraceSample s;
+                s.deviation = (5.0 + 0.01 * static_cast<double>(k)) - x;
+                s.output    = ctrl.update(s.deviation);
+                x          += 0.5 * s.output;
+                w.append(s);
+            }
+            w.close();
+        }
+
+        const TraceReader    trace(path);
+        const TuningScenario replayed = tuning_scenario(trace, 0.5);
+        require_true(replayed.target.size() == steps, "trace scenario length");
+
+        bool target_recovered = true;
+        for (std::size_t k = 0; k < steps; ++k)
+        {
+            target_recovered = target_recovered && std::fabs(replayed.target[k] - (5.0 + 0.01 * static_cast<double>(k))) < 1e-12;
+        }
+        require_true(target_recovered, "reference rebuilt from deviation and output");
+
+        TuningOptions quiet;
+        const TuningReport r = tune({ recorded, TuningCandidate{ 0.9, 1.0, -2.0, 2.0 } }, IntegratorPlant(0.5), { replayed }, quiet);
+        require_true(r.scores[0].noise_gain == 0.0, "no noise run without noise");
+        require_true(r.scores[1].settling_steps < r.scores[0].settling_steps, "faster candidate scores better on the recording");
+
+        std::filesystem::remove(path);
+        require_true(throws([&] {
+            TraceWriter w(path, 4, trace_column_bit(TraceColumn::Deviation));
+            w.close();
+            tuning_scenario(TraceReader(path));
+        }), "trace without outputs rejected");
+        std::filesystem::remove(path);
+    }
+
+    // ---- Validation ----
+    {
+        require_true(throws([&] { tune(candidates, plant, {}, options); }), "no scenarios rejected");
+
+        std::vector<TuningScenario> uneven = scenarios;
+        uneven[1].target.pop_back();
+        require_true(throws([&] { tune(candidates, plant, uneven, options); }), "uneven scenarios rejected");
+
+        TuningOptions short_noise = options;
+        short_noise.noise.resize(10);
+        require_true(throws([&] { tune(candidates, plant, scenarios, short_noise); }), "short noise rejected");
+
+        require_true(throws([&] { tune({ TuningCandidate{ 0.8, 1.0, 1.0, -1.0 } }, plant, scenarios, options); }), "inverted bounds rejected");
+    }
+
+    std::cout << "[PASS] tuner_test: lane-parallel scoring and Pareto selection" << std::endl;
+    return 0;
+}
@@ -0,0 +1,119 @@
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_vector_controller.hpp"
+
+using namespace ect::sdk;
+
+static void require_true(bool cond, const char* msg)
+{
+    if (!cond)
+    {
+        std::cerr << "[FAIL] " << msg << std::endl;
+        std::exit(1);
+    }
+}
+
+// Wraps LinearVectorEOperator without being one: forces the staged path.
+class WrappedVectorEOperator final : public VectorEOperator
+{
+public:
+    explicit WrappedVectorEOperator(const LinearVectorEOperator& inner) : inner_(inner) {}
+    std::size_t dimension() const override { return inner_.dimension(); }
+    void apply(const double* x, double* out) const override { inner_.apply(x, out); }
+
+private:
+    const LinearVectorEOperator& inner_;
+};
+
+int main()
+{
+    constexpr std::size_t N = 6;
+
+    const std::vector<double> alpha = { 0.8, 0.5, 0.9, 0.3, 0.7, 0.6 };
+    const std::vector<double> gain  = { 1.0, 2.0, 0.5, 1.5, 1.0, 3.0 };
+    const std::vector<double> u_min = { -1.0, -2.0, -0.5, -10.0, -1e9, -0.1 };
+    const std::vector<double> u_max = {  1.0,  2.0,  0.5,  10.0,  1e9,  0.2 };
+
+    LinearVectorFOperator    f(N);
+    LinearVectorEOperator    e(alpha);
+    LinearVectorFInvOperator finv(N);
+    LinearVectorGOperator    g(gain, u_min, u_max);
+    WrappedVectorEOperator   e_wrapped(e);
+
+    VectorController        fused(f, e, finv, g);
+    VectorController        staged(f, e_wrapped, finv, g);
+    FixedVectorController<N> fixed(f, e, finv, g);
+
+    require_true(fused.dimension() == N, "VectorController dimension mismatch");
+
+    // One scalar Controller per axis as the reference.
+    LinearFOperator    sf;
+    LinearFInvOperator sfinv;
+
+    const double samples[] = { -1e6, -3.0, -1.0, -0.25, 0.0, 1e-12, 0.25, 1.0, 3.0, 1e6 };
+
+    for (double s : samples)
+    {
+        FixedVectorController<N>::Vector delta;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            delta[i] = s * static_cast<double>(i + 1);
+        }
+
+        double u_fused[N];
+        double u_staged[N];
+        fused.update(delta.data(), u_fused);
+        staged.update(delta.data(), u_staged);
+        const FixedVectorController<N>::Vector u_fixed = fixed.update(delta);
+
+        FixedVectorController<N>::Vector u_inplace = delta;
+        fused.update(u_inplace.data(), u_inplace.data());
+
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            LinearEOperator se(alpha[i]);
+            LinearGOperator sg(gain[i], u_min[i], u_max[i]);
+            Controller      axis(sf, se, sfinv, sg);
+
+            const double ref = axis.update(delta[i]);
+
+            require_true(u_fused[i]   == ref, "Vector (SoA) path differs from per-axis Controller");
+            require_true(u_staged[i]  == ref, "Vector (staged) path differs from per-axis Controller");
+            require_true(u_fixed[i]   == ref, "FixedVectorController differs from per-axis Controller");
+            require_true(u_inplace[i] == ref, "In-place vector update differs from per-axis Controller");
+            require_true(u_fused[i] >= u_min[i] && u_fused[i] <= u_max[i], "Vector output out of bounds");
+        }
+    }
+
+    // Configuration errors are detected at construction.
+    bool threw = false;
+    try
+    {
+        LinearVectorFOperator f5(5);
+        VectorController bad(f5, e, finv, g);
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    require_true(threw, "Dimension mismatch was not rejected");
+
+    threw = false;
+    try
+    {
+        FixedVectorController<4> bad(f, e, finv, g);
+    }
+    catch (const std::invalid_argument&)
+    {
+        threw = true;
+    }
+    require_true(threw, "FixedVectorController<N> accepted operators of another dimension");
+
+    std::cout << "[PASS] vector_controller_test: " << N
+              << "-axis pipeline matches per-axis Controllers (SoA, staged, fixed-N)." << std::endl;
+    return 0;
+}
@@ -0,0 +1,218 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "ect_sdk.hpp"
+#include "ect_bank_image.hpp"
+#include "ect_contract_verifier.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+// -----------------------------------------------------------------------------
+// ect_bankc — bank configuration compiler
+//
+// Usage: ect_bankc CONFIG -o IMAGE [options]
+//   --verify              run the contract verifier on every distinct group
+//   --grid N  --samples N --per-decade N  --threads T
+//
+// Parameters are always checked against the operator constructors; --verify
+// additionally sweeps each distinct operator set with verify_contracts().
+// Exit status: 0 image written, 1 contract violations found, 2 usage or
+// configuration error.
+// -----------------------------------------------------------------------------
+
+namespace
+{
+    struct Operators
+    {
+        std::unique_ptr<FOperator>    f;
+        std::unique_ptr<EOperator>    e;
+        std::unique_ptr<FInvOperator> finv;
+        std::unique_ptr<GOperator>    g;
+    };
+
+    Operators make_operators(const BankGroup& group)
+    {
+        Operators ops;
+        const double* p = group.e_params;
+
+        switch (group.f)
+        {
+            case FKind::Linear:  ops.f = std::make_unique<LinearFOperator>();                 break;
+            case FKind::Tanh:    ops.f = std::make_unique<TanhFOperator>(group.f_scale);      break;
+            case FKind::Asinh:   ops.f = std::make_unique<AsinhFOperator>(group.f_scale);     break;
+            case FKind::Sigmoid: ops.f = std::make_unique<SigmoidFOperator>(group.f_scale);   break;
+        }
+        switch (group.e)
+        {
+            case EKind::Linear:     ops.e = std::make_unique<LinearEOperator>(p[0]);                 break;
+            case EKind::Saturating: ops.e = std::make_unique<SaturatingEOperator>(p[0], p[1]);       break;
+            case EKind::Power:      ops.e = std::make_unique<PowerEOperator>(p[0], p[1], p[2]);      break;
+        }
+        switch (group.finv)
+        {
+            case FInvKind::Linear:  ops.finv = std::make_unique<LinearFInvOperator>();                break;
+            case FInvKind::Atanh:   ops.finv = std::make_unique<AtanhFInvOperator>(group.finv_scale); break;
+            case FInvKind::Sinh:    ops.finv = std::make_unique<SinhFInvOperator>(group.finv_scale);  break;
+            case FInvKind::Sigmoid: ops.finv = std::make_unique<SigmoidFInvOperator>(group.finv_scale); break;
+        }
+        switch (group.g)
+        {
+            case GKind::Linear:
+                ops.g = std::make_unique<LinearGOperator>(group.g_gain, group.g_min, group.g_max);
+                break;
+            case GKind::SmoothSaturation:
+                ops.g = std::make_unique<SmoothSaturationGOperator>(group.g_gain, group.g_min, group.g_max);
+                break;
+        }
+        return ops;
+    }
+
+    // Identifies the operator set of a group, ignoring the count.
+    std::string operator_key(const BankGroup& group)
+    {
+        const std::uint8_t kinds[4] = {
+            static_cast<std::uint8_t>(group.f),    static_cast<std::uint8_t>(group.e),
+            static_cast<std::uint8_t>(group.finv), static_cast<std::uint8_t>(group.g)
+        };
+        const double params[8] = {
+            group.f_scale, group.e_params[0], group.e_params[1], group.e_params[2],
+            group.finv_scale, group.g_gain, group.g_min, group.g_max
+        };
+
+        std::string key(sizeof(kinds) + sizeof(params), '\0');
+        std::memcpy(&key[0], kinds, sizeof(kinds));
+        std::memcpy(&key[sizeof(kinds)], params, sizeof(params));
+        return key;
+    }
+
+    // Positive decimal count; false for anything else (sign, trailing
+    // characters, zero, out of range).
+    bool parse_count(const std::string& text, std::uint64_t& out)
+    {
+        if (text.empty() || text[0] < '0' || text[0] > '9') return false;
+        try
+        {
+            std::size_t pos = 0;
+            const unsigned long long v = std::stoull(text, &pos);
+            if (pos != text.size() || v == 0) return false;
+            out = static_cast<std::uint64_t>(v);
+            return true;
+        }
+        catch (const std::exception&)
+        {
+            return false;
+        }
+    }
+
+    int usage(const char* argv0)
+    {
+        std::fprintf(stderr,
+            "usage: %s CONFIG -o IMAGE [--verify] [--grid N] [--samples N] [--per-decade N] [--threads T]\n",
+            argv0);
+        return 2;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string config_path;
+    std::string image_path;
+    bool        verify = false;
+
+    // Per-group sweeps are much smaller than ect_verify's defaults; a bank
+    // may hold many distinct operator sets.
+    VerifierOptions options;
+    options.grid_points       = std::size_t(1) << 14;
+    options.points_per_decade = 16;
+    options.random_samples    = std::uint64_t(1) << 14;
+
+    ThreadPoolOptions pool_options;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const auto value = [&]() -> std::string {
+                if (i + 1 >= argc)
+                {
+                    throw std::invalid_argument("missing value for " + arg);
+                }
+                return argv[++i];
+            };
+
+            if      (arg == "-o")           image_path                = value();
+            else if (arg == "--verify")     verify                    = true;
+            else if (arg == "--grid")       options.grid_points       = std::stoull(value());
+            else if (arg == "--samples")
+            {
+                if (!parse_count(value(), options.random_samples)) return usage(argv[0]);
+            }
+            else if (arg == "--per-decade") options.points_per_decade = std::stoull(value());
+            else if (arg == "--threads")    pool_options.threads      = std::stoull(value());
+            else if (config_path.empty() && arg[0] != '-') config_path = arg;
+            else                            return usage(argv[0]);
+        }
+        if (config_path.empty() || image_path.empty())
+        {
+            return usage(argv[0]);
+        }
+
+        const BankConfig config = load_bank_config(config_path);
+
+        std::size_t failed = 0;
+        if (verify)
+        {
+            ThreadPool pool(pool_options);
+
+            std::set<std::string> checked;
+            for (std::size_t i = 0; i < config.groups.size(); ++i)
+            {
+                const BankGroup& group = config.groups[i];
+                if (!checked.insert(operator_key(group)).second) continue;
+
+                const Operators ops = make_operators(group);
+                const VerificationReport report = verify_contracts(*ops.f, *ops.e, *ops.finv, *ops.g, options, pool);
+                if (report.passed()) continue;
+
+                ++failed;
+                for (std::size_t c = 0; c < CHECK_COUNT; ++c)
+                {
+                    const CheckResult& r = report.checks[c];
+                    if (r.violations == 0) continue;
+                    std::printf("group %zu: %s FAIL violations=%llu",
+                                i, check_name(static_cast<Check>(c)),
+                                static_cast<unsigned long long>(r.violations));
+                    if (r.has_counterexample)
+                    {
+                        std::printf("  x=%.17g -> %.17g", r.counterexample.input, r.counterexample.output);
+                    }
+                    std::printf("\n");
+                }
+            }
+            std::printf("verified %zu distinct operator set(s), %zu failed\n", checked.size(), failed);
+        }
+
+        if (failed > 0)
+        {
+            return 1;
+        }
+
+        write_bank_image(config, image_path);
+        std::printf("%s: %zu group(s), %zu controller(s)\n",
+                    image_path.c_str(), config.groups.size(), config.size());
+        return 0;
+    }
+    catch (const std::exception& ex)
+    {
+        std::fprintf(stderr, "ect_bankc: %s\n", ex.what());
+        return 2;
+    }
+}
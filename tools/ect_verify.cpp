@@ -0,0 +1,210 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "ect_sdk.hpp"
+#include "ect_contract_verifier.hpp"
+#include "ect_nonlinear_operators.hpp"
+#include "ect_thread_pool.hpp"
+
+using namespace ect::sdk;
+
+// -----------------------------------------------------------------------------
+// ect_verify — operator contract verifier
+//
+// Usage: ect_verify [options]
+//   --f    linear | tanh:S | asinh:S | sigmoid:S             (default linear)
+//   --e    linear:K | saturating:A,L | power:A,P,L          (default linear:0.8)
+//   --finv linear | atanh:S | sinh:S | sigmoid:S            (default linear)
+//   --g    linear:K,MIN,MAX | smooth:K,MIN,MAX              (default linear:1,-1,1)
+//   --grid N  --range R  --per-decade N  --samples N  --seed S
+//   --threads T  --grain N  --raw  --infinities
+//   --origin-radius R  --origin-gain K
+//
+// Exit status: 0 all contracts hold, 1 violations found, 2 usage error.
+// -----------------------------------------------------------------------------
+
+namespace
+{
+    struct Spec
+    {
+        std::string         name;
+        std::vector<double> params;
+    };
+
+    Spec parse_spec(const std::string& text)
+    {
+        Spec spec;
+        const std::size_t colon = text.find(':');
+        spec.name = text.substr(0, colon);
+
+        if (colon != std::string::npos)
+        {
+            std::string rest = text.substr(colon + 1);
+            std::size_t pos  = 0;
+            while (pos <= rest.size())
+            {
+                const std::size_t comma = rest.find(',', pos);
+                const std::string item  = rest.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos);
+                spec.params.push_back(std::stod(item));
+                if (comma == std::string::npos)
+                {
+                    break;
+                }
+                pos = comma + 1;
+            }
+        }
+        return spec;
+    }
+
+    double param(const Spec& s, std::size_t i, double fallback)
+    {
+        return i < s.params.size() ? s.params[i] : fallback;
+    }
+
+    std::unique_ptr<FOperator> make_f(const Spec& s)
+    {
+        if (s.name == "linear")  return std::make_unique<LinearFOperator>();
+        if (s.name == "tanh")    return std::make_unique<TanhFOperator>(param(s, 0, 1.0));
+        if (s.name == "asinh")   return std::make_unique<AsinhFOperator>(param(s, 0, 1.0));
+        if (s.name == "sigmoid") return std::make_unique<SigmoidFOperator>(param(s, 0, 1.0));
+        throw std::invalid_argument("unknown F operator: " + s.name);
+    }
+
+    std::unique_ptr<EOperator> make_e(const Spec& s)
+    {
+        if (s.name == "linear")     return std::make_unique<LinearEOperator>(param(s, 0, 0.8));
+        if (s.name == "saturating") return std::make_unique<SaturatingEOperator>(param(s, 0, 0.8), param(s, 1, 1.0));
+        if (s.name == "power")
+        {
+            return std::make_unique<PowerEOperator>(param(s, 0, 0.8), param(s, 1, 2.0), param(s, 2, 1.0));
+        }
+        throw std::invalid_argument("unknown E operator: " + s.name);
+    }
+
+    std::unique_ptr<FInvOperator> make_finv(const Spec& s)
+    {
+        if (s.name == "linear")  return std::make_unique<LinearFInvOperator>();
+        if (s.name == "atanh")   return std::make_unique<AtanhFInvOperator>(param(s, 0, 1.0));
+        if (s.name == "sinh")    return std::make_unique<SinhFInvOperator>(param(s, 0, 1.0));
+        if (s.name == "sigmoid") return std::make_unique<SigmoidFInvOperator>(param(s, 0, 1.0));
+        throw std::invalid_argument("unknown F^-1 operator: " + s.name);
+    }
+
+    std::unique_ptr<GOperator> make_g(const Spec& s)
+    {
+        const double k  = param(s, 0, 1.0);
+        const double lo = param(s, 1, -1.0);
+        const double hi = param(s, 2, 1.0);
+
+        if (s.name == "linear") return std::make_unique<LinearGOperator>(k, lo, hi);
+        if (s.name == "smooth") return std::make_unique<SmoothSaturationGOperator>(k, lo, hi);
+        throw std::invalid_argument("unknown G operator: " + s.name);
+    }
+
+    int usage(const char* argv0)
+    {
+        std::fprintf(stderr,
+            "usage: %s [--f SPEC] [--e SPEC] [--finv SPEC] [--g SPEC]\n"
+            "          [--grid N] [--range R] [--per-decade N] [--samples N] [--seed S]\n"
+            "          [--threads T] [--grain N] [--raw] [--infinities]\n"
+            "          [--origin-radius R] [--origin-gain K]\n",
+            argv0);
+        return 2;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::string f_spec    = "linear";
+    std::string e_spec    = "linear:0.8";
+    std::string finv_spec = "linear";
+    std::string g_spec    = "linear:1,-1,1";
+
+    VerifierOptions   options;
+    ThreadPoolOptions pool_options;
+
+    try
+    {
+        for (int i = 1; i < argc; ++i)
+        {
+            const std::string arg = argv[i];
+            const auto value = [&]() -> std::string {
+                if (i + 1 >= argc)
+                {
+                    throw std::invalid_argument("missing value for " + arg);
+                }
+                return argv[++i];
+            };
+
+            if      (arg == "--f")             f_spec    = value();
+            else if (arg == "--e")             e_spec    = value();
+            else if (arg == "--finv")          finv_spec = value();
+            else if (arg == "--g")             g_spec    = value();
+            else if (arg == "--grid")          options.grid_points       = std::stoull(value());
+            else if (arg == "--range")         options.range             = std::stod(value());
+            else if (arg == "--per-decade")    options.points_per_decade = std::stoull(value());
+            else if (arg == "--samples")       options.random_samples    = static_cast<std::uint64_t>(std::stod(value()));
+            else if (arg == "--seed")          options.seed              = std::stoull(value());
+            else if (arg == "--grain")         options.grain             = std::stoull(value());
+            else if (arg == "--threads")       pool_options.threads      = std::stoull(value());
+            else if (arg == "--origin-radius") options.origin_radius     = std::stod(value());
+            else if (arg == "--origin-gain")   options.origin_gain       = std::stod(value());
+            else if (arg == "--raw")           options.propagate          = false;
+            else if (arg == "--infinities")    options.include_infinities = true;
+            else                               return usage(argv[0]);
+        }
+
+        const std::unique_ptr<FOperator>    f    = make_f(parse_spec(f_spec));
+        const std::unique_ptr<EOperator>    e    = make_e(parse_spec(e_spec));
+        const std::unique_ptr<FInvOperator> finv = make_finv(parse_spec(finv_spec));
+        const std::unique_ptr<GOperator>    g    = make_g(parse_spec(g_spec));
+
+        ThreadPool pool(pool_options);
+
+        const VerificationReport report = verify_contracts(*f, *e, *finv, *g, options, pool);
+
+        std::printf("operators: F=%s E=%s FInv=%s G=%s\n",
+                    f_spec.c_str(), e_spec.c_str(), finv_spec.c_str(), g_spec.c_str());
+        std::printf("samples: %llu | threads: %zu | stage inputs: %s | G bounds: [%.17g, %.17g]\n",
+                    static_cast<unsigned long long>(report.samples), pool.size(),
+                    options.propagate ? "propagated" : "raw", report.g_lower, report.g_upper);
+
+        for (std::size_t c = 0; c < CHECK_COUNT; ++c)
+        {
+            const CheckResult& r = report.checks[c];
+            std::printf("%-26s %s  evaluated=%llu violations=%llu",
+                        check_name(static_cast<Check>(c)),
+                        r.violations == 0 ? "PASS" : "FAIL",
+                        static_cast<unsigned long long>(r.evaluated),
+                        static_cast<unsigned long long>(r.violations));
+
+            if (r.has_counterexample)
+            {
+                const Counterexample& ce = r.counterexample;
+                std::printf("  x=%.17g -> %.17g", ce.input, ce.output);
+                if (ce.partner == ce.partner) // pairwise
+                {
+                    std::printf("  vs  x'=%.17g -> %.17g", ce.partner, ce.partner_output);
+                }
+                else if (ce.partner_output == ce.partner_output || ce.output != ce.output)
+                {
+                    std::printf("  (batch -> %.17g)", ce.partner_output);
+                }
+            }
+            std::printf("\n");
+        }
+
+        return report.passed() ? 0 : 1;
+    }
+    catch (const std::exception& ex)
+    {
+        std::fprintf(stderr, "ect_verify: %s\n", ex.what());
+        return 2;
+    }
+}